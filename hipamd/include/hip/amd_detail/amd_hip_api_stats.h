@@ -0,0 +1,77 @@
+/*
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef HIP_INCLUDE_AMD_HIP_API_STATS_H
+#define HIP_INCLUDE_AMD_HIP_API_STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <hip/hip_runtime_api.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * Number of log2 latency buckets. Bucket i counts the calls with latency in [2^i, 2^(i+1)) ns,
+ * the last bucket also counts all slower calls.
+ */
+#define HIP_API_STATS_HISTOGRAM_BUCKETS 32
+
+/**
+ * Aggregated statistics of a single HIP API, merged over all threads.
+ */
+typedef struct hipApiStats_t {
+  uint32_t apiId;        ///< HIP API ID, see hip_prof_str.h
+  const char* apiName;   ///< HIP API name
+  uint64_t callCount;    ///< Number of calls
+  uint64_t errorCount;   ///< Number of calls returned an error, except hipErrorNotReady
+  uint64_t totalNs;      ///< Total latency of all calls in ns
+  uint64_t maxNs;        ///< Maximum latency of a single call in ns
+  uint64_t histogram[HIP_API_STATS_HISTOGRAM_BUCKETS];  ///< log2 latency histogram
+} hipApiStats_t;
+
+/**
+ * @brief Returns per API call statistics, collected when HIP_API_STATS is enabled.
+ *
+ * Only APIs with at least one call are reported.
+ *
+ * @param [out] stats - Array of statistics, can be nullptr if @p count is 0
+ * @param [in,out] count - Size of @p stats on input, the number of available entries on output
+ *
+ * @returns #hipSuccess, #hipErrorInvalidValue
+ */
+hipError_t hipExtGetApiStats(hipApiStats_t* stats, size_t* count);
+
+/**
+ * @brief Clears all collected API call statistics.
+ *
+ * @returns #hipSuccess
+ */
+hipError_t hipExtResetApiStats(void);
+
+#if defined(__cplusplus)
+}  // extern "C"
+#endif
+
+#endif  // HIP_INCLUDE_AMD_HIP_API_STATS_H
@@ -0,0 +1,142 @@
+/*
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef HIP_INCLUDE_AMD_HIP_FP_CONVERT_H
+#define HIP_INCLUDE_AMD_HIP_FP_CONVERT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <hip/hip_runtime_api.h>
+
+/**
+ * Host side bulk conversions between float and the fp8, bf16 and fp16 storage formats.
+ *
+ * The functions convert whole arrays on the CPU, vectorized with AVX2, F16C or AVX-512 if the
+ * processor supports them. The results are bit-exact with the scalar __host__ conversions of
+ * amd_hip_fp8.h, amd_hip_bf16.h and amd_hip_fp16.h. The storage is raw bits, so the header
+ * doesn't require the HIP compiler.
+ */
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * FP8 format, the values match __hip_fp8_interpretation_t.
+ */
+typedef enum hipExtFp8Format_t {
+  hipExtFp8E4M3 = 0,      ///< OCP E4M3
+  hipExtFp8E5M2 = 1,      ///< OCP E5M2
+  hipExtFp8E4M3Fnuz = 2,  ///< E4M3 FNUZ
+  hipExtFp8E5M2Fnuz = 3,  ///< E5M2 FNUZ
+} hipExtFp8Format_t;
+
+/**
+ * Rounding of the float to fp8 conversion.
+ */
+typedef enum hipExtFp8Rounding_t {
+  hipExtFp8RoundNearestEven = 0,  ///< Round to nearest even, as __hip_cvt_float_to_fp8()
+  hipExtFp8RoundStochastic = 1,   ///< Stochastic rounding with hipExtFp8StochasticBits()
+} hipExtFp8Rounding_t;
+
+/**
+ * @brief Returns the random bits, which stochastic rounding adds to the element at @p index.
+ *
+ * The sequence is a counter based hash of the seed and the index, so the results don't depend
+ * on the vector width. The bits are the @p rng argument of the scalar internal::cast_to_f8().
+ */
+static inline uint32_t hipExtFp8StochasticBits(uint32_t seed, size_t index) {
+  uint32_t x = (uint32_t)index * 0x9E3779B9u + seed +
+      (uint32_t)((uint64_t)index >> 32) * 0x632BE5ABu;
+  x ^= x >> 16;
+  x *= 0x7FEB352Du;
+  x ^= x >> 15;
+  x *= 0x846CA68Bu;
+  x ^= x >> 16;
+  return x;
+}
+
+/**
+ * @brief Converts an array of floats to fp8.
+ *
+ * @param [in] src - Source floats
+ * @param [out] dst - Destination fp8 values
+ * @param [in] count - Number of elements
+ * @param [in] format - FP8 format
+ * @param [in] saturate - Saturate the out of range values to the max finite value
+ * @param [in] rounding - Rounding mode
+ * @param [in] seed - Seed of the stochastic rounding, ignored for round to nearest even
+ *
+ * @returns #hipSuccess, #hipErrorInvalidValue
+ */
+hipError_t hipExtConvertFloatToFp8(const float* src, uint8_t* dst, size_t count,
+                                   hipExtFp8Format_t format, int saturate,
+                                   hipExtFp8Rounding_t rounding, uint32_t seed);
+
+/**
+ * @brief Converts an array of fp8 values to floats.
+ *
+ * @param [in] src - Source fp8 values
+ * @param [out] dst - Destination floats
+ * @param [in] count - Number of elements
+ * @param [in] format - FP8 format
+ *
+ * @returns #hipSuccess, #hipErrorInvalidValue
+ */
+hipError_t hipExtConvertFp8ToFloat(const uint8_t* src, float* dst, size_t count,
+                                   hipExtFp8Format_t format);
+
+/**
+ * @brief Converts an array of floats to bf16 with round to nearest even.
+ *
+ * @returns #hipSuccess, #hipErrorInvalidValue
+ */
+hipError_t hipExtConvertFloatToBf16(const float* src, uint16_t* dst, size_t count);
+
+/**
+ * @brief Converts an array of bf16 values to floats.
+ *
+ * @returns #hipSuccess, #hipErrorInvalidValue
+ */
+hipError_t hipExtConvertBf16ToFloat(const uint16_t* src, float* dst, size_t count);
+
+/**
+ * @brief Converts an array of floats to fp16 with round to nearest even.
+ *
+ * @returns #hipSuccess, #hipErrorInvalidValue
+ */
+hipError_t hipExtConvertFloatToHalf(const float* src, uint16_t* dst, size_t count);
+
+/**
+ * @brief Converts an array of fp16 values to floats.
+ *
+ * @returns #hipSuccess, #hipErrorInvalidValue
+ */
+hipError_t hipExtConvertHalfToFloat(const uint16_t* src, float* dst, size_t count);
+
+#if defined(__cplusplus)
+}  // extern "C"
+#endif
+
+#endif  // HIP_INCLUDE_AMD_HIP_FP_CONVERT_H
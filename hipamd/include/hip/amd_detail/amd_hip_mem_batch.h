@@ -0,0 +1,77 @@
+/*
+Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef HIP_INCLUDE_AMD_HIP_MEM_BATCH_H
+#define HIP_INCLUDE_AMD_HIP_MEM_BATCH_H
+
+#include <stddef.h>
+
+#include <hip/hip_runtime_api.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * @brief Prefetches a batch of managed memory ranges.
+ *
+ * The result is the same as hipMemPrefetchAsync for every range in the array order. The runtime
+ * merges adjacent and overlapping ranges with the same destination, so a batch of many small
+ * allocations is issued as a few prefetch operations.
+ *
+ * @param [in] dev_ptrs - Array of pointers to the ranges
+ * @param [in] counts - Array of range sizes in bytes
+ * @param [in] devices - Array of destination devices, hipCpuDeviceId for the host
+ * @param [in] num_ranges - Number of the ranges
+ * @param [in] stream - Stream to enqueue the prefetch operations
+ *
+ * @returns #hipSuccess, #hipErrorInvalidValue, #hipErrorInvalidDevice, #hipErrorNotSupported
+ */
+hipError_t hipExtMemPrefetchBatchAsync(const void* const* dev_ptrs, const size_t* counts,
+                                       const int* devices, size_t num_ranges,
+                                       hipStream_t stream);
+
+/**
+ * @brief Advises about the usage of a batch of managed memory ranges.
+ *
+ * The result is the same as hipMemAdvise for every range in the array order. Adjacent and
+ * overlapping ranges with the same advice and device are applied with a single update of
+ * the memory attributes.
+ *
+ * @param [in] dev_ptrs - Array of pointers to the ranges
+ * @param [in] counts - Array of range sizes in bytes
+ * @param [in] advice - Array of advices
+ * @param [in] devices - Array of devices for the advices
+ * @param [in] num_ranges - Number of the ranges
+ *
+ * @returns #hipSuccess, #hipErrorInvalidValue, #hipErrorInvalidDevice
+ */
+hipError_t hipExtMemAdviseBatch(const void* const* dev_ptrs, const size_t* counts,
+                                const hipMemoryAdvise* advice, const int* devices,
+                                size_t num_ranges);
+
+#if defined(__cplusplus)
+}  // extern "C"
+#endif
+
+#endif  // HIP_INCLUDE_AMD_HIP_MEM_BATCH_H
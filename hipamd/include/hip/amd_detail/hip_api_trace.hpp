@@ -22,6 +22,8 @@
 #pragma once
 
 #include <hip/hip_runtime.h>
+#include <hip/amd_detail/amd_hip_api_stats.h>
+#include <hip/amd_detail/amd_hip_fp_convert.h>
 
 // Define some version macros for the API table. Use similar naming conventions to HSA-runtime
 // (MAJOR and STEP versions). Three groups at this time:
@@ -63,7 +65,7 @@
 #define HIP_API_TABLE_STEP_VERSION 0
 #define HIP_COMPILER_API_TABLE_STEP_VERSION 0
 #define HIP_TOOLS_API_TABLE_STEP_VERSION 0
-#define HIP_RUNTIME_API_TABLE_STEP_VERSION 9
+#define HIP_RUNTIME_API_TABLE_STEP_VERSION 12
 
 // HIP API interface
 // HIP compiler dispatch functions
@@ -1026,6 +1028,23 @@ typedef hipError_t (*t_hipGraphBatchMemOpNodeSetParams)(hipGraphNode_t hNode,
 typedef hipError_t (*t_hipGraphExecBatchMemOpNodeSetParams)(
     hipGraphExec_t hGraphExec, hipGraphNode_t hNode, const hipBatchMemOpNodeParams* nodeParams);
 typedef hipError_t (*t_hipEventRecordWithFlags)(hipEvent_t event, hipStream_t stream, unsigned int flags);
+typedef hipError_t (*t_hipExtMemPrefetchBatchAsync)(const void* const* dev_ptrs,
+                                                    const size_t* counts, const int* devices,
+                                                    size_t num_ranges, hipStream_t stream);
+typedef hipError_t (*t_hipExtMemAdviseBatch)(const void* const* dev_ptrs, const size_t* counts,
+                                             const hipMemoryAdvise* advice, const int* devices,
+                                             size_t num_ranges);
+typedef hipError_t (*t_hipExtGetApiStats)(hipApiStats_t* stats, size_t* count);
+typedef hipError_t (*t_hipExtResetApiStats)(void);
+typedef hipError_t (*t_hipExtConvertFloatToFp8)(const float* src, uint8_t* dst, size_t count,
+                                                hipExtFp8Format_t format, int saturate,
+                                                hipExtFp8Rounding_t rounding, uint32_t seed);
+typedef hipError_t (*t_hipExtConvertFp8ToFloat)(const uint8_t* src, float* dst, size_t count,
+                                                hipExtFp8Format_t format);
+typedef hipError_t (*t_hipExtConvertFloatToBf16)(const float* src, uint16_t* dst, size_t count);
+typedef hipError_t (*t_hipExtConvertBf16ToFloat)(const uint16_t* src, float* dst, size_t count);
+typedef hipError_t (*t_hipExtConvertFloatToHalf)(const float* src, uint16_t* dst, size_t count);
+typedef hipError_t (*t_hipExtConvertHalfToFloat)(const uint16_t* src, float* dst, size_t count);
 
 // HIP Compiler dispatch table
 struct HipCompilerDispatchTable {
@@ -1554,8 +1573,24 @@ struct HipDispatchTable {
   // HIP_RUNTIME_API_TABLE_STEP_VERSION == 9
   t_hipEventRecordWithFlags hipEventRecordWithFlags_fn;
 
-  // DO NOT EDIT ABOVE!
   // HIP_RUNTIME_API_TABLE_STEP_VERSION == 10
+  t_hipExtMemPrefetchBatchAsync hipExtMemPrefetchBatchAsync_fn;
+  t_hipExtMemAdviseBatch hipExtMemAdviseBatch_fn;
+
+  // HIP_RUNTIME_API_TABLE_STEP_VERSION == 11
+  t_hipExtGetApiStats hipExtGetApiStats_fn;
+  t_hipExtResetApiStats hipExtResetApiStats_fn;
+
+  // HIP_RUNTIME_API_TABLE_STEP_VERSION == 12
+  t_hipExtConvertFloatToFp8 hipExtConvertFloatToFp8_fn;
+  t_hipExtConvertFp8ToFloat hipExtConvertFp8ToFloat_fn;
+  t_hipExtConvertFloatToBf16 hipExtConvertFloatToBf16_fn;
+  t_hipExtConvertBf16ToFloat hipExtConvertBf16ToFloat_fn;
+  t_hipExtConvertFloatToHalf hipExtConvertFloatToHalf_fn;
+  t_hipExtConvertHalfToFloat hipExtConvertHalfToFloat_fn;
+
+  // DO NOT EDIT ABOVE!
+  // HIP_RUNTIME_API_TABLE_STEP_VERSION == 13
 
   // ******************************************************************************************* //
   //
@@ -10,6 +10,8 @@
 #include <hip/hip_runtime_api.h>
 #include <hip/hip_deprecated.h>
 #include "amd_hip_gl_interop.h"
+#include "amd_hip_mem_batch.h"
+#include "amd_hip_fp_convert.h"
 
 #define HIP_API_ID_CONCAT_HELPER(a,b) a##b
 #define HIP_API_ID_CONCAT(a,b) HIP_API_ID_CONCAT_HELPER(a,b)
@@ -431,7 +433,15 @@ enum hip_api_id_t {
   HIP_API_ID_hipGraphBatchMemOpNodeSetParams = 411,
   HIP_API_ID_hipGraphExecBatchMemOpNodeSetParams = 412,
   HIP_API_ID_hipEventRecordWithFlags = 413,
-  HIP_API_ID_LAST = 413,
+  HIP_API_ID_hipExtMemAdviseBatch = 414,
+  HIP_API_ID_hipExtMemPrefetchBatchAsync = 415,
+  HIP_API_ID_hipExtConvertBf16ToFloat = 416,
+  HIP_API_ID_hipExtConvertFloatToBf16 = 417,
+  HIP_API_ID_hipExtConvertFloatToFp8 = 418,
+  HIP_API_ID_hipExtConvertFloatToHalf = 419,
+  HIP_API_ID_hipExtConvertFp8ToFloat = 420,
+  HIP_API_ID_hipExtConvertHalfToFloat = 421,
+  HIP_API_ID_LAST = 421,
 
   HIP_API_ID_hipChooseDevice = HIP_API_ID_CONCAT(HIP_API_ID_,hipChooseDevice),
   HIP_API_ID_hipGetDeviceProperties = HIP_API_ID_CONCAT(HIP_API_ID_,hipGetDeviceProperties),
@@ -552,11 +562,19 @@ static inline const char* hip_api_name(const uint32_t id) {
     case HIP_API_ID_hipEventRecord: return "hipEventRecord";
     case HIP_API_ID_hipEventRecordWithFlags: return "hipEventRecordWithFlags";
     case HIP_API_ID_hipEventSynchronize: return "hipEventSynchronize";
+    case HIP_API_ID_hipExtConvertBf16ToFloat: return "hipExtConvertBf16ToFloat";
+    case HIP_API_ID_hipExtConvertFloatToBf16: return "hipExtConvertFloatToBf16";
+    case HIP_API_ID_hipExtConvertFloatToFp8: return "hipExtConvertFloatToFp8";
+    case HIP_API_ID_hipExtConvertFloatToHalf: return "hipExtConvertFloatToHalf";
+    case HIP_API_ID_hipExtConvertFp8ToFloat: return "hipExtConvertFp8ToFloat";
+    case HIP_API_ID_hipExtConvertHalfToFloat: return "hipExtConvertHalfToFloat";
     case HIP_API_ID_hipExtGetLastError: return "hipExtGetLastError";
     case HIP_API_ID_hipExtGetLinkTypeAndHopCount: return "hipExtGetLinkTypeAndHopCount";
     case HIP_API_ID_hipExtLaunchKernel: return "hipExtLaunchKernel";
     case HIP_API_ID_hipExtLaunchMultiKernelMultiDevice: return "hipExtLaunchMultiKernelMultiDevice";
     case HIP_API_ID_hipExtMallocWithFlags: return "hipExtMallocWithFlags";
+    case HIP_API_ID_hipExtMemAdviseBatch: return "hipExtMemAdviseBatch";
+    case HIP_API_ID_hipExtMemPrefetchBatchAsync: return "hipExtMemPrefetchBatchAsync";
     case HIP_API_ID_hipExtModuleLaunchKernel: return "hipExtModuleLaunchKernel";
     case HIP_API_ID_hipExtStreamCreateWithCUMask: return "hipExtStreamCreateWithCUMask";
     case HIP_API_ID_hipExtStreamGetCUMask: return "hipExtStreamGetCUMask";
@@ -960,11 +978,19 @@ static inline uint32_t hipApiIdByName(const char* name) {
   if (strcmp("hipEventRecord", name) == 0) return HIP_API_ID_hipEventRecord;
   if (strcmp("hipEventRecordWithFlags", name) == 0) return HIP_API_ID_hipEventRecordWithFlags;
   if (strcmp("hipEventSynchronize", name) == 0) return HIP_API_ID_hipEventSynchronize;
+  if (strcmp("hipExtConvertBf16ToFloat", name) == 0) return HIP_API_ID_hipExtConvertBf16ToFloat;
+  if (strcmp("hipExtConvertFloatToBf16", name) == 0) return HIP_API_ID_hipExtConvertFloatToBf16;
+  if (strcmp("hipExtConvertFloatToFp8", name) == 0) return HIP_API_ID_hipExtConvertFloatToFp8;
+  if (strcmp("hipExtConvertFloatToHalf", name) == 0) return HIP_API_ID_hipExtConvertFloatToHalf;
+  if (strcmp("hipExtConvertFp8ToFloat", name) == 0) return HIP_API_ID_hipExtConvertFp8ToFloat;
+  if (strcmp("hipExtConvertHalfToFloat", name) == 0) return HIP_API_ID_hipExtConvertHalfToFloat;
   if (strcmp("hipExtGetLastError", name) == 0) return HIP_API_ID_hipExtGetLastError;
   if (strcmp("hipExtGetLinkTypeAndHopCount", name) == 0) return HIP_API_ID_hipExtGetLinkTypeAndHopCount;
   if (strcmp("hipExtLaunchKernel", name) == 0) return HIP_API_ID_hipExtLaunchKernel;
   if (strcmp("hipExtLaunchMultiKernelMultiDevice", name) == 0) return HIP_API_ID_hipExtLaunchMultiKernelMultiDevice;
   if (strcmp("hipExtMallocWithFlags", name) == 0) return HIP_API_ID_hipExtMallocWithFlags;
+  if (strcmp("hipExtMemAdviseBatch", name) == 0) return HIP_API_ID_hipExtMemAdviseBatch;
+  if (strcmp("hipExtMemPrefetchBatchAsync", name) == 0) return HIP_API_ID_hipExtMemPrefetchBatchAsync;
   if (strcmp("hipExtModuleLaunchKernel", name) == 0) return HIP_API_ID_hipExtModuleLaunchKernel;
   if (strcmp("hipExtStreamCreateWithCUMask", name) == 0) return HIP_API_ID_hipExtStreamCreateWithCUMask;
   if (strcmp("hipExtStreamGetCUMask", name) == 0) return HIP_API_ID_hipExtStreamGetCUMask;
@@ -1683,6 +1709,53 @@ typedef struct hip_api_data_s {
     struct {
       hipEvent_t event;
     } hipEventSynchronize;
+    struct {
+      const uint16_t* src;
+      uint16_t src__val;
+      float* dst;
+      float dst__val;
+      size_t count;
+    } hipExtConvertBf16ToFloat;
+    struct {
+      const float* src;
+      float src__val;
+      uint16_t* dst;
+      uint16_t dst__val;
+      size_t count;
+    } hipExtConvertFloatToBf16;
+    struct {
+      const float* src;
+      float src__val;
+      uint8_t* dst;
+      uint8_t dst__val;
+      size_t count;
+      hipExtFp8Format_t format;
+      int saturate;
+      hipExtFp8Rounding_t rounding;
+      unsigned int seed;
+    } hipExtConvertFloatToFp8;
+    struct {
+      const float* src;
+      float src__val;
+      uint16_t* dst;
+      uint16_t dst__val;
+      size_t count;
+    } hipExtConvertFloatToHalf;
+    struct {
+      const uint8_t* src;
+      uint8_t src__val;
+      float* dst;
+      float dst__val;
+      size_t count;
+      hipExtFp8Format_t format;
+    } hipExtConvertFp8ToFloat;
+    struct {
+      const uint16_t* src;
+      uint16_t src__val;
+      float* dst;
+      float dst__val;
+      size_t count;
+    } hipExtConvertHalfToFloat;
     struct {
       int device1;
       int device2;
@@ -1715,6 +1788,27 @@ typedef struct hip_api_data_s {
       size_t sizeBytes;
       unsigned int flags;
     } hipExtMallocWithFlags;
+    struct {
+      const void* const* dev_ptrs;
+      const void* dev_ptrs__val;
+      const size_t* counts;
+      size_t counts__val;
+      const hipMemoryAdvise* advice;
+      hipMemoryAdvise advice__val;
+      const int* devices;
+      int devices__val;
+      size_t num_ranges;
+    } hipExtMemAdviseBatch;
+    struct {
+      const void* const* dev_ptrs;
+      const void* dev_ptrs__val;
+      const size_t* counts;
+      size_t counts__val;
+      const int* devices;
+      int devices__val;
+      size_t num_ranges;
+      hipStream_t stream;
+    } hipExtMemPrefetchBatchAsync;
     struct {
       hipFunction_t f;
       unsigned int globalWorkSizeX;
@@ -4092,6 +4186,47 @@ typedef struct hip_api_data_s {
 #define INIT_hipEventSynchronize_CB_ARGS_DATA(cb_data) { \
   cb_data.args.hipEventSynchronize.event = (hipEvent_t)event; \
 };
+// hipExtConvertBf16ToFloat[('const uint16_t*', 'src'), ('float*', 'dst'), ('size_t', 'count')]
+#define INIT_hipExtConvertBf16ToFloat_CB_ARGS_DATA(cb_data) { \
+  cb_data.args.hipExtConvertBf16ToFloat.src = (const uint16_t*)src; \
+  cb_data.args.hipExtConvertBf16ToFloat.dst = (float*)dst; \
+  cb_data.args.hipExtConvertBf16ToFloat.count = (size_t)count; \
+};
+// hipExtConvertFloatToBf16[('const float*', 'src'), ('uint16_t*', 'dst'), ('size_t', 'count')]
+#define INIT_hipExtConvertFloatToBf16_CB_ARGS_DATA(cb_data) { \
+  cb_data.args.hipExtConvertFloatToBf16.src = (const float*)src; \
+  cb_data.args.hipExtConvertFloatToBf16.dst = (uint16_t*)dst; \
+  cb_data.args.hipExtConvertFloatToBf16.count = (size_t)count; \
+};
+// hipExtConvertFloatToFp8[('const float*', 'src'), ('uint8_t*', 'dst'), ('size_t', 'count'), ('hipExtFp8Format_t', 'format'), ('int', 'saturate'), ('hipExtFp8Rounding_t', 'rounding'), ('unsigned int', 'seed')]
+#define INIT_hipExtConvertFloatToFp8_CB_ARGS_DATA(cb_data) { \
+  cb_data.args.hipExtConvertFloatToFp8.src = (const float*)src; \
+  cb_data.args.hipExtConvertFloatToFp8.dst = (uint8_t*)dst; \
+  cb_data.args.hipExtConvertFloatToFp8.count = (size_t)count; \
+  cb_data.args.hipExtConvertFloatToFp8.format = (hipExtFp8Format_t)format; \
+  cb_data.args.hipExtConvertFloatToFp8.saturate = (int)saturate; \
+  cb_data.args.hipExtConvertFloatToFp8.rounding = (hipExtFp8Rounding_t)rounding; \
+  cb_data.args.hipExtConvertFloatToFp8.seed = (unsigned int)seed; \
+};
+// hipExtConvertFloatToHalf[('const float*', 'src'), ('uint16_t*', 'dst'), ('size_t', 'count')]
+#define INIT_hipExtConvertFloatToHalf_CB_ARGS_DATA(cb_data) { \
+  cb_data.args.hipExtConvertFloatToHalf.src = (const float*)src; \
+  cb_data.args.hipExtConvertFloatToHalf.dst = (uint16_t*)dst; \
+  cb_data.args.hipExtConvertFloatToHalf.count = (size_t)count; \
+};
+// hipExtConvertFp8ToFloat[('const uint8_t*', 'src'), ('float*', 'dst'), ('size_t', 'count'), ('hipExtFp8Format_t', 'format')]
+#define INIT_hipExtConvertFp8ToFloat_CB_ARGS_DATA(cb_data) { \
+  cb_data.args.hipExtConvertFp8ToFloat.src = (const uint8_t*)src; \
+  cb_data.args.hipExtConvertFp8ToFloat.dst = (float*)dst; \
+  cb_data.args.hipExtConvertFp8ToFloat.count = (size_t)count; \
+  cb_data.args.hipExtConvertFp8ToFloat.format = (hipExtFp8Format_t)format; \
+};
+// hipExtConvertHalfToFloat[('const uint16_t*', 'src'), ('float*', 'dst'), ('size_t', 'count')]
+#define INIT_hipExtConvertHalfToFloat_CB_ARGS_DATA(cb_data) { \
+  cb_data.args.hipExtConvertHalfToFloat.src = (const uint16_t*)src; \
+  cb_data.args.hipExtConvertHalfToFloat.dst = (float*)dst; \
+  cb_data.args.hipExtConvertHalfToFloat.count = (size_t)count; \
+};
 // hipExtGetLastError[]
 #define INIT_hipExtGetLastError_CB_ARGS_DATA(cb_data) { \
 };
@@ -4126,6 +4261,22 @@ typedef struct hip_api_data_s {
   cb_data.args.hipExtMallocWithFlags.sizeBytes = (size_t)sizeBytes; \
   cb_data.args.hipExtMallocWithFlags.flags = (unsigned int)flags; \
 };
+// hipExtMemAdviseBatch[('const void* const*', 'dev_ptrs'), ('const size_t*', 'counts'), ('const hipMemoryAdvise*', 'advice'), ('const int*', 'devices'), ('size_t', 'num_ranges')]
+#define INIT_hipExtMemAdviseBatch_CB_ARGS_DATA(cb_data) { \
+  cb_data.args.hipExtMemAdviseBatch.dev_ptrs = (const void* const*)dev_ptrs; \
+  cb_data.args.hipExtMemAdviseBatch.counts = (const size_t*)counts; \
+  cb_data.args.hipExtMemAdviseBatch.advice = (const hipMemoryAdvise*)advice; \
+  cb_data.args.hipExtMemAdviseBatch.devices = (const int*)devices; \
+  cb_data.args.hipExtMemAdviseBatch.num_ranges = (size_t)num_ranges; \
+};
+// hipExtMemPrefetchBatchAsync[('const void* const*', 'dev_ptrs'), ('const size_t*', 'counts'), ('const int*', 'devices'), ('size_t', 'num_ranges'), ('hipStream_t', 'stream')]
+#define INIT_hipExtMemPrefetchBatchAsync_CB_ARGS_DATA(cb_data) { \
+  cb_data.args.hipExtMemPrefetchBatchAsync.dev_ptrs = (const void* const*)dev_ptrs; \
+  cb_data.args.hipExtMemPrefetchBatchAsync.counts = (const size_t*)counts; \
+  cb_data.args.hipExtMemPrefetchBatchAsync.devices = (const int*)devices; \
+  cb_data.args.hipExtMemPrefetchBatchAsync.num_ranges = (size_t)num_ranges; \
+  cb_data.args.hipExtMemPrefetchBatchAsync.stream = (hipStream_t)stream; \
+};
 // hipExtModuleLaunchKernel[('hipFunction_t', 'f'), ('unsigned int', 'globalWorkSizeX'), ('unsigned int', 'globalWorkSizeY'), ('unsigned int', 'globalWorkSizeZ'), ('unsigned int', 'localWorkSizeX'), ('unsigned int', 'localWorkSizeY'), ('unsigned int', 'localWorkSizeZ'), ('size_t', 'sharedMemBytes'), ('hipStream_t', 'hStream'), ('void**', 'kernelParams'), ('void**', 'extra'), ('hipEvent_t', 'startEvent'), ('hipEvent_t', 'stopEvent'), ('unsigned int', 'flags')]
 #define INIT_hipExtModuleLaunchKernel_CB_ARGS_DATA(cb_data) { \
   cb_data.args.hipExtModuleLaunchKernel.f = (hipFunction_t)f; \
@@ -6484,6 +6635,36 @@ static inline void hipApiArgsInit(hip_api_id_t id, hip_api_data_t* data) {
 // hipEventSynchronize[('hipEvent_t', 'event')]
     case HIP_API_ID_hipEventSynchronize:
       break;
+// hipExtConvertBf16ToFloat[('const uint16_t*', 'src'), ('float*', 'dst'), ('size_t', 'count')]
+    case HIP_API_ID_hipExtConvertBf16ToFloat:
+      if (data->args.hipExtConvertBf16ToFloat.src) data->args.hipExtConvertBf16ToFloat.src__val = *(data->args.hipExtConvertBf16ToFloat.src);
+      if (data->args.hipExtConvertBf16ToFloat.dst) data->args.hipExtConvertBf16ToFloat.dst__val = *(data->args.hipExtConvertBf16ToFloat.dst);
+      break;
+// hipExtConvertFloatToBf16[('const float*', 'src'), ('uint16_t*', 'dst'), ('size_t', 'count')]
+    case HIP_API_ID_hipExtConvertFloatToBf16:
+      if (data->args.hipExtConvertFloatToBf16.src) data->args.hipExtConvertFloatToBf16.src__val = *(data->args.hipExtConvertFloatToBf16.src);
+      if (data->args.hipExtConvertFloatToBf16.dst) data->args.hipExtConvertFloatToBf16.dst__val = *(data->args.hipExtConvertFloatToBf16.dst);
+      break;
+// hipExtConvertFloatToFp8[('const float*', 'src'), ('uint8_t*', 'dst'), ('size_t', 'count'), ('hipExtFp8Format_t', 'format'), ('int', 'saturate'), ('hipExtFp8Rounding_t', 'rounding'), ('unsigned int', 'seed')]
+    case HIP_API_ID_hipExtConvertFloatToFp8:
+      if (data->args.hipExtConvertFloatToFp8.src) data->args.hipExtConvertFloatToFp8.src__val = *(data->args.hipExtConvertFloatToFp8.src);
+      if (data->args.hipExtConvertFloatToFp8.dst) data->args.hipExtConvertFloatToFp8.dst__val = *(data->args.hipExtConvertFloatToFp8.dst);
+      break;
+// hipExtConvertFloatToHalf[('const float*', 'src'), ('uint16_t*', 'dst'), ('size_t', 'count')]
+    case HIP_API_ID_hipExtConvertFloatToHalf:
+      if (data->args.hipExtConvertFloatToHalf.src) data->args.hipExtConvertFloatToHalf.src__val = *(data->args.hipExtConvertFloatToHalf.src);
+      if (data->args.hipExtConvertFloatToHalf.dst) data->args.hipExtConvertFloatToHalf.dst__val = *(data->args.hipExtConvertFloatToHalf.dst);
+      break;
+// hipExtConvertFp8ToFloat[('const uint8_t*', 'src'), ('float*', 'dst'), ('size_t', 'count'), ('hipExtFp8Format_t', 'format')]
+    case HIP_API_ID_hipExtConvertFp8ToFloat:
+      if (data->args.hipExtConvertFp8ToFloat.src) data->args.hipExtConvertFp8ToFloat.src__val = *(data->args.hipExtConvertFp8ToFloat.src);
+      if (data->args.hipExtConvertFp8ToFloat.dst) data->args.hipExtConvertFp8ToFloat.dst__val = *(data->args.hipExtConvertFp8ToFloat.dst);
+      break;
+// hipExtConvertHalfToFloat[('const uint16_t*', 'src'), ('float*', 'dst'), ('size_t', 'count')]
+    case HIP_API_ID_hipExtConvertHalfToFloat:
+      if (data->args.hipExtConvertHalfToFloat.src) data->args.hipExtConvertHalfToFloat.src__val = *(data->args.hipExtConvertHalfToFloat.src);
+      if (data->args.hipExtConvertHalfToFloat.dst) data->args.hipExtConvertHalfToFloat.dst__val = *(data->args.hipExtConvertHalfToFloat.dst);
+      break;
 // hipExtGetLastError[]
     case HIP_API_ID_hipExtGetLastError:
       break;
@@ -6504,6 +6685,19 @@ static inline void hipApiArgsInit(hip_api_id_t id, hip_api_data_t* data) {
     case HIP_API_ID_hipExtMallocWithFlags:
       if (data->args.hipExtMallocWithFlags.ptr) data->args.hipExtMallocWithFlags.ptr__val = *(data->args.hipExtMallocWithFlags.ptr);
       break;
+// hipExtMemAdviseBatch[('const void* const*', 'dev_ptrs'), ('const size_t*', 'counts'), ('const hipMemoryAdvise*', 'advice'), ('const int*', 'devices'), ('size_t', 'num_ranges')]
+    case HIP_API_ID_hipExtMemAdviseBatch:
+      if (data->args.hipExtMemAdviseBatch.dev_ptrs) data->args.hipExtMemAdviseBatch.dev_ptrs__val = *(data->args.hipExtMemAdviseBatch.dev_ptrs);
+      if (data->args.hipExtMemAdviseBatch.counts) data->args.hipExtMemAdviseBatch.counts__val = *(data->args.hipExtMemAdviseBatch.counts);
+      if (data->args.hipExtMemAdviseBatch.advice) data->args.hipExtMemAdviseBatch.advice__val = *(data->args.hipExtMemAdviseBatch.advice);
+      if (data->args.hipExtMemAdviseBatch.devices) data->args.hipExtMemAdviseBatch.devices__val = *(data->args.hipExtMemAdviseBatch.devices);
+      break;
+// hipExtMemPrefetchBatchAsync[('const void* const*', 'dev_ptrs'), ('const size_t*', 'counts'), ('const int*', 'devices'), ('size_t', 'num_ranges'), ('hipStream_t', 'stream')]
+    case HIP_API_ID_hipExtMemPrefetchBatchAsync:
+      if (data->args.hipExtMemPrefetchBatchAsync.dev_ptrs) data->args.hipExtMemPrefetchBatchAsync.dev_ptrs__val = *(data->args.hipExtMemPrefetchBatchAsync.dev_ptrs);
+      if (data->args.hipExtMemPrefetchBatchAsync.counts) data->args.hipExtMemPrefetchBatchAsync.counts__val = *(data->args.hipExtMemPrefetchBatchAsync.counts);
+      if (data->args.hipExtMemPrefetchBatchAsync.devices) data->args.hipExtMemPrefetchBatchAsync.devices__val = *(data->args.hipExtMemPrefetchBatchAsync.devices);
+      break;
 // hipExtModuleLaunchKernel[('hipFunction_t', 'f'), ('unsigned int', 'globalWorkSizeX'), ('unsigned int', 'globalWorkSizeY'), ('unsigned int', 'globalWorkSizeZ'), ('unsigned int', 'localWorkSizeX'), ('unsigned int', 'localWorkSizeY'), ('unsigned int', 'localWorkSizeZ'), ('size_t', 'sharedMemBytes'), ('hipStream_t', 'hStream'), ('void**', 'kernelParams'), ('void**', 'extra'), ('hipEvent_t', 'startEvent'), ('hipEvent_t', 'stopEvent'), ('unsigned int', 'flags')]
     case HIP_API_ID_hipExtModuleLaunchKernel:
       if (data->args.hipExtModuleLaunchKernel.kernelParams) data->args.hipExtModuleLaunchKernel.kernelParams__val = *(data->args.hipExtModuleLaunchKernel.kernelParams);
@@ -8316,6 +8510,65 @@ static inline const char* hipApiString(hip_api_id_t id, const hip_api_data_t* da
       oss << "event="; roctracer::hip_support::detail::operator<<(oss, data->args.hipEventSynchronize.event);
       oss << ")";
     break;
+    case HIP_API_ID_hipExtConvertBf16ToFloat:
+      oss << "hipExtConvertBf16ToFloat(";
+      if (data->args.hipExtConvertBf16ToFloat.src == NULL) oss << "src=NULL";
+      else { oss << "src="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertBf16ToFloat.src__val); }
+      if (data->args.hipExtConvertBf16ToFloat.dst == NULL) oss << ", dst=NULL";
+      else { oss << ", dst="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertBf16ToFloat.dst__val); }
+      oss << ", count="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertBf16ToFloat.count);
+      oss << ")";
+    break;
+    case HIP_API_ID_hipExtConvertFloatToBf16:
+      oss << "hipExtConvertFloatToBf16(";
+      if (data->args.hipExtConvertFloatToBf16.src == NULL) oss << "src=NULL";
+      else { oss << "src="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFloatToBf16.src__val); }
+      if (data->args.hipExtConvertFloatToBf16.dst == NULL) oss << ", dst=NULL";
+      else { oss << ", dst="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFloatToBf16.dst__val); }
+      oss << ", count="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFloatToBf16.count);
+      oss << ")";
+    break;
+    case HIP_API_ID_hipExtConvertFloatToFp8:
+      oss << "hipExtConvertFloatToFp8(";
+      if (data->args.hipExtConvertFloatToFp8.src == NULL) oss << "src=NULL";
+      else { oss << "src="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFloatToFp8.src__val); }
+      if (data->args.hipExtConvertFloatToFp8.dst == NULL) oss << ", dst=NULL";
+      else { oss << ", dst="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFloatToFp8.dst__val); }
+      oss << ", count="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFloatToFp8.count);
+      oss << ", format="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFloatToFp8.format);
+      oss << ", saturate="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFloatToFp8.saturate);
+      oss << ", rounding="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFloatToFp8.rounding);
+      oss << ", seed="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFloatToFp8.seed);
+      oss << ")";
+    break;
+    case HIP_API_ID_hipExtConvertFloatToHalf:
+      oss << "hipExtConvertFloatToHalf(";
+      if (data->args.hipExtConvertFloatToHalf.src == NULL) oss << "src=NULL";
+      else { oss << "src="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFloatToHalf.src__val); }
+      if (data->args.hipExtConvertFloatToHalf.dst == NULL) oss << ", dst=NULL";
+      else { oss << ", dst="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFloatToHalf.dst__val); }
+      oss << ", count="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFloatToHalf.count);
+      oss << ")";
+    break;
+    case HIP_API_ID_hipExtConvertFp8ToFloat:
+      oss << "hipExtConvertFp8ToFloat(";
+      if (data->args.hipExtConvertFp8ToFloat.src == NULL) oss << "src=NULL";
+      else { oss << "src="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFp8ToFloat.src__val); }
+      if (data->args.hipExtConvertFp8ToFloat.dst == NULL) oss << ", dst=NULL";
+      else { oss << ", dst="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFp8ToFloat.dst__val); }
+      oss << ", count="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFp8ToFloat.count);
+      oss << ", format="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertFp8ToFloat.format);
+      oss << ")";
+    break;
+    case HIP_API_ID_hipExtConvertHalfToFloat:
+      oss << "hipExtConvertHalfToFloat(";
+      if (data->args.hipExtConvertHalfToFloat.src == NULL) oss << "src=NULL";
+      else { oss << "src="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertHalfToFloat.src__val); }
+      if (data->args.hipExtConvertHalfToFloat.dst == NULL) oss << ", dst=NULL";
+      else { oss << ", dst="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertHalfToFloat.dst__val); }
+      oss << ", count="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtConvertHalfToFloat.count);
+      oss << ")";
+    break;
     case HIP_API_ID_hipExtGetLastError:
       oss << "hipExtGetLastError(";
       oss << ")";
@@ -8360,6 +8613,31 @@ static inline const char* hipApiString(hip_api_id_t id, const hip_api_data_t* da
       oss << ", flags="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtMallocWithFlags.flags);
       oss << ")";
     break;
+    case HIP_API_ID_hipExtMemAdviseBatch:
+      oss << "hipExtMemAdviseBatch(";
+      if (data->args.hipExtMemAdviseBatch.dev_ptrs == NULL) oss << "dev_ptrs=NULL";
+      else { oss << "dev_ptrs="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtMemAdviseBatch.dev_ptrs__val); }
+      if (data->args.hipExtMemAdviseBatch.counts == NULL) oss << ", counts=NULL";
+      else { oss << ", counts="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtMemAdviseBatch.counts__val); }
+      if (data->args.hipExtMemAdviseBatch.advice == NULL) oss << ", advice=NULL";
+      else { oss << ", advice="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtMemAdviseBatch.advice__val); }
+      if (data->args.hipExtMemAdviseBatch.devices == NULL) oss << ", devices=NULL";
+      else { oss << ", devices="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtMemAdviseBatch.devices__val); }
+      oss << ", num_ranges="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtMemAdviseBatch.num_ranges);
+      oss << ")";
+    break;
+    case HIP_API_ID_hipExtMemPrefetchBatchAsync:
+      oss << "hipExtMemPrefetchBatchAsync(";
+      if (data->args.hipExtMemPrefetchBatchAsync.dev_ptrs == NULL) oss << "dev_ptrs=NULL";
+      else { oss << "dev_ptrs="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtMemPrefetchBatchAsync.dev_ptrs__val); }
+      if (data->args.hipExtMemPrefetchBatchAsync.counts == NULL) oss << ", counts=NULL";
+      else { oss << ", counts="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtMemPrefetchBatchAsync.counts__val); }
+      if (data->args.hipExtMemPrefetchBatchAsync.devices == NULL) oss << ", devices=NULL";
+      else { oss << ", devices="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtMemPrefetchBatchAsync.devices__val); }
+      oss << ", num_ranges="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtMemPrefetchBatchAsync.num_ranges);
+      oss << ", stream="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtMemPrefetchBatchAsync.stream);
+      oss << ")";
+    break;
     case HIP_API_ID_hipExtModuleLaunchKernel:
       oss << "hipExtModuleLaunchKernel(";
       oss << "f="; roctracer::hip_support::detail::operator<<(oss, data->args.hipExtModuleLaunchKernel.f);
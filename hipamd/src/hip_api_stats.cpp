@@ -0,0 +1,277 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#include <hip/hip_runtime.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "hip_internal.hpp"
+#include "hip_api_stats.hpp"
+
+namespace hip {
+namespace {
+
+//! Global list of the thread shards
+struct ShardRegistry {
+  amd::Monitor lock_{};
+  std::vector<ApiStats::Shard*> shards_;  //!< All shards, which were ever created
+  std::vector<ApiStats::Shard*> free_;    //!< Shards of exited threads, available for reuse
+  std::atomic<uint64_t> next_dump_{0};    //!< Time of the next periodic dump
+};
+
+// The registry is never destroyed, since threads can exit after the static destructors
+ShardRegistry& Registry() {
+  static ShardRegistry* registry = new ShardRegistry();
+  return *registry;
+}
+
+//! Returns the shard to the registry on thread exit
+struct ShardHolder {
+  ApiStats::Shard* shard_ = nullptr;
+  ~ShardHolder() {
+    if (shard_ != nullptr) {
+      amd::ScopedLock lock(Registry().lock_);
+      Registry().free_.push_back(shard_);
+    }
+  }
+};
+thread_local ShardHolder tls_shard;
+
+//! Prints the statistics at process exit
+struct ApiStatsExitDump {
+  ~ApiStatsExitDump() {
+    if (HIP_API_STATS && (HIP_API_STATS_DUMP != nullptr) && (HIP_API_STATS_DUMP[0] != '\0')) {
+      ApiStats::Dump("exit");
+    }
+  }
+} api_stats_exit_dump;
+
+//! Returns the upper bound of the bucket, which contains the requested percentile
+uint64_t Percentile(const hipApiStats_t& stats, double percentile) {
+  uint64_t target = static_cast<uint64_t>(stats.callCount * percentile);
+  uint64_t count = 0;
+  for (uint32_t i = 0; i < ApiStats::kHistogramBuckets; ++i) {
+    count += stats.histogram[i];
+    if (count > target) {
+      return std::min(uint64_t(1) << (i + 1), stats.maxNs);
+    }
+  }
+  return stats.maxNs;
+}
+
+}  // namespace
+
+// ================================================================================================
+ApiStats::Shard::~Shard() {
+  for (auto& counters : counters_) {
+    delete counters.load(std::memory_order_relaxed);
+  }
+}
+
+// ================================================================================================
+ApiStats::Shard* ApiStats::GetShard() {
+  if (tls_shard.shard_ == nullptr) {
+    ShardRegistry& registry = Registry();
+    amd::ScopedLock lock(registry.lock_);
+    if (!registry.free_.empty()) {
+      tls_shard.shard_ = registry.free_.back();
+      registry.free_.pop_back();
+    } else {
+      tls_shard.shard_ = new Shard();
+      registry.shards_.push_back(tls_shard.shard_);
+    }
+  }
+  return tls_shard.shard_;
+}
+
+// ================================================================================================
+void ApiStats::Record(uint32_t api_id, uint64_t duration_ns, hipError_t status) {
+  Shard* shard = GetShard();
+  Counters* counters = shard->counters_[api_id].load(std::memory_order_relaxed);
+  if (counters == nullptr) {
+    counters = new Counters();
+    // Release the zeroed counters to the readers of the shard
+    shard->counters_[api_id].store(counters, std::memory_order_release);
+  }
+  counters->calls_.fetch_add(1, std::memory_order_relaxed);
+  counters->total_ns_.fetch_add(duration_ns, std::memory_order_relaxed);
+  counters->histogram_[Bucket(duration_ns)].fetch_add(1, std::memory_order_relaxed);
+  // Only the owner thread updates the maximum, so a plain compare is enough
+  if (duration_ns > counters->max_ns_.load(std::memory_order_relaxed)) {
+    counters->max_ns_.store(duration_ns, std::memory_order_relaxed);
+  }
+  if ((status != hipSuccess) && (status != hipErrorNotReady)) {
+    counters->errors_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+// ================================================================================================
+void ApiStats::Snapshot(std::vector<hipApiStats_t>& stats) {
+  std::vector<hipApiStats_t> merged(kNumApis);
+  std::memset(merged.data(), 0, sizeof(hipApiStats_t) * merged.size());
+  {
+    ShardRegistry& registry = Registry();
+    amd::ScopedLock lock(registry.lock_);
+    for (auto shard : registry.shards_) {
+      for (uint32_t id = 0; id < kNumApis; ++id) {
+        Counters* counters = shard->counters_[id].load(std::memory_order_acquire);
+        if (counters == nullptr) {
+          continue;
+        }
+        hipApiStats_t& entry = merged[id];
+        entry.callCount += counters->calls_.load(std::memory_order_relaxed);
+        entry.errorCount += counters->errors_.load(std::memory_order_relaxed);
+        entry.totalNs += counters->total_ns_.load(std::memory_order_relaxed);
+        entry.maxNs = std::max(entry.maxNs, counters->max_ns_.load(std::memory_order_relaxed));
+        for (uint32_t i = 0; i < kHistogramBuckets; ++i) {
+          entry.histogram[i] += counters->histogram_[i].load(std::memory_order_relaxed);
+        }
+      }
+    }
+  }
+  stats.clear();
+  for (uint32_t id = 0; id < kNumApis; ++id) {
+    if (merged[id].callCount != 0) {
+      merged[id].apiId = id;
+      merged[id].apiName = hip_api_name(id);
+      stats.push_back(merged[id]);
+    }
+  }
+}
+
+// ================================================================================================
+void ApiStats::Reset() {
+  ShardRegistry& registry = Registry();
+  amd::ScopedLock lock(registry.lock_);
+  // Counters are cleared under the threads, hence a call in flight may be partially accounted
+  for (auto shard : registry.shards_) {
+    for (auto& entry : shard->counters_) {
+      Counters* counters = entry.load(std::memory_order_acquire);
+      if (counters == nullptr) {
+        continue;
+      }
+      counters->calls_.store(0, std::memory_order_relaxed);
+      counters->errors_.store(0, std::memory_order_relaxed);
+      counters->total_ns_.store(0, std::memory_order_relaxed);
+      counters->max_ns_.store(0, std::memory_order_relaxed);
+      for (auto& bucket : counters->histogram_) {
+        bucket.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+}
+
+// ================================================================================================
+void ApiStats::Dump(const char* reason) {
+  if ((HIP_API_STATS_DUMP == nullptr) || (HIP_API_STATS_DUMP[0] == '\0')) {
+    return;
+  }
+  std::vector<hipApiStats_t> stats;
+  Snapshot(stats);
+  // Report the most expensive APIs first
+  std::sort(stats.begin(), stats.end(), [](const hipApiStats_t& a, const hipApiStats_t& b) {
+    return a.totalNs > b.totalNs;
+  });
+
+  FILE* out = nullptr;
+  bool close = false;
+  if (strcmp(HIP_API_STATS_DUMP, "stderr") == 0) {
+    out = stderr;
+  } else if (strcmp(HIP_API_STATS_DUMP, "stdout") == 0) {
+    out = stdout;
+  } else {
+    out = fopen(HIP_API_STATS_DUMP, "a");
+    close = true;
+  }
+  if (out == nullptr) {
+    return;
+  }
+  fprintf(out, "HIP API statistics (%s), pid %d\n", reason, amd::Os::getProcessId());
+  fprintf(out, "%-40s %12s %10s %14s %10s %10s %10s %10s\n", "API", "Calls", "Errors",
+          "Total(us)", "Avg(us)", "P50(us)", "P99(us)", "Max(us)");
+  for (const auto& entry : stats) {
+    fprintf(out, "%-40s %12llu %10llu %14.1f %10.2f %10.2f %10.2f %10.2f\n", entry.apiName,
+            static_cast<unsigned long long>(entry.callCount),
+            static_cast<unsigned long long>(entry.errorCount), entry.totalNs / 1000.0,
+            entry.totalNs / 1000.0 / entry.callCount, Percentile(entry, 0.5) / 1000.0,
+            Percentile(entry, 0.99) / 1000.0, entry.maxNs / 1000.0);
+  }
+  fflush(out);
+  if (close) {
+    fclose(out);
+  }
+}
+
+// ================================================================================================
+void ApiStats::CheckPeriodicDump(uint64_t now) {
+  const uint64_t interval = static_cast<uint64_t>(HIP_API_STATS_DUMP_INTERVAL) * 1000 * 1000;
+  ShardRegistry& registry = Registry();
+  uint64_t next = registry.next_dump_.load(std::memory_order_relaxed);
+  if (next == 0) {
+    // The first call starts the interval
+    registry.next_dump_.compare_exchange_strong(next, now + interval, std::memory_order_relaxed);
+    return;
+  }
+  // Only the thread, which moved the deadline, prints the statistics
+  if ((now >= next) &&
+      registry.next_dump_.compare_exchange_strong(next, now + interval,
+                                                  std::memory_order_relaxed)) {
+    Dump("periodic");
+  }
+}
+
+// ================================================================================================
+void ApiStatsScope::Begin() {
+  hip::tls.api_status_ = hipSuccess;
+  start_ = amd::Os::timeNanos();
+}
+
+// ================================================================================================
+void ApiStatsScope::End() {
+  uint64_t end = amd::Os::timeNanos();
+  ApiStats::Record(api_id_, end - start_, hip::tls.api_status_);
+  if (HIP_API_STATS_DUMP_INTERVAL != 0) {
+    ApiStats::CheckPeriodicDump(end);
+  }
+}
+
+// ================================================================================================
+hipError_t hipExtGetApiStats(hipApiStats_t* stats, size_t* count) {
+  if (count == nullptr || (stats == nullptr && *count != 0)) {
+    return hipErrorInvalidValue;
+  }
+  std::vector<hipApiStats_t> merged;
+  ApiStats::Snapshot(merged);
+  size_t copy_count = std::min(*count, merged.size());
+  if (copy_count != 0) {
+    std::memcpy(stats, merged.data(), sizeof(hipApiStats_t) * copy_count);
+  }
+  *count = merged.size();
+  return hipSuccess;
+}
+
+// ================================================================================================
+hipError_t hipExtResetApiStats(void) {
+  ApiStats::Reset();
+  return hipSuccess;
+}
+
+}  // namespace hip
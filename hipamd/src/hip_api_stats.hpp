@@ -0,0 +1,112 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#ifndef HIP_SRC_HIP_API_STATS_H
+#define HIP_SRC_HIP_API_STATS_H
+
+#include <atomic>
+#include <vector>
+
+#include "hip/amd_detail/amd_hip_api_stats.h"
+#include "hip/amd_detail/hip_prof_str.h"
+#include "utils/flags.hpp"
+
+namespace hip {
+
+//! Per API call statistics. Every thread updates its own shard of counters without locks,
+//! the shards are merged on demand for the query API and the dumps.
+class ApiStats {
+ public:
+  static constexpr uint32_t kHistogramBuckets = HIP_API_STATS_HISTOGRAM_BUCKETS;
+  static constexpr uint32_t kNumApis = HIP_API_ID_LAST + 1;
+
+  //! Counters of a single API in a single thread
+  struct Counters {
+    std::atomic<uint64_t> calls_{0};
+    std::atomic<uint64_t> errors_{0};
+    std::atomic<uint64_t> total_ns_{0};
+    std::atomic<uint64_t> max_ns_{0};
+    std::atomic<uint64_t> histogram_[kHistogramBuckets] = {};
+  };
+
+  //! Thread shard. Counters are allocated on the first call of the API in the thread.
+  //! The shard is recycled by a new thread after the owner exits, hence the totals are preserved
+  struct Shard {
+    std::atomic<Counters*> counters_[kNumApis] = {};
+    ~Shard();
+  };
+
+  //! Records a single call of the API
+  static void Record(uint32_t api_id, uint64_t duration_ns, hipError_t status);
+
+  //! Merges all thread shards into the list of APIs with at least one call
+  static void Snapshot(std::vector<hipApiStats_t>& stats);
+
+  //! Clears all counters
+  static void Reset();
+
+  //! Prints the merged statistics into the HIP_API_STATS_DUMP destination
+  static void Dump(const char* reason);
+
+  //! Returns the log2 histogram bucket for the duration
+  static uint32_t Bucket(uint64_t duration_ns) {
+    uint32_t bucket = 0;
+    while ((duration_ns >>= 1) != 0) {
+      bucket++;
+    }
+    return (bucket < kHistogramBuckets) ? bucket : (kHistogramBuckets - 1);
+  }
+
+ private:
+  //! Returns the shard of the current thread
+  static Shard* GetShard();
+  //! Performs a periodic dump if the interval has expired
+  static void CheckPeriodicDump(uint64_t now);
+};
+
+//! Measures the latency of the HIP API scope and records it on exit
+class ApiStatsScope {
+ public:
+  explicit ApiStatsScope(uint32_t api_id) : api_id_(api_id) {
+    if (HIP_API_STATS && (api_id != HIP_API_ID_NONE)) {
+      Begin();
+    }
+  }
+  ~ApiStatsScope() {
+    if (start_ != 0) {
+      End();
+    }
+  }
+
+ private:
+  void Begin();
+  void End();
+
+  uint32_t api_id_;      //!< HIP API ID
+  uint64_t start_ = 0;   //!< Start time of the API call
+};
+
+}  // namespace hip
+
+// HIP API statistics object macro
+#define HIP_API_STATS_OBJECT(operation_id)                                                         \
+  hip::ApiStatsScope __api_stats(HIP_API_ID_##operation_id);
+
+#endif  // HIP_SRC_HIP_API_STATS_H
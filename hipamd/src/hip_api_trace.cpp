@@ -814,6 +814,23 @@ hipError_t hipGraphBatchMemOpNodeSetParams(hipGraphNode_t hNode,
 hipError_t hipGraphExecBatchMemOpNodeSetParams(hipGraphExec_t hGraphExec, hipGraphNode_t hNode,
                                                const hipBatchMemOpNodeParams* nodeParams);
 hipError_t hipEventRecordWithFlags(hipEvent_t event, hipStream_t stream, unsigned flags);
+hipError_t hipExtMemPrefetchBatchAsync(const void* const* dev_ptrs, const size_t* counts,
+                                       const int* devices, size_t num_ranges,
+                                       hipStream_t stream);
+hipError_t hipExtMemAdviseBatch(const void* const* dev_ptrs, const size_t* counts,
+                                const hipMemoryAdvise* advice, const int* devices,
+                                size_t num_ranges);
+hipError_t hipExtGetApiStats(hipApiStats_t* stats, size_t* count);
+hipError_t hipExtResetApiStats(void);
+hipError_t hipExtConvertFloatToFp8(const float* src, uint8_t* dst, size_t count,
+                                   hipExtFp8Format_t format, int saturate,
+                                   hipExtFp8Rounding_t rounding, uint32_t seed);
+hipError_t hipExtConvertFp8ToFloat(const uint8_t* src, float* dst, size_t count,
+                                   hipExtFp8Format_t format);
+hipError_t hipExtConvertFloatToBf16(const float* src, uint16_t* dst, size_t count);
+hipError_t hipExtConvertBf16ToFloat(const uint16_t* src, float* dst, size_t count);
+hipError_t hipExtConvertFloatToHalf(const float* src, uint16_t* dst, size_t count);
+hipError_t hipExtConvertHalfToFloat(const uint16_t* src, float* dst, size_t count);
 }  // namespace hip
 
 namespace hip {
@@ -1321,6 +1338,16 @@ void UpdateDispatchTable(HipDispatchTable* ptrDispatchTable) {
   ptrDispatchTable->hipGraphExecBatchMemOpNodeSetParams_fn =
       hip::hipGraphExecBatchMemOpNodeSetParams;
   ptrDispatchTable->hipEventRecordWithFlags_fn = hip::hipEventRecordWithFlags;
+  ptrDispatchTable->hipExtMemPrefetchBatchAsync_fn = hip::hipExtMemPrefetchBatchAsync;
+  ptrDispatchTable->hipExtMemAdviseBatch_fn = hip::hipExtMemAdviseBatch;
+  ptrDispatchTable->hipExtGetApiStats_fn = hip::hipExtGetApiStats;
+  ptrDispatchTable->hipExtResetApiStats_fn = hip::hipExtResetApiStats;
+  ptrDispatchTable->hipExtConvertFloatToFp8_fn = hip::hipExtConvertFloatToFp8;
+  ptrDispatchTable->hipExtConvertFp8ToFloat_fn = hip::hipExtConvertFp8ToFloat;
+  ptrDispatchTable->hipExtConvertFloatToBf16_fn = hip::hipExtConvertFloatToBf16;
+  ptrDispatchTable->hipExtConvertBf16ToFloat_fn = hip::hipExtConvertBf16ToFloat;
+  ptrDispatchTable->hipExtConvertFloatToHalf_fn = hip::hipExtConvertFloatToHalf;
+  ptrDispatchTable->hipExtConvertHalfToFloat_fn = hip::hipExtConvertHalfToFloat;
 }
 
 #if HIP_ROCPROFILER_REGISTER > 0
@@ -1952,15 +1979,28 @@ HIP_ENFORCE_ABI(HipDispatchTable, hipGraphBatchMemOpNodeSetParams_fn, 466);
 HIP_ENFORCE_ABI(HipDispatchTable, hipGraphExecBatchMemOpNodeSetParams_fn, 467);
 // HIP_RUNTIME_API_TABLE_STEP_VERSION == 9
 HIP_ENFORCE_ABI(HipDispatchTable, hipEventRecordWithFlags_fn, 468)
+// HIP_RUNTIME_API_TABLE_STEP_VERSION == 10
+HIP_ENFORCE_ABI(HipDispatchTable, hipExtMemPrefetchBatchAsync_fn, 469)
+HIP_ENFORCE_ABI(HipDispatchTable, hipExtMemAdviseBatch_fn, 470)
+// HIP_RUNTIME_API_TABLE_STEP_VERSION == 11
+HIP_ENFORCE_ABI(HipDispatchTable, hipExtGetApiStats_fn, 471)
+HIP_ENFORCE_ABI(HipDispatchTable, hipExtResetApiStats_fn, 472)
+// HIP_RUNTIME_API_TABLE_STEP_VERSION == 12
+HIP_ENFORCE_ABI(HipDispatchTable, hipExtConvertFloatToFp8_fn, 473)
+HIP_ENFORCE_ABI(HipDispatchTable, hipExtConvertFp8ToFloat_fn, 474)
+HIP_ENFORCE_ABI(HipDispatchTable, hipExtConvertFloatToBf16_fn, 475)
+HIP_ENFORCE_ABI(HipDispatchTable, hipExtConvertBf16ToFloat_fn, 476)
+HIP_ENFORCE_ABI(HipDispatchTable, hipExtConvertFloatToHalf_fn, 477)
+HIP_ENFORCE_ABI(HipDispatchTable, hipExtConvertHalfToFloat_fn, 478)
 // if HIP_ENFORCE_ABI entries are added for each new function pointer in the table, the number below
 // will be +1 of the number in the last HIP_ENFORCE_ABI line. E.g.:
 //
 //  HIP_ENFORCE_ABI(<table>, <functor>, 8)
 //
 //  HIP_ENFORCE_ABI_VERSIONING(<table>, 9) <- 8 + 1 = 9
-HIP_ENFORCE_ABI_VERSIONING(HipDispatchTable, 469)
+HIP_ENFORCE_ABI_VERSIONING(HipDispatchTable, 479)
 
-static_assert(HIP_RUNTIME_API_TABLE_MAJOR_VERSION == 0 && HIP_RUNTIME_API_TABLE_STEP_VERSION == 9,
+static_assert(HIP_RUNTIME_API_TABLE_MAJOR_VERSION == 0 && HIP_RUNTIME_API_TABLE_STEP_VERSION == 12,
               "If you get this error, add new HIP_ENFORCE_ABI(...) code for the new function "
               "pointers and then update this check so it is true");
 #endif
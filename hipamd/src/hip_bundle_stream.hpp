@@ -0,0 +1,320 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#ifndef HIP_SRC_HIP_BUNDLE_STREAM_H
+#define HIP_SRC_HIP_BUNDLE_STREAM_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hip {
+
+//! Compression methods of a compressed offload bundle
+constexpr uint16_t kBundleCompressionZlib = 0;
+constexpr uint16_t kBundleCompressionZstd = 1;
+
+//! Header of a compressed offload bundle (CCOB). Version 1 has no total size, version 2 has
+//! 32 bit sizes and version 3 has 64 bit sizes. The payload is the compressed uncompressed
+//! bundle, including its index.
+struct CompressedBundleInfo {
+  uint16_t version_;            //!< Format version
+  uint16_t method_;             //!< Compression method
+  uint64_t totalSize_;          //!< Size of the header and the payload
+  uint64_t uncompressedSize_;   //!< Size of the uncompressed bundle
+  uint64_t hash_;               //!< Hash of the uncompressed bundle
+  const char* payload_;         //!< Compressed data
+  size_t payloadSize_;          //!< Size of the compressed data
+};
+
+//! Parses the header of a compressed offload bundle. The size of the data is 0 if unknown,
+//! in that case the version 1 bundles can't be parsed
+inline bool ParseCompressedBundle(const void* data, size_t size, CompressedBundleInfo* info) {
+  const char* bytes = static_cast<const char*>(data);
+  if ((size != 0 && size < 8) || memcmp(bytes, "CCOB", 4) != 0) {
+    return false;
+  }
+  memcpy(&info->version_, bytes + 4, sizeof(info->version_));
+  memcpy(&info->method_, bytes + 6, sizeof(info->method_));
+
+  // The header size depends on the version, check it before the fields are read
+  static constexpr size_t kHeaderSize[] = {20, 24, 32};
+  if ((info->version_ < 1) || (info->version_ > 3)) {
+    return false;
+  }
+  const size_t header_size = kHeaderSize[info->version_ - 1];
+  if (size != 0 && size < header_size) {
+    return false;
+  }
+
+  uint32_t size32 = 0;
+  switch (info->version_) {
+    case 1:
+      memcpy(&size32, bytes + 8, sizeof(size32));
+      info->uncompressedSize_ = size32;
+      memcpy(&info->hash_, bytes + 12, sizeof(info->hash_));
+      info->totalSize_ = size;
+      break;
+    case 2:
+      memcpy(&size32, bytes + 8, sizeof(size32));
+      info->totalSize_ = size32;
+      memcpy(&size32, bytes + 12, sizeof(size32));
+      info->uncompressedSize_ = size32;
+      memcpy(&info->hash_, bytes + 16, sizeof(info->hash_));
+      break;
+    case 3:
+      memcpy(&info->totalSize_, bytes + 8, sizeof(info->totalSize_));
+      memcpy(&info->uncompressedSize_, bytes + 16, sizeof(info->uncompressedSize_));
+      memcpy(&info->hash_, bytes + 24, sizeof(info->hash_));
+      break;
+    default:
+      return false;
+  }
+  if ((info->totalSize_ <= header_size) || (size != 0 && info->totalSize_ > size)) {
+    return false;
+  }
+  info->payload_ = bytes + header_size;
+  info->payloadSize_ = info->totalSize_ - header_size;
+  return true;
+}
+
+//! Entry of the index of an uncompressed offload bundle
+struct BundleEntry {
+  uint64_t offset_;          //!< Offset of the code object in the bundle
+  uint64_t size_;            //!< Size of the code object
+  std::string id_;           //!< Bundle entry ID, i.e. hipv4-amdgcn-amd-amdhsa--gfx942
+  bool selected_ = false;    //!< The selector wants this code object
+  char* data_ = nullptr;     //!< Extracted code object, allocated with new[]
+};
+
+//! Extracts code objects from an uncompressed offload bundle, which arrives in order as a
+//! stream of chunks, i.e. from a decompressor. The index at the start of the bundle is parsed
+//! first and the selector marks the needed entries. Only those are copied into their final
+//! buffers, the rest of the stream is dropped. Done() reports the end of the last selected
+//! entry, so the producer can stop without decompressing the tail of the bundle.
+class BundleStream {
+ public:
+  typedef std::function<void(std::vector<BundleEntry>&)> Selector;
+
+  //! The uncompressed size validates the index, 0 if unknown
+  BundleStream(Selector selector, uint64_t size)
+      : selector_(std::move(selector)), size_(size) {}
+
+  ~BundleStream() {
+    for (auto& entry : entries_) {
+      delete[] entry.data_;
+    }
+  }
+
+  //! Consumes the next chunk of the bundle. Returns false if the bundle is malformed
+  bool Consume(const char* data, size_t size) {
+    if (failed_) {
+      return false;
+    }
+    uint64_t start = position_;
+    position_ += size;
+    if (indexed_) {
+      Copy(start, data, size);
+      return true;
+    }
+    // Keep the chunks until the whole index is available
+    index_.append(data, size);
+    int status = ParseIndex();
+    if (status < 0) {
+      failed_ = true;
+      return false;
+    }
+    if (status > 0) {
+      Copy(0, index_.data(), index_.size());
+      std::string().swap(index_);
+    }
+    return true;
+  }
+
+  //! Returns true if all selected entries are complete
+  bool Done() const { return indexed_ && (position_ >= end_); }
+
+  //! Returns the parsed index, empty until the index is complete
+  const std::vector<BundleEntry>& Entries() const { return entries_; }
+
+  //! Transfers the buffer of an extracted entry to the caller
+  char* Release(size_t idx) {
+    char* data = entries_[idx].data_;
+    entries_[idx].data_ = nullptr;
+    return data;
+  }
+
+  //! Returns the number of the consumed bytes of the uncompressed bundle
+  uint64_t Position() const { return position_; }
+
+  //! Returns the number of the bytes in the extracted buffers
+  uint64_t Extracted() const { return extracted_; }
+
+ private:
+  static constexpr char kMagic[] = "__CLANG_OFFLOAD_BUNDLE__";
+  static constexpr size_t kMagicSize = sizeof(kMagic) - 1;
+  static constexpr uint64_t kMaxEntries = 4096;    //!< Limit of the malformed index
+  static constexpr uint64_t kMaxIdSize = 4096;     //!< Limit of the malformed entry ID
+
+  //! Parses the index. Returns 1 if done, 0 if more data is needed and -1 on error
+  int ParseIndex() {
+    if (index_.size() < kMagicSize + sizeof(uint64_t)) {
+      return 0;
+    }
+    if (memcmp(index_.data(), kMagic, kMagicSize) != 0) {
+      return -1;
+    }
+    uint64_t count = 0;
+    memcpy(&count, index_.data() + kMagicSize, sizeof(count));
+    if ((count == 0) || (count > kMaxEntries)) {
+      return -1;
+    }
+
+    std::vector<BundleEntry> entries(count);
+    size_t pos = kMagicSize + sizeof(count);
+    for (auto& entry : entries) {
+      uint64_t id_size = 0;
+      if (index_.size() < pos + 3 * sizeof(uint64_t)) {
+        return 0;
+      }
+      memcpy(&entry.offset_, index_.data() + pos, sizeof(uint64_t));
+      memcpy(&entry.size_, index_.data() + pos + sizeof(uint64_t), sizeof(uint64_t));
+      memcpy(&id_size, index_.data() + pos + 2 * sizeof(uint64_t), sizeof(uint64_t));
+      pos += 3 * sizeof(uint64_t);
+      if (id_size > kMaxIdSize) {
+        return -1;
+      }
+      if (index_.size() < pos + id_size) {
+        return 0;
+      }
+      entry.id_.assign(index_.data() + pos, id_size);
+      pos += id_size;
+      if ((entry.offset_ + entry.size_ < entry.offset_) ||
+          ((size_ != 0) && (entry.offset_ + entry.size_ > size_))) {
+        return -1;
+      }
+    }
+
+    entries_ = std::move(entries);
+    indexed_ = true;
+    selector_(entries_);
+    for (auto& entry : entries_) {
+      if (!entry.selected_ || (entry.size_ == 0)) {
+        continue;
+      }
+      // A code object can't overlap the index
+      if (entry.offset_ < pos) {
+        return -1;
+      }
+      entry.data_ = new char[entry.size_];
+      extracted_ += entry.size_;
+      end_ = std::max(end_, entry.offset_ + entry.size_);
+    }
+    return 1;
+  }
+
+  //! Copies the part of the chunk, which belongs to the selected entries
+  void Copy(uint64_t start, const char* data, size_t size) {
+    uint64_t end = start + size;
+    for (auto& entry : entries_) {
+      if (entry.data_ == nullptr) {
+        continue;
+      }
+      uint64_t lo = std::max(start, entry.offset_);
+      uint64_t hi = std::min(end, entry.offset_ + entry.size_);
+      if (lo < hi) {
+        memcpy(entry.data_ + (lo - entry.offset_), data + (lo - start), hi - lo);
+      }
+    }
+  }
+
+  Selector selector_;                 //!< Marks the needed entries of the index
+  uint64_t size_;                     //!< Size of the uncompressed bundle, 0 if unknown
+  std::string index_;                 //!< Buffered chunks until the index is complete
+  std::vector<BundleEntry> entries_;  //!< Parsed index
+  bool indexed_ = false;              //!< The index was parsed
+  bool failed_ = false;               //!< The bundle is malformed
+  uint64_t position_ = 0;             //!< Consumed bytes of the bundle
+  uint64_t end_ = 0;                  //!< End of the last selected entry
+  uint64_t extracted_ = 0;            //!< Total size of the selected entries
+};
+
+//! Streaming zstd decompression. The runtime doesn't link zstd, the entry points are loaded
+//! from the system library. The buffers match ZSTD_inBuffer and ZSTD_outBuffer of zstd.h.
+struct ZstdInBuffer {
+  const void* src;
+  size_t size;
+  size_t pos;
+};
+
+struct ZstdOutBuffer {
+  void* dst;
+  size_t size;
+  size_t pos;
+};
+
+struct ZstdStreamApi {
+  void* (*createDStream)();
+  size_t (*freeDStream)(void* stream);
+  size_t (*initDStream)(void* stream);
+  size_t (*decompressStream)(void* stream, ZstdOutBuffer* output, ZstdInBuffer* input);
+  unsigned (*isError)(size_t code);
+  size_t (*dStreamOutSize)();
+};
+
+//! Decompresses a zstd payload chunk by chunk into the bundle stream and stops as soon as
+//! the selected entries are complete. Returns false on an error or a truncated bundle
+inline bool ZstdDecompress(const ZstdStreamApi& api, const void* src, size_t size,
+                           BundleStream& stream) {
+  void* dstream = api.createDStream();
+  if (dstream == nullptr) {
+    return false;
+  }
+  bool ok = !api.isError(api.initDStream(dstream));
+  std::vector<char> chunk(api.dStreamOutSize());
+  ZstdInBuffer input = {src, size, 0};
+  while (ok && !stream.Done()) {
+    ZstdOutBuffer output = {chunk.data(), chunk.size(), 0};
+    size_t ret = api.decompressStream(dstream, &output, &input);
+    if (api.isError(ret)) {
+      ok = false;
+      break;
+    }
+    if (output.pos != 0) {
+      ok = stream.Consume(chunk.data(), output.pos);
+    }
+    // The bundle is a single frame. Its end or a stall without input means the bundle is
+    // complete or truncated, which Done() tells apart
+    if ((ret == 0) || ((output.pos == 0) && (input.pos == input.size))) {
+      break;
+    }
+  }
+  api.freeDStream(dstream);
+  return ok && stream.Done();
+}
+
+}  // namespace hip
+
+#endif  // HIP_SRC_HIP_BUNDLE_STREAM_H
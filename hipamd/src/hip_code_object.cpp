@@ -20,9 +20,11 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 THE SOFTWARE.
 */
 #include "hip_code_object.hpp"
+#include "hip_bundle_stream.hpp"
 #include "amd_hsa_elf.hpp"
 
 #include <cstring>
+#include <limits>
 
 #include <hip/driver_types.h>
 #include "hip/hip_runtime_api.h"
@@ -726,6 +728,143 @@ hipError_t CodeObject::extractCodeObjectFromFatBinary(
   }
 }
 
+// ================================================================================================
+// Loads the streaming zstd decompression from the system library on the first use
+static const ZstdStreamApi* getZstdStreamApi() {
+  static const ZstdStreamApi* api = []() -> const ZstdStreamApi* {
+    static ZstdStreamApi table = {};
+    void* handle = amd::Os::loadLibrary(WINDOWS_SWITCH("zstd.dll", "libzstd.so.1"));
+    if (handle == nullptr) {
+      ClPrint(amd::LOG_INFO, amd::LOG_CODE, "Cannot load zstd, compressed bundles use comgr");
+      return nullptr;
+    }
+    table.createDStream = reinterpret_cast<decltype(table.createDStream)>(
+        amd::Os::getSymbol(handle, "ZSTD_createDStream"));
+    table.freeDStream = reinterpret_cast<decltype(table.freeDStream)>(
+        amd::Os::getSymbol(handle, "ZSTD_freeDStream"));
+    table.initDStream = reinterpret_cast<decltype(table.initDStream)>(
+        amd::Os::getSymbol(handle, "ZSTD_initDStream"));
+    table.decompressStream = reinterpret_cast<decltype(table.decompressStream)>(
+        amd::Os::getSymbol(handle, "ZSTD_decompressStream"));
+    table.isError = reinterpret_cast<decltype(table.isError)>(
+        amd::Os::getSymbol(handle, "ZSTD_isError"));
+    table.dStreamOutSize = reinterpret_cast<decltype(table.dStreamOutSize)>(
+        amd::Os::getSymbol(handle, "ZSTD_DStreamOutSize"));
+    if ((table.createDStream == nullptr) || (table.freeDStream == nullptr) ||
+        (table.initDStream == nullptr) || (table.decompressStream == nullptr) ||
+        (table.isError == nullptr) || (table.dStreamOutSize == nullptr)) {
+      ClPrint(amd::LOG_INFO, amd::LOG_CODE, "Missing zstd streaming API, compressed bundles "
+              "use comgr");
+      amd::Os::unloadLibrary(handle);
+      return nullptr;
+    }
+    return &table;
+  }();
+  return api;
+}
+
+// ================================================================================================
+// Extracts the code objects of the devices from a compressed bundle. The bundle is decompressed
+// as a stream: its index picks the code objects of the devices, only those are kept in their
+// final buffers and the decompression stops after the last of them. Devices of the same
+// target ID share the code object. Returns hipErrorNotSupported for the bundles, which need
+// comgr: zlib, version 1, the legacy hip/hcc entries or no zstd library.
+static hipError_t extractCodeObjectFromCompressedBundle(
+    const void* data, size_t size, const std::vector<std::string>& agent_triple_target_ids,
+    std::vector<std::pair<const void*, size_t>>& code_objs) {
+  CompressedBundleInfo info;
+  if (!ParseCompressedBundle(data, size, &info) || (info.version_ < 2) ||
+      (info.method_ != kBundleCompressionZstd)) {
+    return hipErrorNotSupported;
+  }
+  const ZstdStreamApi* api = getZstdStreamApi();
+  if (api == nullptr) {
+    return hipErrorNotSupported;
+  }
+
+  const size_t num_devices = agent_triple_target_ids.size();
+  constexpr size_t kNoEntry = std::numeric_limits<size_t>::max();
+  std::vector<size_t> selection(num_devices, kNoEntry);
+  bool legacy = false;
+  auto selector = [&](std::vector<BundleEntry>& entries) {
+    static const std::string hipv4 = kOffloadKindHipv4_;
+    for (size_t i = 0; i < entries.size(); ++i) {
+      if (entries[i].id_.compare(0, hipv4.size(), hipv4) != 0) {
+        // The target of the legacy entries is in the ELF, which isn't decompressed yet
+        std::string entry_id = entries[i].id_;
+        std::string offload_kind = trimName(entry_id, '-');
+        legacy |= (offload_kind == kOffloadKindHip) || (offload_kind == kOffloadKindHcc);
+        continue;
+      }
+      std::string co_triple_target_id;
+      if ((entries[i].size_ == 0) ||
+          !getTripleTargetID(entries[i].id_, nullptr, co_triple_target_id)) {
+        continue;
+      }
+      // The generic code objects are named after the generic processor
+      uint32_t genericVersion = (co_triple_target_id.find("-generic") != std::string::npos) ?
+          EF_AMDGPU_GENERIC_VERSION_MIN : 0;
+      for (size_t dev = 0; dev < num_devices; ++dev) {
+        size_t found = selection[dev];
+        if ((found != kNoEntry) && ((genericVersion != 0) ||
+            (entries[found].id_.find("-generic") == std::string::npos))) {
+          continue;  // Keep the specific target or the first generic one
+        }
+        if (isCodeObjectCompatibleWithDevice(co_triple_target_id, agent_triple_target_ids[dev],
+                                             genericVersion)) {
+          selection[dev] = i;
+        }
+      }
+    }
+    if (legacy) {
+      return;
+    }
+    for (auto idx : selection) {
+      if (idx != kNoEntry) {
+        entries[idx].selected_ = true;
+      }
+    }
+  };
+
+  uint64_t start = amd::Os::timeNanos();
+  BundleStream stream(selector, info.uncompressedSize_);
+  if (!ZstdDecompress(*api, info.payload_, info.payloadSize_, stream)) {
+    LogPrintfError("Streaming decompression of the compressed bundle %p failed at %llu of "
+                   "%llu bytes", data, static_cast<unsigned long long>(stream.Position()),
+                   static_cast<unsigned long long>(info.uncompressedSize_));
+    return hipErrorNotSupported;
+  }
+  if (legacy) {
+    return hipErrorNotSupported;
+  }
+
+  code_objs.assign(num_devices, std::make_pair(nullptr, 0));
+  std::vector<char*> images(stream.Entries().size(), nullptr);
+  size_t num_code_objs = num_devices;
+  for (size_t dev = 0; dev < num_devices; ++dev) {
+    size_t idx = selection[dev];
+    if (idx == kNoEntry) {
+      LogPrintfError("Cannot find CO in the compressed bundle %p for ISA: %s", data,
+                     agent_triple_target_ids[dev].c_str());
+      continue;
+    }
+    // itemData should be deleted in fatbin's destructor
+    if (images[idx] == nullptr) {
+      images[idx] = stream.Release(idx);
+    }
+    code_objs[dev] = std::make_pair(images[idx], stream.Entries()[idx].size_);
+    --num_code_objs;
+  }
+  ClPrint(amd::LOG_INFO, amd::LOG_CODE,
+          "Compressed bundle %p: extracted %llu bytes, decompressed %llu of %llu bytes in %llu us",
+          data, static_cast<unsigned long long>(stream.Extracted()),
+          static_cast<unsigned long long>(stream.Position()),
+          static_cast<unsigned long long>(info.uncompressedSize_),
+          static_cast<unsigned long long>((amd::Os::timeNanos() - start) / 1000));
+
+  return (num_code_objs == 0) ? hipSuccess : hipErrorNoBinaryForGpu;
+}
+
 // ================================================================================================
 size_t CodeObject::getFatbinSize(const void* data, const bool isCompressed) {
   if (isCompressed) {
@@ -761,6 +900,16 @@ hipError_t CodeObject::extractCodeObjectFromFatBinaryUsingComgr(
 
   if (size == 0) size = getFatbinSize(data, isCompressed);
 
+  if (isCompressed && DEBUG_HIP_STREAM_DECOMPRESS) {
+    hipStatus = extractCodeObjectFromCompressedBundle(data, size, agent_triple_target_ids,
+                                                      code_objs);
+    if (hipStatus != hipErrorNotSupported) {
+      return hipStatus;
+    }
+    code_objs.clear();
+    hipStatus = hipSuccess;
+  }
+
   amd_comgr_data_t dataCodeObj{0};
   amd_comgr_data_set_t dataSetBundled{0};
   amd_comgr_data_set_t dataSetUnbundled{0};
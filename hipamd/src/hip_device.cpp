@@ -22,6 +22,7 @@
 #include <hip/hip_deprecated.h>
 
 #include "hip_internal.hpp"
+#include "hip_event.hpp"
 #include "hip_mempool_impl.hpp"
 #include "hip_platform.hpp"
 
@@ -67,6 +68,11 @@ bool Device::Create() {
     return false;
   }
 
+  // The event pool outlives a device reset, since the app may still hold events
+  if ((DEBUG_HIP_EVENT_POOL_SIZE != 0) && (event_pool_ == nullptr)) {
+    event_pool_ = new EventPool();
+  }
+
   if (!HIP_MEM_POOL_USE_VM) {
     uint64_t max_size = std::numeric_limits<uint64_t>::max();
     // Use maximum value to hold memory, because current implementation doesn't support VM
@@ -155,6 +161,8 @@ void Device::Reset() {
   }
   flags_ = hipDeviceScheduleSpin;
   destroyAllStreams();
+  // The cached IPC mappings are purged with the device memory, so the cache must forget them
+  devices()[0]->IpcCachePurge();
   amd::MemObjMap::Purge(devices()[0]);
   Create();
 }
@@ -253,9 +261,86 @@ void Device::destroyAllStreams() {
   for (auto& it : toBeDeleted) {
     hip::Stream::Destroy(it);
   }
+  DestroyStreamPool();
   hip::tls.stream_per_thread_obj_.clear_spt();
 }
 
+// ================================================================================================
+Stream* Device::AcquirePooledStream(Stream::Priority priority, unsigned int flags) {
+  if (DEBUG_HIP_STREAM_POOL_SIZE == 0) {
+    return nullptr;
+  }
+  Stream* stream = nullptr;
+  {
+    amd::ScopedLock lock(lock_);
+    // The most recently destroyed stream first, its resources are likely still in the caches
+    for (auto it = stream_pool_.rbegin(); it != stream_pool_.rend(); ++it) {
+      if ((*it)->GetPriority() == priority) {
+        stream = *it;
+        stream_pool_.erase(std::next(it).base());
+        break;
+      }
+    }
+    if (stream == nullptr) {
+      ++stream_pool_misses_;
+      return nullptr;
+    }
+    ++stream_pool_hits_;
+  }
+  // The parked stream gets a HW queue with the same selection as a new stream
+  if (!stream->vdev()->UnparkQueue()) {
+    Stream::Destroy(stream);
+    return nullptr;
+  }
+  stream->Reuse(flags);
+  return stream;
+}
+
+// ================================================================================================
+bool Device::RecycleStream(Stream* stream) {
+  // CU masked queues aren't shared with other streams, hence they aren't worth keeping
+  if ((DEBUG_HIP_STREAM_POOL_SIZE == 0) || stream->Null() || (stream->vdev() == nullptr) ||
+      !stream->GetCUMask().empty()) {
+    return false;
+  }
+  {
+    amd::ScopedLock lock(lock_);
+    if (stream_pool_.size() >= DEBUG_HIP_STREAM_POOL_SIZE) {
+      return false;
+    }
+  }
+  // The handle is invalid from now on, the same as after the destruction
+  RemoveStream(stream);
+  RemoveStreamFromPools(stream);
+  // Drain the queue, the same wait as the queue termination does
+  stream->finish(true);
+  {
+    // An idle stream must not count as a user of the HW queue, since the queue selection and
+    // the rebalancing pick the queues with the fewest users
+    amd::ScopedLock lock(stream->vdev()->execution());
+    stream->vdev()->ParkQueue();
+  }
+
+  amd::ScopedLock lock(lock_);
+  if (stream_pool_.size() >= DEBUG_HIP_STREAM_POOL_SIZE) {
+    return false;
+  }
+  stream_pool_.push_back(stream);
+  return true;
+}
+
+// ================================================================================================
+void Device::DestroyStreamPool() {
+  std::vector<Stream*> streams;
+  {
+    amd::ScopedLock lock(lock_);
+    streams.swap(stream_pool_);
+  }
+  for (auto stream : streams) {
+    Stream::Destroy(stream);
+  }
+}
+
 // ================================================================================================
 void Device::SyncAllStreams(bool cpu_wait, bool wait_blocking_streams_only) {
   // Make a local copy to avoid stalls for GPU finish with multiple threads
@@ -315,6 +400,12 @@ bool Device::existsActiveStreamForDevice() {
 
 // ================================================================================================
 Device::~Device() {
+  DestroyStreamPool();
+  devices()[0]->IpcCachePurge();
+  ClPrint(amd::LOG_INFO, amd::LOG_API, "Stream pool: %llu hits, %llu misses",
+          static_cast<unsigned long long>(stream_pool_hits_),
+          static_cast<unsigned long long>(stream_pool_misses_));
+
   if ((IS_LINUX || !DEBUG_HIP_MEM_POOL_VMHEAP) && (default_mem_pool_ != nullptr)) {
     default_mem_pool_->release();
   }
@@ -326,6 +417,7 @@ Device::~Device() {
   if (null_stream_ != nullptr) {
     hip::Stream::Destroy(null_stream_);
   }
+  delete event_pool_;
 }
 
 void ihipDestroyDevice() {
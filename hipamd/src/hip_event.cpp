@@ -276,6 +276,68 @@ bool isValid(hipEvent_t event) {
   return true;
 }
 
+// ================================================================================================
+EventPool::~EventPool() {
+  Event* event = reinterpret_cast<Event*>(head_.load() & kPointerMask);
+  while (event != nullptr) {
+    Event* next = event->pool_next_.load(std::memory_order_relaxed);
+    delete event;
+    event = next;
+  }
+  ClPrint(amd::LOG_INFO, amd::LOG_API, "Event pool: %llu hits, %llu misses, %u events",
+          static_cast<unsigned long long>(Hits()), static_cast<unsigned long long>(Misses()),
+          adopted_.load());
+}
+
+// ================================================================================================
+Event* EventPool::Acquire(uint32_t flags, int device_id) {
+  uint64_t head = head_.load(std::memory_order_acquire);
+  Event* event = nullptr;
+  do {
+    event = reinterpret_cast<Event*>(head & kPointerMask);
+    if (event == nullptr) {
+      misses_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    // A new tag makes the head different even if the same event returns to the top
+    uint64_t tag = (head & ~kPointerMask) + (uint64_t{1} << kTagShift);
+    uint64_t next =
+        reinterpret_cast<uint64_t>(event->pool_next_.load(std::memory_order_relaxed)) | tag;
+    if (head_.compare_exchange_weak(head, next, std::memory_order_acquire,
+                                    std::memory_order_acquire)) {
+      break;
+    }
+  } while (true);
+  hits_.fetch_add(1, std::memory_order_relaxed);
+  event->Reset(flags, device_id);
+  return event;
+}
+
+// ================================================================================================
+bool EventPool::Recycle(Event* event) {
+  if (!event->pooled_) {
+    uint32_t adopted = adopted_.load(std::memory_order_relaxed);
+    do {
+      if (adopted >= DEBUG_HIP_EVENT_POOL_SIZE) {
+        return false;
+      }
+    } while (!adopted_.compare_exchange_weak(adopted, adopted + 1, std::memory_order_relaxed));
+    event->pooled_ = true;
+  }
+  // Drop the last recorded command now, so an idle event doesn't hold its profiling signal
+  event->Reset(event->flags_, event->deviceId());
+
+  uint64_t head = head_.load(std::memory_order_relaxed);
+  uint64_t top = reinterpret_cast<uint64_t>(event);
+  assert(((top & ~kPointerMask) == 0) && "Event address doesn't fit the tagged pointer");
+  do {
+    event->pool_next_.store(reinterpret_cast<Event*>(head & kPointerMask),
+                            std::memory_order_relaxed);
+  } while (!head_.compare_exchange_weak(head, top | (head & ~kPointerMask),
+                                        std::memory_order_release, std::memory_order_relaxed));
+  return true;
+}
+
 // ================================================================================================
 hipError_t ihipEventCreateWithFlags(hipEvent_t* event, unsigned flags) {
   unsigned supportedFlags = hipEventDefault | hipEventBlockingSync | hipEventDisableTiming |
@@ -297,8 +359,12 @@ hipError_t ihipEventCreateWithFlags(hipEvent_t* event, unsigned flags) {
                             ((flags & hipEventInterprocess) && !(flags & hipEventDisableTiming));
   if (!illegalFlags) {
     hip::Event* e = nullptr;
+    int device_id = hip::getCurrentDevice()->deviceId();
+    EventPool* pool = g_devices[device_id]->GetEventPool();
     if (flags & hipEventInterprocess) {
       e = new hip::IPCEvent();
+    } else if ((pool != nullptr) && ((e = pool->Acquire(flags, device_id)) != nullptr)) {
+      // The event was reused from the pool
     } else {
       if (AMD_DIRECT_DISPATCH) {
         e = new hip::EventDD(flags);
@@ -363,7 +429,11 @@ hipError_t hipEventDestroy(hipEvent_t event) {
       reinterpret_cast<hip::Stream*>(e->GetCaptureStream())->EraseCaptureEvent(event);
     }
   }
-  delete e;
+  // IPC events own the shared memory, so they are never cached
+  EventPool* pool = g_devices[e->deviceId()]->GetEventPool();
+  if ((e->flags_ & hipEventInterprocess) || (pool == nullptr) || !pool->Recycle(e)) {
+    delete e;
+  }
   HIP_RETURN(hipSuccess);
 }
 
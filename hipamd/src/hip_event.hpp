@@ -23,6 +23,7 @@
 
 #include "hip_internal.hpp"
 #include "thread/monitor.hpp"
+#include "thread/sharedwait.hpp"
 
 // Internal structure for stream callback handler
 namespace hip {
@@ -69,6 +70,9 @@ void CL_CALLBACK ihipStreamCallback(cl_event event, cl_int command_exec_status,
 
 
 #define IPC_SIGNALS_PER_EVENT 32
+// Layout version of the IPC event shared memory. The fields are only appended, so a runtime
+// without them reads 0 in the zero filled tail of the mapping
+#define IPC_EVENT_SHMEM_VERSION 1
 typedef struct ihipIpcEventShmem_s {
   std::atomic<int> owners;
   std::atomic<int> owners_device_id;
@@ -76,6 +80,8 @@ typedef struct ihipIpcEventShmem_s {
   std::atomic<int> read_index;
   std::atomic<int> write_index;
   uint32_t signal[IPC_SIGNALS_PER_EVENT];
+  amd::SharedWaitWord wait_word;  // Wakes the waiters on signal completion or read_index update
+  std::atomic<uint32_t> version;  // IPC_EVENT_SHMEM_VERSION, 0 if a process doesn't wake
 } ihipIpcEventShmem_t;
 
 class EventMarker : public amd::Marker {
@@ -163,11 +169,61 @@ class Event {
   virtual bool ready();
   virtual int64_t time(bool getStartTs) const;
 
+  /// Returns the event to the created state for a reuse from the event pool
+  void Reset(uint32_t flags, int device_id) {
+    if (event_ != nullptr) {
+      event_->release();
+      event_ = nullptr;
+    }
+    stream_ = nullptr;
+    captureStream_ = nullptr;
+    nodesPrevToRecorded_.clear();
+    flags_ = flags;
+    device_id_ = device_id;
+  }
+
  protected:
   amd::Monitor lock_;
   hip::Stream* stream_;
   amd::Event* event_;
   int device_id_;
+
+ private:
+  friend class EventPool;
+  std::atomic<Event*> pool_next_{nullptr};  //!< The next free event in the event pool
+  bool pooled_ = false;                     //!< The event belongs to the event pool
+};
+
+/// Per device cache of destroyed events. hipEventCreate() and hipEventDestroy() become
+/// a pop and a push on a lock free list instead of an allocation and a free.
+/// @note: The pool never frees an adopted event before the pool itself is destroyed, so a
+/// thread, which lost a race on the list head, can still read the next pointer of the event
+class EventPool {
+ public:
+  EventPool() = default;
+  ~EventPool();
+
+  /// Returns a cached event in the created state or nullptr if the pool is empty
+  Event* Acquire(uint32_t flags, int device_id);
+
+  /// Returns true if the pool took the destroyed event, otherwise the caller must delete it
+  bool Recycle(Event* event);
+
+  /// Returns the number of events, reused from the pool
+  uint64_t Hits() const { return hits_.load(std::memory_order_relaxed); }
+
+  /// Returns the number of event creations, which missed the pool
+  uint64_t Misses() const { return misses_.load(std::memory_order_relaxed); }
+
+ private:
+  //! The list head is a pointer with a pop counter in the unused upper bits against ABA
+  static constexpr uint32_t kTagShift = 48;
+  static constexpr uint64_t kPointerMask = (uint64_t{1} << kTagShift) - 1;
+
+  std::atomic<uint64_t> head_{0};      //!< Tagged top of the free list
+  std::atomic<uint32_t> adopted_{0};   //!< Number of events, owned by the pool
+  std::atomic<uint64_t> hits_{0};      //!< Creations, served from the pool
+  std::atomic<uint64_t> misses_{0};    //!< Creations, which allocated a new event
 };
 
 class EventDD : public Event {
@@ -190,6 +246,10 @@ class IPCEvent : public Event {
     void setipcname(const char* name) { ipc_name_ = std::string(name); }
   };
   ihipIpcEvent_t ipc_evt_;
+  std::atomic<uint32_t> pending_wakes_{0};  //!< Wake callbacks, which access ipc_shmem_
+
+  //! Enqueues a host callback, which wakes the waiters after the signal write in the stream
+  hipError_t enqueueWake(hipStream_t stream);
 
  public:
   ~IPCEvent() {
@@ -197,6 +257,10 @@ class IPCEvent : public Event {
       int owners = --ipc_evt_.ipc_shmem_->owners;
       // Make sure event is synchronized
       hipError_t status = synchronize();
+      // The shared memory can't be unmapped under the wake callbacks
+      while (pending_wakes_.load(std::memory_order_acquire) != 0) {
+        amd::Os::yield();
+      }
       status  = ihipHostUnregister(&ipc_evt_.ipc_shmem_->signal);
       if (!amd::Os::MemoryUnmapFile(ipc_evt_.ipc_shmem_, sizeof(hip::ihipIpcEventShmem_t))) {
         // print hipErrorInvalidHandle;
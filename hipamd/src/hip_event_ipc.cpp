@@ -32,6 +32,39 @@ namespace hip {
 
 hipError_t ihipEventCreateWithFlags(hipEvent_t* event, unsigned flags);
 
+namespace {
+
+//! Wake callback data
+struct IpcWakeData {
+  ihipIpcEventShmem_t* shmem_;         //!< Shared memory of the event
+  std::atomic<uint32_t>* pending_;     //!< Pending wakes of the event
+};
+
+// ================================================================================================
+void CL_CALLBACK IpcEventWakeCallback(cl_event event, cl_int command_exec_status,
+                                      void* user_data) {
+  IpcWakeData* data = reinterpret_cast<IpcWakeData*>(user_data);
+  data->shmem_->wait_word.Wake();
+  data->pending_->fetch_sub(1, std::memory_order_release);
+  delete data;
+}
+
+//! Waits on the shared memory of the event until the condition is satisfied
+template <typename Done>
+void WaitShmem(ihipIpcEventShmem_t* shmem, Done done) {
+  // A runtime with the older layout neither wakes the waiters nor keeps the version. It also
+  // truncates the mapping to the older size, which clears the version, so everyone polls then
+  if (shmem->version.load(std::memory_order_relaxed) != IPC_EVENT_SHMEM_VERSION) {
+    while (!done()) {
+      amd::Os::sleep(1);
+    }
+    return;
+  }
+  shmem->wait_word.Wait(done, static_cast<uint64_t>(DEBUG_CLR_SHARED_WAIT_SPIN) * 1000);
+}
+
+}  // namespace
+
 bool IPCEvent::createIpcEventShmemIfNeeded() {
   if (ipc_evt_.ipc_shmem_) {
     // ipc_shmem_ already created, no need to create it again
@@ -64,6 +97,8 @@ bool IPCEvent::createIpcEventShmemIfNeeded() {
   for (uint32_t sig_idx = 0; sig_idx < IPC_SIGNALS_PER_EVENT; ++sig_idx) {
     ipc_evt_.ipc_shmem_->signal[sig_idx] = 0;
   }
+  ipc_evt_.ipc_shmem_->wait_word.Init();
+  ipc_evt_.ipc_shmem_->version = IPC_EVENT_SHMEM_VERSION;
 
   // device sets 0 to this ptr when the ipc event is completed
   hipError_t status = ihipHostRegister(&ipc_evt_.ipc_shmem_->signal,
@@ -88,14 +123,16 @@ hipError_t IPCEvent::query() {
 }
 
 hipError_t IPCEvent::synchronize() {
-  if (ipc_evt_.ipc_shmem_) {
-    int prev_read_idx = ipc_evt_.ipc_shmem_->read_index;
+  ihipIpcEventShmem_t* shmem = ipc_evt_.ipc_shmem_;
+  if (shmem) {
+    int prev_read_idx = shmem->read_index;
     if (prev_read_idx >= 0) {
       int offset = (prev_read_idx % IPC_SIGNALS_PER_EVENT);
-      while ((ipc_evt_.ipc_shmem_->read_index < prev_read_idx + IPC_SIGNALS_PER_EVENT) &&
-             (ipc_evt_.ipc_shmem_->signal[offset] != 0)) {
-        amd::Os::sleep(1);
-      }
+      // The wake callback of the recording process unblocks the wait after the signal write
+      WaitShmem(shmem, [&]() {
+        return (shmem->read_index >= prev_read_idx + IPC_SIGNALS_PER_EVENT) ||
+               (__atomic_load_n(&shmem->signal[offset], __ATOMIC_ACQUIRE) == 0);
+      });
     }
   }
   return hipSuccess;
@@ -123,14 +160,16 @@ hipError_t IPCEvent::enqueueRecordCommand(hipStream_t stream, amd::Command* comm
 
   amd::Event& tEvent = command->event();
   createIpcEventShmemIfNeeded();
-  int write_index = ipc_evt_.ipc_shmem_->write_index++;
+  ihipIpcEventShmem_t* shmem = ipc_evt_.ipc_shmem_;
+  int write_index = shmem->write_index++;
   int offset = write_index % IPC_SIGNALS_PER_EVENT;
-  while (ipc_evt_.ipc_shmem_->signal[offset] != 0) {
-    amd::Os::sleep(1);
-  }
+  // Wait for the completion of the previous record, which used the same slot
+  WaitShmem(shmem, [&]() {
+    return __atomic_load_n(&shmem->signal[offset], __ATOMIC_ACQUIRE) == 0;
+  });
   // Lock signal.
-  ipc_evt_.ipc_shmem_->signal[offset] = 1;
-  ipc_evt_.ipc_shmem_->owners_device_id = deviceId();
+  shmem->signal[offset] = 1;
+  shmem->owners_device_id = deviceId();
   command->enqueue();
 
   // device writes 0 to signal after the hipEventRecord command is completed
@@ -142,13 +181,46 @@ hipError_t IPCEvent::enqueueRecordCommand(hipStream_t stream, amd::Command* comm
   if (status != hipSuccess) {
     return status;
   }
+  status = enqueueWake(stream);
+  if (status != hipSuccess) {
+    return status;
+  }
+
+  // Update read index to indicate new signal. The records publish in the order of write_index,
+  // so wait for the previous record and only this record can advance the index
+  WaitShmem(shmem, [&]() { return shmem->read_index == write_index - 1; });
+  shmem->read_index = write_index;
+  shmem->wait_word.Wake();
+  return hipSuccess;
+}
 
-  // Update read index to indicate new signal.
-  int expected = write_index - 1;
-  while (!ipc_evt_.ipc_shmem_->read_index.compare_exchange_weak(expected, write_index)) {
-    amd::Os::sleep(1);
+// ================================================================================================
+hipError_t IPCEvent::enqueueWake(hipStream_t stream) {
+  hip::Stream* hip_stream = hip::getStream(stream);
+  amd::Command* last_command = hip_stream->getLastQueuedCommand(true);
+  amd::Command::EventWaitList eventWaitList;
+  if (last_command != nullptr) {
+    eventWaitList.push_back(last_command);
+  }
+  amd::Command* command = new amd::Marker(*hip_stream, !kMarkerDisableFlush, eventWaitList);
+  IpcWakeData* data = new IpcWakeData{ipc_evt_.ipc_shmem_, &pending_wakes_};
+  pending_wakes_.fetch_add(1, std::memory_order_relaxed);
+  if (!command->setCallback(CL_COMPLETE, IpcEventWakeCallback, data)) {
+    pending_wakes_.fetch_sub(1, std::memory_order_relaxed);
+    delete data;
+    command->release();
+    if (last_command != nullptr) {
+      last_command->release();
+    }
+    return hipErrorOutOfMemory;
+  }
+  command->enqueue();
+  // The stream doesn't wait for the callback, but the queue must process it
+  command->notifyCmdQueue();
+  command->release();
+  if (last_command != nullptr) {
+    last_command->release();
   }
-  
   return hipSuccess;
 }
 
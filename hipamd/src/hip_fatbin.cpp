@@ -22,6 +22,9 @@ THE SOFTWARE.
 
 #include "hip_fatbin.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <unordered_map>
 #include "hip_code_object.hpp"
 #include "hip_platform.hpp"
@@ -726,6 +729,93 @@ hipError_t FatBinaryInfo::BuildProgram(const int device_id) {
   return hipSuccess;
 }
 
+// ================================================================================================
+//! Worker of the parallel program builds. The build takes the runtime locks, which expect
+//! the calling thread to be registered as amd::Thread, so a bare std::thread can't be used
+class ProgramBuildThread : public amd::Thread {
+ public:
+  explicit ProgramBuildThread(const std::function<void()>& work)
+      : amd::Thread("Program Build Thread"), work_(work) {}
+
+  //! Waits for the end of run(), the thread object can be deleted after it
+  void Wait() const {
+    while ((state() < amd::Thread::FINISHED) && amd::Os::isThreadAlive(*this)) {
+      amd::Os::yield();
+    }
+  }
+
+ private:
+  virtual void run(void* data) { work_(); }
+
+  const std::function<void()>& work_;  //!< Shared work loop of all build threads
+};
+
+// ================================================================================================
+hipError_t FatBinaryInfo::BuildPrograms(const std::vector<hip::Device*>& devices) {
+  amd::ScopedLock lock(FatBinaryLock());
+
+  // The programs of different devices are independent, so only the unbuilt ones are
+  // distributed across the worker threads. Devices without a code object are left to
+  // the per device lookup, which reports the error
+  std::vector<int> pending;
+  pending.reserve(devices.size());
+  for (auto device : devices) {
+    int device_id = device->deviceId();
+    DeviceIdCheck(device_id);
+    FatBinaryDeviceInfo* fbd_info = fatbin_dev_info_[device_id];
+    if ((fbd_info != nullptr) && !fbd_info->prog_built_) {
+      pending.push_back(device_id);
+    }
+  }
+
+  size_t num_threads = pending.size();
+  if (DEBUG_HIP_MODULE_BUILD_THREADS != 0) {
+    num_threads = std::min(num_threads, static_cast<size_t>(DEBUG_HIP_MODULE_BUILD_THREADS));
+  }
+  if (num_threads <= 1) {
+    for (auto device_id : pending) {
+      IHIP_RETURN_ONFAIL(BuildProgram(device_id));
+    }
+    return hipSuccess;
+  }
+
+  std::vector<hipError_t> status(pending.size(), hipSuccess);
+  std::atomic<size_t> next{0};
+  std::function<void()> worker = [&]() {
+    for (size_t idx = next++; idx < pending.size(); idx = next++) {
+      status[idx] = BuildProgram(pending[idx]);
+    }
+  };
+  // The calling thread builds too, since it holds the fat binary lock anyway. If a thread
+  // can't start, the remaining threads pick up its share
+  std::vector<ProgramBuildThread*> threads;
+  threads.reserve(num_threads - 1);
+  for (size_t i = 1; i < num_threads; ++i) {
+    auto thread = new ProgramBuildThread(worker);
+    if (!thread->start()) {
+      delete thread;
+      continue;
+    }
+    threads.push_back(thread);
+  }
+  worker();
+  for (auto thread : threads) {
+    thread->Wait();
+    delete thread;
+  }
+
+  for (size_t idx = 0; idx < pending.size(); ++idx) {
+    if (status[idx] != hipSuccess) {
+      LogPrintfError("Program build failed for device %d with error %d", pending[idx],
+                     status[idx]);
+      return status[idx];
+    }
+  }
+  ClPrint(amd::LOG_INFO, amd::LOG_CODE, "Built %zu device programs with %zu threads",
+          pending.size(), num_threads);
+  return hipSuccess;
+}
+
 // ================================================================================================
 hipError_t FatBinaryInfo::ExtractFatBinaryUsingCOMGR(const void* data,
                                                      const std::vector<hip::Device*>& devices) {
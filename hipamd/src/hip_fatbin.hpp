@@ -85,6 +85,8 @@ public:
   hipError_t ExtractFatBinary(const std::vector<hip::Device*>& devices);
   hipError_t AddDevProgram(const int device_id);
   hipError_t BuildProgram(const int device_id);
+  //! Builds the programs of the devices in parallel, up to DEBUG_HIP_MODULE_BUILD_THREADS
+  hipError_t BuildPrograms(const std::vector<hip::Device*>& devices);
 
   // Device Id bounds check
   inline void DeviceIdCheck(const int device_id) const {
@@ -0,0 +1,847 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+
+#include <hip/hip_runtime.h>
+#include <algorithm>
+
+#include "hip/amd_detail/amd_hip_fp_convert.h"
+#include "hip_internal.hpp"
+#include "top.hpp"
+#include "utils/flags.hpp"
+
+#if defined(ATI_ARCH_X86) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define HIP_FP_CONVERT_X86 1
+#define HIP_FP_CONVERT_TARGET(isa) __attribute__((target(isa)))
+#else
+#define HIP_FP_CONVERT_X86 0
+#endif
+
+namespace hip {
+namespace {
+
+//! Instruction set of the bulk conversions
+enum class ConvertIsa : uint32_t { kScalar = 1, kAvx2 = 2, kAvx512 = 3 };
+
+// ================================================================================================
+ConvertIsa GetConvertIsa() {
+  static const ConvertIsa cpu_isa = []() {
+#if HIP_FP_CONVERT_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+      return ConvertIsa::kAvx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c")) {
+      return ConvertIsa::kAvx2;
+    }
+#endif
+    return ConvertIsa::kScalar;
+  }();
+  // The flag can only lower the detected instruction set
+  if (DEBUG_HIP_FP_CONVERT_ISA != 0) {
+    return std::min(cpu_isa, static_cast<ConvertIsa>(DEBUG_HIP_FP_CONVERT_ISA));
+  }
+  return cpu_isa;
+}
+
+//! Parameters of the float to fp8 conversion. The algorithm follows internal::cast_to_f8()
+//! for float: the magnitude is rounded at the fp8 mantissa width after the exponent is
+//! rebiased, the values below the smallest fp8 normal are rounded at the denormal position.
+struct Fp8Params {
+  uint32_t shift_;       //!< Dropped bits of the float mantissa, 23 - wm
+  uint32_t drop_mask_;   //!< Mask of the dropped bits
+  uint32_t rebias_;      //!< Difference of the float and fp8 exponent biases, << 23
+  uint32_t min_normal_;  //!< Float exponent field of the smallest fp8 normal
+  uint32_t max_bits_;    //!< Float bits of the largest finite fp8 value
+  bool fnuz_;            //!< FNUZ format, the negative zero encodes NaN
+  uint8_t inf_[2];       //!< Result for +/-Inf
+  uint8_t nan_[2];       //!< Result for +/-NaN
+  uint8_t overflow_[2];  //!< Result for the values above the largest finite value
+  uint8_t zero_[2];      //!< Result for +/-0 after rounding
+};
+
+// ================================================================================================
+Fp8Params MakeFp8Params(hipExtFp8Format_t format, bool saturate) {
+  const bool fnuz = (format == hipExtFp8E4M3Fnuz) || (format == hipExtFp8E5M2Fnuz);
+  const bool e5m2 = (format == hipExtFp8E5M2) || (format == hipExtFp8E5M2Fnuz);
+  const uint32_t wm = e5m2 ? 2 : 3;
+  const uint32_t we = e5m2 ? 5 : 4;
+  const uint32_t f8_bias = (1u << (we - 1)) - 1 + (fnuz ? 1 : 0);
+
+  Fp8Params p;
+  p.shift_ = 23 - wm;
+  p.drop_mask_ = (1u << p.shift_) - 1;
+  p.rebias_ = (127 - f8_bias) << 23;
+  p.min_normal_ = 128 - f8_bias;
+  // 57344, 240 and 448
+  p.max_bits_ = e5m2 ? 0x47600000 : (fnuz ? 0x43700000 : 0x43E00000);
+  p.fnuz_ = fnuz;
+  for (uint32_t sign = 0; sign < 2; ++sign) {
+    const uint8_t sign_bit = static_cast<uint8_t>(sign << 7);
+    if (fnuz) {
+      p.inf_[sign] = 0x80;
+      p.nan_[sign] = 0x80;
+      p.overflow_[sign] = saturate ? (sign_bit | 0x7f) : 0x80;
+      p.zero_[sign] = 0;
+    } else {
+      p.inf_[sign] = sign_bit | (e5m2 ? 0x7c : 0x7f);
+      p.nan_[sign] = sign_bit | 0x7f;
+      p.overflow_[sign] = sign_bit | (e5m2 ? (saturate ? 0x7b : 0x7c) : (saturate ? 0x7e : 0x7f));
+      p.zero_[sign] = sign_bit;
+    }
+  }
+  return p;
+}
+
+// ================================================================================================
+template <bool kStochastic>
+inline uint8_t FloatToFp8(uint32_t u, const Fp8Params& p, uint32_t rng) {
+  const uint32_t sign = u >> 31;
+  const uint32_t a = u & 0x7FFFFFFF;
+  if (a >= 0x7F800000) {
+    return (a == 0x7F800000) ? p.inf_[sign] : p.nan_[sign];
+  }
+  if (a > p.max_bits_) {
+    return p.overflow_[sign];
+  }
+  const uint32_t exponent = a >> 23;
+  uint32_t q;
+  if (exponent >= p.min_normal_) {
+    const uint32_t v = a - p.rebias_;
+    q = kStochastic ? ((v + (rng & p.drop_mask_)) >> p.shift_)
+                    : ((v + (p.drop_mask_ >> 1) + ((v >> p.shift_) & 1)) >> p.shift_);
+  } else {
+    // Below the smallest normal, the implicit one moves into the fp8 mantissa
+    const uint32_t m = (a & 0x7FFFFF) | ((exponent != 0) ? 0x800000 : 0);
+    const uint32_t diff = p.min_normal_ - std::max<uint32_t>(exponent, 1);
+    if (kStochastic) {
+      q = (((diff < 32) ? (m >> diff) : 0) + (rng & p.drop_mask_)) >> p.shift_;
+    } else {
+      // Anything shifted by more than 25 bits is below the half of the smallest denormal
+      const uint32_t s = std::min<uint32_t>(p.shift_ + diff, 25);
+      q = (m + ((1u << (s - 1)) - 1) + ((m >> s) & 1)) >> s;
+    }
+  }
+  return (q != 0) ? static_cast<uint8_t>(q | (sign << 7)) : p.zero_[sign];
+}
+
+//! Decoded fp8 values as float bits, the port of internal::cast_from_f8() for float
+struct Fp8Table {
+  uint32_t bits_[256];
+
+  explicit Fp8Table(hipExtFp8Format_t format) {
+    const bool fnuz = (format == hipExtFp8E4M3Fnuz) || (format == hipExtFp8E5M2Fnuz);
+    const bool e5m2 = (format == hipExtFp8E5M2) || (format == hipExtFp8E5M2Fnuz);
+    const uint32_t wm = e5m2 ? 2 : 3;
+    const uint32_t we = e5m2 ? 5 : 4;
+    const uint32_t kNaN = 0x7F800001;
+    for (uint32_t x = 0; x < 256; ++x) {
+      const uint32_t sign = x >> 7;
+      uint32_t mantissa = x & ((1u << wm) - 1);
+      int exponent = (x & 0x7F) >> wm;
+      if (x == 0) {
+        bits_[x] = 0;
+      } else if (x == 0x80) {
+        bits_[x] = fnuz ? kNaN : 0x80000000;
+      } else if (!fnuz && !e5m2 && ((x & 0x7F) == 0x7F)) {
+        bits_[x] = kNaN;
+      } else if (!fnuz && e5m2 && ((x & 0x7C) == 0x7C)) {
+        bits_[x] = ((x & 0x3) == 0) ? ((sign << 31) | 0x7F800000) : kNaN;
+      } else {
+        const int exp_low_cutoff = (1 << 7) - (1 << (we - 1)) + 1 - (fnuz ? 1 : 0);
+        if (exponent == 0) {
+          // Normalize the denormal input
+          while ((mantissa & (1u << wm)) == 0) {
+            mantissa <<= 1;
+            exponent--;
+          }
+          exponent++;
+          mantissa &= (1u << wm) - 1;
+        }
+        exponent += exp_low_cutoff - 1;
+        bits_[x] = (sign << 31) | (static_cast<uint32_t>(exponent) << 23) | (mantissa << (23 - wm));
+      }
+    }
+  }
+};
+
+// ================================================================================================
+const Fp8Table& GetFp8Table(hipExtFp8Format_t format) {
+  static const Fp8Table tables[] = {Fp8Table(hipExtFp8E4M3), Fp8Table(hipExtFp8E5M2),
+                                    Fp8Table(hipExtFp8E4M3Fnuz), Fp8Table(hipExtFp8E5M2Fnuz)};
+  return tables[format];
+}
+
+// ================================================================================================
+inline uint16_t FloatToBf16(uint32_t u) {
+  if ((u & 0x7FFFFFFF) > 0x7F800000) {
+    // Quiet NaN with the upper payload bits
+    return static_cast<uint16_t>((u >> 16) | 0x40);
+  }
+  return static_cast<uint16_t>((u + 0x7FFF + ((u >> 16) & 1)) >> 16);
+}
+
+// ================================================================================================
+inline uint16_t FloatToHalf(uint32_t u) {
+  const uint32_t sign = (u >> 16) & 0x8000;
+  const uint32_t a = u & 0x7FFFFFFF;
+  if (a >= 0x7F800000) {
+    // Inf or quiet NaN with the upper payload bits
+    return static_cast<uint16_t>(sign | 0x7C00 |
+                                 ((a > 0x7F800000) ? (0x200 | ((a >> 13) & 0x1FF)) : 0));
+  }
+  if (a >= 0x47800000) {
+    return static_cast<uint16_t>(sign | 0x7C00);
+  }
+  if (a >= 0x38800000) {
+    const uint32_t v = a - (112u << 23);
+    return static_cast<uint16_t>(sign | ((v + 0xFFF + ((v >> 13) & 1)) >> 13));
+  }
+  const uint32_t exponent = a >> 23;
+  if (exponent < 102) {
+    // Below the half of the smallest denormal
+    return static_cast<uint16_t>(sign);
+  }
+  const uint32_t m = (a & 0x7FFFFF) | 0x800000;
+  const uint32_t s = 126 - exponent;
+  return static_cast<uint16_t>(sign | ((m + ((1u << (s - 1)) - 1) + ((m >> s) & 1)) >> s));
+}
+
+// ================================================================================================
+inline uint32_t HalfToFloat(uint16_t h) {
+  const uint32_t sign = static_cast<uint32_t>(h & 0x8000) << 16;
+  int exponent = (h >> 10) & 0x1F;
+  uint32_t mantissa = h & 0x3FF;
+  if (exponent == 0x1F) {
+    // Inf or NaN, the payload is preserved
+    return sign | 0x7F800000 | (mantissa << 13);
+  }
+  if (exponent == 0) {
+    if (mantissa == 0) {
+      return sign;
+    }
+    while ((mantissa & 0x400) == 0) {
+      mantissa <<= 1;
+      exponent--;
+    }
+    exponent++;
+    mantissa &= 0x3FF;
+  }
+  return sign | (static_cast<uint32_t>(exponent + 112) << 23) | (mantissa << 13);
+}
+
+// ================================================================================================
+template <bool kStochastic>
+void FloatToFp8Scalar(const uint32_t* src, uint8_t* dst, size_t count, const Fp8Params& p,
+                      uint32_t seed, uint32_t index) {
+  for (size_t i = 0; i < count; ++i) {
+    const uint32_t rng =
+        kStochastic ? hipExtFp8StochasticBits(seed, static_cast<uint32_t>(index + i)) : 0;
+    dst[i] = FloatToFp8<kStochastic>(src[i], p, rng);
+  }
+}
+
+#if HIP_FP_CONVERT_X86
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx2")
+inline __m256i StochasticBitsAvx2(__m256i index, __m256i seed) {
+  __m256i x = _mm256_add_epi32(_mm256_mullo_epi32(index, _mm256_set1_epi32(0x9E3779B9)), seed);
+  x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+  x = _mm256_mullo_epi32(x, _mm256_set1_epi32(0x7FEB352D));
+  x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 15));
+  x = _mm256_mullo_epi32(x, _mm256_set1_epi32(0x846CA68B));
+  return _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+}
+
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx2")
+inline __m256i SelectBySign(__m256i is_neg, const uint8_t values[2]) {
+  return _mm256_blendv_epi8(_mm256_set1_epi32(values[0]), _mm256_set1_epi32(values[1]), is_neg);
+}
+
+// ================================================================================================
+template <bool kStochastic>
+HIP_FP_CONVERT_TARGET("avx2")
+inline __m256i FloatToFp8x8(__m256i u, const Fp8Params& p, __m256i rng) {
+  const __m128i shift = _mm_cvtsi32_si128(p.shift_);
+  const __m256i drop_mask = _mm256_set1_epi32(p.drop_mask_);
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i a = _mm256_and_si256(u, _mm256_set1_epi32(0x7FFFFFFF));
+  const __m256i sign = _mm256_srli_epi32(u, 31);
+  const __m256i exponent = _mm256_srli_epi32(a, 23);
+
+  // Values in the fp8 normal range
+  const __m256i v = _mm256_sub_epi32(a, _mm256_set1_epi32(p.rebias_));
+  __m256i qn;
+  if (kStochastic) {
+    qn = _mm256_srl_epi32(_mm256_add_epi32(v, _mm256_and_si256(rng, drop_mask)), shift);
+  } else {
+    const __m256i odd = _mm256_and_si256(_mm256_srl_epi32(v, shift), one);
+    qn = _mm256_srl_epi32(
+        _mm256_add_epi32(_mm256_add_epi32(v, _mm256_srli_epi32(drop_mask, 1)), odd), shift);
+  }
+
+  // Values below the smallest normal, the variable shifts return 0 for the counts above 31
+  const __m256i implicit_one = _mm256_andnot_si256(
+      _mm256_cmpeq_epi32(exponent, _mm256_setzero_si256()), _mm256_set1_epi32(0x800000));
+  const __m256i m =
+      _mm256_or_si256(_mm256_and_si256(a, _mm256_set1_epi32(0x7FFFFF)), implicit_one);
+  const __m256i diff = _mm256_sub_epi32(_mm256_set1_epi32(p.min_normal_),
+                                        _mm256_max_epu32(exponent, one));
+  __m256i qd;
+  if (kStochastic) {
+    qd = _mm256_srl_epi32(
+        _mm256_add_epi32(_mm256_srlv_epi32(m, diff), _mm256_and_si256(rng, drop_mask)), shift);
+  } else {
+    const __m256i s = _mm256_min_epu32(_mm256_add_epi32(diff, _mm256_set1_epi32(p.shift_)),
+                                       _mm256_set1_epi32(25));
+    const __m256i half = _mm256_sub_epi32(_mm256_sllv_epi32(one, _mm256_sub_epi32(s, one)), one);
+    const __m256i odd = _mm256_and_si256(_mm256_srlv_epi32(m, s), one);
+    qd = _mm256_srlv_epi32(_mm256_add_epi32(_mm256_add_epi32(m, half), odd), s);
+  }
+
+  const __m256i is_normal = _mm256_cmpgt_epi32(exponent, _mm256_set1_epi32(p.min_normal_ - 1));
+  const __m256i q = _mm256_blendv_epi8(qd, qn, is_normal);
+  const __m256i is_neg = _mm256_cmpeq_epi32(sign, one);
+  __m256i r = _mm256_or_si256(q, _mm256_slli_epi32(sign, 7));
+  r = _mm256_blendv_epi8(r, SelectBySign(is_neg, p.zero_),
+                         _mm256_cmpeq_epi32(q, _mm256_setzero_si256()));
+  r = _mm256_blendv_epi8(r, SelectBySign(is_neg, p.overflow_),
+                         _mm256_cmpgt_epi32(a, _mm256_set1_epi32(p.max_bits_)));
+  const __m256i inf = _mm256_set1_epi32(0x7F800000);
+  r = _mm256_blendv_epi8(r, SelectBySign(is_neg, p.nan_), _mm256_cmpgt_epi32(a, inf));
+  r = _mm256_blendv_epi8(r, SelectBySign(is_neg, p.inf_), _mm256_cmpeq_epi32(a, inf));
+  return r;
+}
+
+// ================================================================================================
+template <bool kStochastic>
+HIP_FP_CONVERT_TARGET("avx2")
+void FloatToFp8Avx2(const uint32_t* src, uint8_t* dst, size_t count, const Fp8Params& p,
+                    uint32_t seed, uint32_t index) {
+  const __m256i seed_v = _mm256_set1_epi32(seed);
+  const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+  size_t i = 0;
+  for (; i + 32 <= count; i += 32) {
+    __m256i r[4];
+    for (uint32_t j = 0; j < 4; ++j) {
+      const __m256i u = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 8 * j));
+      __m256i rng = _mm256_setzero_si256();
+      if (kStochastic) {
+        const uint32_t first = static_cast<uint32_t>(index + i + 8 * j);
+        rng = StochasticBitsAvx2(_mm256_add_epi32(_mm256_set1_epi32(first), lane), seed_v);
+      }
+      r[j] = FloatToFp8x8<kStochastic>(u, p, rng);
+    }
+    // Pack 32 bit lanes to bytes, the packs interleave 128 bit halves, hence the permute
+    const __m256i w01 = _mm256_packus_epi32(r[0], r[1]);
+    const __m256i w23 = _mm256_packus_epi32(r[2], r[3]);
+    const __m256i b = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(w01, w23), order);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), b);
+  }
+  FloatToFp8Scalar<kStochastic>(src + i, dst + i, count - i, p, seed,
+                                static_cast<uint32_t>(index + i));
+}
+
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx512f")
+inline __m512i StochasticBitsAvx512(__m512i index, __m512i seed) {
+  __m512i x = _mm512_add_epi32(_mm512_mullo_epi32(index, _mm512_set1_epi32(0x9E3779B9)), seed);
+  x = _mm512_xor_si512(x, _mm512_srli_epi32(x, 16));
+  x = _mm512_mullo_epi32(x, _mm512_set1_epi32(0x7FEB352D));
+  x = _mm512_xor_si512(x, _mm512_srli_epi32(x, 15));
+  x = _mm512_mullo_epi32(x, _mm512_set1_epi32(0x846CA68B));
+  return _mm512_xor_si512(x, _mm512_srli_epi32(x, 16));
+}
+
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx512f")
+inline __m512i SelectBySign(__mmask16 is_neg, const uint8_t values[2]) {
+  return _mm512_mask_blend_epi32(is_neg, _mm512_set1_epi32(values[0]),
+                                 _mm512_set1_epi32(values[1]));
+}
+
+// ================================================================================================
+template <bool kStochastic>
+HIP_FP_CONVERT_TARGET("avx512f")
+inline __m512i FloatToFp8x16(__m512i u, const Fp8Params& p, __m512i rng) {
+  const __m128i shift = _mm_cvtsi32_si128(p.shift_);
+  const __m512i drop_mask = _mm512_set1_epi32(p.drop_mask_);
+  const __m512i one = _mm512_set1_epi32(1);
+  const __m512i a = _mm512_and_si512(u, _mm512_set1_epi32(0x7FFFFFFF));
+  const __m512i exponent = _mm512_srli_epi32(a, 23);
+
+  const __m512i v = _mm512_sub_epi32(a, _mm512_set1_epi32(p.rebias_));
+  __m512i qn;
+  if (kStochastic) {
+    qn = _mm512_srl_epi32(_mm512_add_epi32(v, _mm512_and_si512(rng, drop_mask)), shift);
+  } else {
+    const __m512i odd = _mm512_and_si512(_mm512_srl_epi32(v, shift), one);
+    qn = _mm512_srl_epi32(
+        _mm512_add_epi32(_mm512_add_epi32(v, _mm512_srli_epi32(drop_mask, 1)), odd), shift);
+  }
+
+  const __mmask16 has_exponent = _mm512_test_epi32_mask(exponent, exponent);
+  const __m512i fraction = _mm512_and_si512(a, _mm512_set1_epi32(0x7FFFFF));
+  const __m512i m =
+      _mm512_mask_or_epi32(fraction, has_exponent, fraction, _mm512_set1_epi32(0x800000));
+  const __m512i diff = _mm512_sub_epi32(_mm512_set1_epi32(p.min_normal_),
+                                        _mm512_max_epu32(exponent, one));
+  __m512i qd;
+  if (kStochastic) {
+    qd = _mm512_srl_epi32(
+        _mm512_add_epi32(_mm512_srlv_epi32(m, diff), _mm512_and_si512(rng, drop_mask)), shift);
+  } else {
+    const __m512i s = _mm512_min_epu32(_mm512_add_epi32(diff, _mm512_set1_epi32(p.shift_)),
+                                       _mm512_set1_epi32(25));
+    const __m512i half = _mm512_sub_epi32(_mm512_sllv_epi32(one, _mm512_sub_epi32(s, one)), one);
+    const __m512i odd = _mm512_and_si512(_mm512_srlv_epi32(m, s), one);
+    qd = _mm512_srlv_epi32(_mm512_add_epi32(_mm512_add_epi32(m, half), odd), s);
+  }
+
+  const __mmask16 is_normal = _mm512_cmpgt_epu32_mask(exponent,
+                                                      _mm512_set1_epi32(p.min_normal_ - 1));
+  const __m512i q = _mm512_mask_blend_epi32(is_normal, qd, qn);
+  const __mmask16 is_neg = _mm512_cmpneq_epi32_mask(a, u);
+  __m512i r = _mm512_mask_or_epi32(q, is_neg, q, _mm512_set1_epi32(0x80));
+  r = _mm512_mask_mov_epi32(r, _mm512_cmpeq_epi32_mask(q, _mm512_setzero_si512()),
+                            SelectBySign(is_neg, p.zero_));
+  r = _mm512_mask_mov_epi32(r, _mm512_cmpgt_epu32_mask(a, _mm512_set1_epi32(p.max_bits_)),
+                            SelectBySign(is_neg, p.overflow_));
+  const __m512i inf = _mm512_set1_epi32(0x7F800000);
+  r = _mm512_mask_mov_epi32(r, _mm512_cmpgt_epu32_mask(a, inf), SelectBySign(is_neg, p.nan_));
+  r = _mm512_mask_mov_epi32(r, _mm512_cmpeq_epi32_mask(a, inf), SelectBySign(is_neg, p.inf_));
+  return r;
+}
+
+// ================================================================================================
+template <bool kStochastic>
+HIP_FP_CONVERT_TARGET("avx512f")
+void FloatToFp8Avx512(const uint32_t* src, uint8_t* dst, size_t count, const Fp8Params& p,
+                      uint32_t seed, uint32_t index) {
+  const __m512i seed_v = _mm512_set1_epi32(seed);
+  const __m512i lane = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    const __m512i u = _mm512_loadu_si512(src + i);
+    __m512i rng = _mm512_setzero_si512();
+    if (kStochastic) {
+      rng = StochasticBitsAvx512(
+          _mm512_add_epi32(_mm512_set1_epi32(static_cast<uint32_t>(index + i)), lane), seed_v);
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm512_cvtepi32_epi8(FloatToFp8x16<kStochastic>(u, p, rng)));
+  }
+  FloatToFp8Scalar<kStochastic>(src + i, dst + i, count - i, p, seed,
+                                static_cast<uint32_t>(index + i));
+}
+
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx2")
+void Fp8ToFloatAvx2(const uint8_t* src, uint32_t* dst, size_t count, const Fp8Table& table) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m256i index =
+        _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                        _mm256_i32gather_epi32(reinterpret_cast<const int*>(table.bits_), index,
+                                               4));
+  }
+  for (; i < count; ++i) {
+    dst[i] = table.bits_[src[i]];
+  }
+}
+
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx512f")
+void Fp8ToFloatAvx512(const uint8_t* src, uint32_t* dst, size_t count, const Fp8Table& table) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    const __m512i index =
+        _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+    _mm512_storeu_si512(dst + i, _mm512_i32gather_epi32(index, table.bits_, 4));
+  }
+  for (; i < count; ++i) {
+    dst[i] = table.bits_[src[i]];
+  }
+}
+
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx2")
+inline __m256i FloatToBf16x8(__m256i u) {
+  const __m256i a = _mm256_and_si256(u, _mm256_set1_epi32(0x7FFFFFFF));
+  const __m256i odd = _mm256_and_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(1));
+  const __m256i rounded =
+      _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(u, _mm256_set1_epi32(0x7FFF)), odd), 16);
+  const __m256i nan = _mm256_or_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(0x40));
+  return _mm256_blendv_epi8(rounded, nan, _mm256_cmpgt_epi32(a, _mm256_set1_epi32(0x7F800000)));
+}
+
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx2")
+void FloatToBf16Avx2(const uint32_t* src, uint16_t* dst, size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    const __m256i r0 =
+        FloatToBf16x8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+    const __m256i r1 =
+        FloatToBf16x8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 8)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                        _mm256_permute4x64_epi64(_mm256_packus_epi32(r0, r1), 0xD8));
+  }
+  for (; i < count; ++i) {
+    dst[i] = FloatToBf16(src[i]);
+  }
+}
+
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx512f")
+void FloatToBf16Avx512(const uint32_t* src, uint16_t* dst, size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    const __m512i u = _mm512_loadu_si512(src + i);
+    const __m512i a = _mm512_and_si512(u, _mm512_set1_epi32(0x7FFFFFFF));
+    const __m512i odd = _mm512_and_si512(_mm512_srli_epi32(u, 16), _mm512_set1_epi32(1));
+    __m512i r = _mm512_srli_epi32(
+        _mm512_add_epi32(_mm512_add_epi32(u, _mm512_set1_epi32(0x7FFF)), odd), 16);
+    r = _mm512_mask_or_epi32(r, _mm512_cmpgt_epu32_mask(a, _mm512_set1_epi32(0x7F800000)),
+                             _mm512_srli_epi32(u, 16), _mm512_set1_epi32(0x40));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm512_cvtepi32_epi16(r));
+  }
+  for (; i < count; ++i) {
+    dst[i] = FloatToBf16(src[i]);
+  }
+}
+
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx2")
+void Bf16ToFloatAvx2(const uint16_t* src, uint32_t* dst, size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m256i h =
+        _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_slli_epi32(h, 16));
+  }
+  for (; i < count; ++i) {
+    dst[i] = static_cast<uint32_t>(src[i]) << 16;
+  }
+}
+
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx512f")
+void Bf16ToFloatAvx512(const uint16_t* src, uint32_t* dst, size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    const __m512i h =
+        _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+    _mm512_storeu_si512(dst + i, _mm512_slli_epi32(h, 16));
+  }
+  for (; i < count; ++i) {
+    dst[i] = static_cast<uint32_t>(src[i]) << 16;
+  }
+}
+
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx2,f16c")
+void FloatToHalfF16c(const uint32_t* src, uint16_t* dst, size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m256 f = _mm256_loadu_ps(reinterpret_cast<const float*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm256_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+  }
+  for (; i < count; ++i) {
+    dst[i] = FloatToHalf(src[i]);
+  }
+}
+
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx2,f16c")
+void HalfToFloatF16c(const uint16_t* src, uint32_t* dst, size_t count) {
+  const __m256i exponent_mask = _mm256_set1_epi32(0x7C00);
+  const __m256i quiet_bit = _mm256_set1_epi32(0x200);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    __m256i f = _mm256_castps_si256(_mm256_cvtph_ps(h));
+    // The hardware quiets the signaling NaNs, the scalar conversion keeps the payload as is
+    const __m256i h32 = _mm256_cvtepu16_epi32(h);
+    const __m256i snan = _mm256_andnot_si256(
+        _mm256_cmpeq_epi32(_mm256_and_si256(h32, _mm256_set1_epi32(0x3FF)),
+                           _mm256_setzero_si256()),
+        _mm256_andnot_si256(
+            _mm256_cmpeq_epi32(_mm256_and_si256(h32, quiet_bit), quiet_bit),
+            _mm256_cmpeq_epi32(_mm256_and_si256(h32, exponent_mask), exponent_mask)));
+    f = _mm256_andnot_si256(_mm256_and_si256(snan, _mm256_set1_epi32(0x400000)), f);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), f);
+  }
+  for (; i < count; ++i) {
+    dst[i] = HalfToFloat(src[i]);
+  }
+}
+
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx512f")
+void FloatToHalfAvx512(const uint32_t* src, uint16_t* dst, size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    const __m512 f = _mm512_loadu_ps(src + i);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                        _mm512_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+  }
+  for (; i < count; ++i) {
+    dst[i] = FloatToHalf(src[i]);
+  }
+}
+
+// ================================================================================================
+HIP_FP_CONVERT_TARGET("avx512f")
+void HalfToFloatAvx512(const uint16_t* src, uint32_t* dst, size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    const __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    __m512i f = _mm512_castps_si512(_mm512_cvtph_ps(h));
+    // Restore the signaling NaNs, which the hardware quiets
+    const __m512i h32 = _mm512_cvtepu16_epi32(h);
+    const __mmask16 snan =
+        _mm512_cmpeq_epi32_mask(_mm512_and_si512(h32, _mm512_set1_epi32(0x7E00)),
+                                _mm512_set1_epi32(0x7C00)) &
+        _mm512_test_epi32_mask(h32, _mm512_set1_epi32(0x1FF));
+    f = _mm512_mask_andnot_epi32(f, snan, _mm512_set1_epi32(0x400000), f);
+    _mm512_storeu_si512(dst + i, f);
+  }
+  for (; i < count; ++i) {
+    dst[i] = HalfToFloat(src[i]);
+  }
+}
+#endif  // HIP_FP_CONVERT_X86
+
+// ================================================================================================
+hipError_t ihipExtConvertFloatToFp8(const float* src, uint8_t* dst, size_t count,
+                                    hipExtFp8Format_t format, int saturate,
+                                    hipExtFp8Rounding_t rounding, uint32_t seed) {
+  if ((count != 0 && (src == nullptr || dst == nullptr)) || format < hipExtFp8E4M3 ||
+      format > hipExtFp8E5M2Fnuz ||
+      (rounding != hipExtFp8RoundNearestEven && rounding != hipExtFp8RoundStochastic)) {
+    return hipErrorInvalidValue;
+  }
+  using Kernel = void (*)(const uint32_t*, uint8_t*, size_t, const Fp8Params&, uint32_t,
+                          uint32_t);
+  const bool stochastic = (rounding == hipExtFp8RoundStochastic);
+  Kernel kernel = stochastic ? FloatToFp8Scalar<true> : FloatToFp8Scalar<false>;
+#if HIP_FP_CONVERT_X86
+  switch (GetConvertIsa()) {
+    case ConvertIsa::kAvx512:
+      kernel = stochastic ? FloatToFp8Avx512<true> : FloatToFp8Avx512<false>;
+      break;
+    case ConvertIsa::kAvx2:
+      kernel = stochastic ? FloatToFp8Avx2<true> : FloatToFp8Avx2<false>;
+      break;
+    default:
+      break;
+  }
+#endif
+  const Fp8Params params = MakeFp8Params(format, saturate != 0);
+  const uint32_t* bits = reinterpret_cast<const uint32_t*>(src);
+  // The stochastic bits hash the low and high halves of the index separately, so the blocks
+  // never cross a 4G element boundary
+  size_t index = 0;
+  while (index < count) {
+    const size_t block = std::min<size_t>(count - index, (1ull << 32) - (index & 0xFFFFFFFF));
+    const uint32_t block_seed = seed + static_cast<uint32_t>(index >> 32) * 0x632BE5ABu;
+    kernel(bits + index, dst + index, block, params, block_seed, static_cast<uint32_t>(index));
+    index += block;
+  }
+  return hipSuccess;
+}
+
+// ================================================================================================
+hipError_t ihipExtConvertFp8ToFloat(const uint8_t* src, float* dst, size_t count,
+                                    hipExtFp8Format_t format) {
+  if ((count != 0 && (src == nullptr || dst == nullptr)) || format < hipExtFp8E4M3 ||
+      format > hipExtFp8E5M2Fnuz) {
+    return hipErrorInvalidValue;
+  }
+  const Fp8Table& table = GetFp8Table(format);
+  uint32_t* bits = reinterpret_cast<uint32_t*>(dst);
+#if HIP_FP_CONVERT_X86
+  switch (GetConvertIsa()) {
+    case ConvertIsa::kAvx512:
+      Fp8ToFloatAvx512(src, bits, count, table);
+      return hipSuccess;
+    case ConvertIsa::kAvx2:
+      Fp8ToFloatAvx2(src, bits, count, table);
+      return hipSuccess;
+    default:
+      break;
+  }
+#endif
+  for (size_t i = 0; i < count; ++i) {
+    bits[i] = table.bits_[src[i]];
+  }
+  return hipSuccess;
+}
+
+// ================================================================================================
+hipError_t ihipExtConvertFloatToBf16(const float* src, uint16_t* dst, size_t count) {
+  if (count != 0 && (src == nullptr || dst == nullptr)) {
+    return hipErrorInvalidValue;
+  }
+  const uint32_t* bits = reinterpret_cast<const uint32_t*>(src);
+#if HIP_FP_CONVERT_X86
+  switch (GetConvertIsa()) {
+    case ConvertIsa::kAvx512:
+      FloatToBf16Avx512(bits, dst, count);
+      return hipSuccess;
+    case ConvertIsa::kAvx2:
+      FloatToBf16Avx2(bits, dst, count);
+      return hipSuccess;
+    default:
+      break;
+  }
+#endif
+  for (size_t i = 0; i < count; ++i) {
+    dst[i] = FloatToBf16(bits[i]);
+  }
+  return hipSuccess;
+}
+
+// ================================================================================================
+hipError_t ihipExtConvertBf16ToFloat(const uint16_t* src, float* dst, size_t count) {
+  if (count != 0 && (src == nullptr || dst == nullptr)) {
+    return hipErrorInvalidValue;
+  }
+  uint32_t* bits = reinterpret_cast<uint32_t*>(dst);
+#if HIP_FP_CONVERT_X86
+  switch (GetConvertIsa()) {
+    case ConvertIsa::kAvx512:
+      Bf16ToFloatAvx512(src, bits, count);
+      return hipSuccess;
+    case ConvertIsa::kAvx2:
+      Bf16ToFloatAvx2(src, bits, count);
+      return hipSuccess;
+    default:
+      break;
+  }
+#endif
+  for (size_t i = 0; i < count; ++i) {
+    bits[i] = static_cast<uint32_t>(src[i]) << 16;
+  }
+  return hipSuccess;
+}
+
+// ================================================================================================
+hipError_t ihipExtConvertFloatToHalf(const float* src, uint16_t* dst, size_t count) {
+  if (count != 0 && (src == nullptr || dst == nullptr)) {
+    return hipErrorInvalidValue;
+  }
+  const uint32_t* bits = reinterpret_cast<const uint32_t*>(src);
+#if HIP_FP_CONVERT_X86
+  switch (GetConvertIsa()) {
+    case ConvertIsa::kAvx512:
+      FloatToHalfAvx512(bits, dst, count);
+      return hipSuccess;
+    case ConvertIsa::kAvx2:
+      FloatToHalfF16c(bits, dst, count);
+      return hipSuccess;
+    default:
+      break;
+  }
+#endif
+  for (size_t i = 0; i < count; ++i) {
+    dst[i] = FloatToHalf(bits[i]);
+  }
+  return hipSuccess;
+}
+
+// ================================================================================================
+hipError_t ihipExtConvertHalfToFloat(const uint16_t* src, float* dst, size_t count) {
+  if (count != 0 && (src == nullptr || dst == nullptr)) {
+    return hipErrorInvalidValue;
+  }
+  uint32_t* bits = reinterpret_cast<uint32_t*>(dst);
+#if HIP_FP_CONVERT_X86
+  switch (GetConvertIsa()) {
+    case ConvertIsa::kAvx512:
+      HalfToFloatAvx512(src, bits, count);
+      return hipSuccess;
+    case ConvertIsa::kAvx2:
+      HalfToFloatF16c(src, bits, count);
+      return hipSuccess;
+    default:
+      break;
+  }
+#endif
+  for (size_t i = 0; i < count; ++i) {
+    bits[i] = HalfToFloat(src[i]);
+  }
+  return hipSuccess;
+}
+
+}  // namespace
+
+// ================================================================================================
+hipError_t hipExtConvertFloatToFp8(const float* src, uint8_t* dst, size_t count,
+                                   hipExtFp8Format_t format, int saturate,
+                                   hipExtFp8Rounding_t rounding, uint32_t seed) {
+  HIP_INIT_API(hipExtConvertFloatToFp8, src, dst, count, format, saturate, rounding, seed);
+
+  HIP_RETURN(ihipExtConvertFloatToFp8(src, dst, count, format, saturate, rounding, seed));
+}
+
+// ================================================================================================
+hipError_t hipExtConvertFp8ToFloat(const uint8_t* src, float* dst, size_t count,
+                                   hipExtFp8Format_t format) {
+  HIP_INIT_API(hipExtConvertFp8ToFloat, src, dst, count, format);
+
+  HIP_RETURN(ihipExtConvertFp8ToFloat(src, dst, count, format));
+}
+
+// ================================================================================================
+hipError_t hipExtConvertFloatToBf16(const float* src, uint16_t* dst, size_t count) {
+  HIP_INIT_API(hipExtConvertFloatToBf16, src, dst, count);
+
+  HIP_RETURN(ihipExtConvertFloatToBf16(src, dst, count));
+}
+
+// ================================================================================================
+hipError_t hipExtConvertBf16ToFloat(const uint16_t* src, float* dst, size_t count) {
+  HIP_INIT_API(hipExtConvertBf16ToFloat, src, dst, count);
+
+  HIP_RETURN(ihipExtConvertBf16ToFloat(src, dst, count));
+}
+
+// ================================================================================================
+hipError_t hipExtConvertFloatToHalf(const float* src, uint16_t* dst, size_t count) {
+  HIP_INIT_API(hipExtConvertFloatToHalf, src, dst, count);
+
+  HIP_RETURN(ihipExtConvertFloatToHalf(src, dst, count));
+}
+
+// ================================================================================================
+hipError_t hipExtConvertHalfToFloat(const uint16_t* src, float* dst, size_t count) {
+  HIP_INIT_API(hipExtConvertHalfToFloat, src, dst, count);
+
+  HIP_RETURN(ihipExtConvertHalfToFloat(src, dst, count));
+}
+
+}  // namespace hip
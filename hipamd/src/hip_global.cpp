@@ -194,8 +194,11 @@ hipError_t Function::getStatFuncAttr(hipFuncAttributes* func_attr, int deviceId)
 
   amd::Kernel* kernel = dFunc_[deviceId]->kernel();
   auto* device_handle = devices[deviceId];
-  const device::Kernel::WorkGroupInfo* wginfo =
-              kernel->getDeviceKernel(*device_handle)->workGroupInfo();
+  const device::Kernel* devKernel = kernel->getDeviceKernel(*device_handle);
+  if (devKernel == nullptr) {
+    return hipErrorInvalidDeviceFunction;
+  }
+  const device::Kernel::WorkGroupInfo* wginfo = devKernel->workGroupInfo();
   int binaryVersion = device_handle->isa().versionMajor() * 10 +
                       device_handle->isa().versionMinor();
   func_attr->sharedSizeBytes = static_cast<int>(wginfo->localMemSize_);
@@ -55,19 +55,27 @@ inline hipError_t ihipGraphAddNode(hip::GraphNode* graphNode, hip::Graph* graph,
                                    hip::GraphNode* const* pDependencies, size_t numDependencies,
                                    bool capture = true) {
   graph->AddNode(graphNode);
+  // A captured node usually has one or a few dependencies, so search the duplicates
+  // without a hash set unless the list is long
+  constexpr size_t kMaxLinearSearch = 16;
   std::unordered_set<hip::GraphNode*> DuplicateDep;
   for (size_t i = 0; i < numDependencies; i++) {
     if ((!hip::GraphNode::isNodeValid(pDependencies[i])) ||
         (graph != pDependencies[i]->GetParentGraph())) {
       return hipErrorInvalidValue;
     }
-    if (DuplicateDep.find(pDependencies[i]) != DuplicateDep.end()) {
+    if (numDependencies <= kMaxLinearSearch) {
+      if (std::find(pDependencies, pDependencies + i, pDependencies[i]) != pDependencies + i) {
+        return hipErrorInvalidValue;
+      }
+    } else if (!DuplicateDep.insert(pDependencies[i]).second) {
       return hipErrorInvalidValue;
     }
-    DuplicateDep.insert(pDependencies[i]);
     pDependencies[i]->AddEdgeDep(graphNode);
   }
-  if (capture == false) {
+  // The captured nodes don't need the lookup. A manual node takes the global lock only if some
+  // stream is capturing, the same check as CHECK_STREAM_CAPTURING() does
+  if ((capture == false) && !g_allCapturingStreams.empty()) {
     {
       amd::ScopedLock lock(g_streamSetLock);
       for (auto stream : g_allCapturingStreams) {
@@ -114,7 +122,8 @@ hipError_t ihipGraphAddKernelNode(hip::GraphNode** pGraphNode, hip::Graph* graph
     return hipErrorInvalidConfiguration;
   }
 
-  *pGraphNode = new hip::GraphKernelNode(pNodeParams, pNodeEvents, coopKernel);
+  // Pass the resolved function, so the node doesn't search for it again
+  *pGraphNode = new hip::GraphKernelNode(pNodeParams, pNodeEvents, coopKernel, func);
   status = ihipGraphAddNode(*pGraphNode, graph, pDependencies, numDependencies, capture);
   return status;
 }
@@ -1487,7 +1496,7 @@ hipError_t ihipGraphInstantiate(hip::GraphExec** pGraphExec, hip::Graph* graph,
   if (*pGraphExec == nullptr) {
     return hipErrorOutOfMemory;
   }
-  graph->clone(*pGraphExec, true);
+  graph->clone(*pGraphExec);
   (*pGraphExec)->ScheduleNodes();
   if (false == (*pGraphExec)->TopologicalOrder()) {
     return hipErrorInvalidValue;
@@ -2310,13 +2319,12 @@ hipError_t hipGraphNodeFindInClone(hipGraphNode_t* pNode, hipGraphNode_t origina
     HIP_RETURN(hipErrorInvalidValue);
   }
 
-  for (auto node : iClonedGraph->GetNodes()) {
-    if (node->GetID() == iGraphnode->GetID()) {
-      *pNode = reinterpret_cast<hipGraphNode_t>(node);
-      HIP_RETURN(hipSuccess);
-    }
+  hip::GraphNode* clonedNode = iClonedGraph->GetClonedNode(iGraphnode);
+  if (clonedNode == nullptr) {
+    HIP_RETURN(hipErrorInvalidValue);
   }
-  HIP_RETURN(hipErrorInvalidValue);
+  *pNode = reinterpret_cast<hipGraphNode_t>(clonedNode);
+  HIP_RETURN(hipSuccess);
 }
 
 hipError_t hipGraphAddMemcpyNodeFromSymbol(hipGraphNode_t* pGraphNode, hipGraph_t graph,
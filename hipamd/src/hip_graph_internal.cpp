@@ -19,6 +19,7 @@
  THE SOFTWARE. */
 
 #include "hip_graph_internal.hpp"
+#include <limits>
 #include <queue>
 
 #define CASE_STRING(X, C)                                                                          \
@@ -121,6 +122,7 @@ bool Graph::isGraphValid(Graph* pGraph) {
 
 // ================================================================================================
 void Graph::AddNode(const Node& node) {
+  node->index_ = static_cast<uint32_t>(vertices_.size());
   vertices_.emplace_back(node);
   ClPrint(amd::LOG_INFO, amd::LOG_CODE, "[hipGraph] Add %s(%p)",
           GetGraphNodeTypeString(node->GetType()), node);
@@ -129,7 +131,16 @@ void Graph::AddNode(const Node& node) {
 
 // ================================================================================================
 void Graph::RemoveNode(const Node& node) {
-  vertices_.erase(std::remove(vertices_.begin(), vertices_.end(), node), vertices_.end());
+  // The dense index locates the node without a search. The order of the remaining nodes is
+  // preserved, hence only the nodes after the removed one get a new index
+  auto it = ((node->index_ < vertices_.size()) && (vertices_[node->index_] == node))
+      ? vertices_.begin() + node->index_
+      : std::find(vertices_.begin(), vertices_.end(), node);
+  if (it != vertices_.end()) {
+    for (it = vertices_.erase(it); it != vertices_.end(); ++it) {
+      (*it)->index_--;
+    }
+  }
   delete node;
 }
 
@@ -182,25 +193,36 @@ std::vector<std::pair<Node, Node>> Graph::GetEdges() const {
 
 // ================================================================================================
 void Graph::ScheduleOneNode(Node node, int stream_id) {
-  if (node->stream_id_ == -1) {
+  // Depth first walk with an explicit stack, since the captured graphs can have chains
+  // of many thousands nodes. The edges are pushed in the reverse order, so the visit order
+  // is the same as the recursive walk.
+  std::vector<std::pair<Node, int>> stack = {{node, stream_id}};
+  while (!stack.empty()) {
+    Node current = stack.back().first;
+    int current_stream = stack.back().second;
+    stack.pop_back();
+    if (current->stream_id_ != -1) {
+      continue;
+    }
     // Assign active stream to the current node
-    node->stream_id_ = stream_id;
-    max_streams_ = std::max(max_streams_, (stream_id + 1));
+    current->stream_id_ = current_stream;
+    max_streams_ = std::max(max_streams_, (current_stream + 1));
 
     // Process child graph separately, since, there is no connection
-    if (node->GetType() == hipGraphNodeTypeGraph) {
-      auto child = reinterpret_cast<hip::ChildGraphNode*>(node)->GetChildGraph();
+    if (current->GetType() == hipGraphNodeTypeGraph) {
+      auto child = reinterpret_cast<hip::ChildGraphNode*>(current)->GetChildGraph();
       child->ScheduleNodes();
       max_streams_ = std::max(max_streams_, child->max_streams_);
       if (child->max_streams_ == 1) {
-        reinterpret_cast<hip::ChildGraphNode*>(node)->GraphExec::TopologicalOrder();
+        reinterpret_cast<hip::ChildGraphNode*>(current)->GraphExec::TopologicalOrder();
       }
     }
-    for (auto edge: node->GetEdges()) {
-      ScheduleOneNode(edge, stream_id);
+    const auto& edges = current->GetEdges();
+    for (size_t i = edges.size(); i > 0; --i) {
       // 1. Each extra edge will get a new stream from the pool
       // 2. Streams will be reused if the number of edges > streams
-      stream_id = (stream_id + 1) % DEBUG_HIP_FORCE_GRAPH_QUEUES;
+      int edge_stream = static_cast<int>((current_stream + i - 1) % DEBUG_HIP_FORCE_GRAPH_QUEUES);
+      stack.emplace_back(edges[i - 1], edge_stream);
     }
   }
 }
@@ -210,9 +232,14 @@ void Graph::ScheduleNodes() {
   for (auto node : vertices_) {
     node->stream_id_ = -1;
     node->signal_is_required_ = false;
+    node->sched_priority_ = 0;
   }
   memset(&roots_[0], 0, sizeof(Node) * roots_.size());
   max_streams_ = 0;
+  critical_path_cost_ = 0;
+  if (DEBUG_HIP_GRAPH_CP_SCHEDULER && ScheduleCriticalPath()) {
+    return;
+  }
   // Start processing all nodes in the graph to find async executions.
   int stream_id = 0;
   for (auto node : vertices_) {
@@ -233,35 +260,195 @@ void Graph::ScheduleNodes() {
 }
 
 // ================================================================================================
-bool Graph::TopologicalOrder(std::vector<Node>& TopoOrder) {
-  std::queue<Node> q;
-  std::unordered_map<Node, int> inDegree;
-  for (auto entry : vertices_) {
-    // Update the dependencies if a signal is required
-    for (auto dep: entry->GetDependencies()) {
-      // Check if the stream ID doesn't match and enable signal
-      if (dep->stream_id_ != entry->stream_id_) {
-        dep->signal_is_required_ = true;
+bool Graph::ScheduleCriticalPath() {
+  const size_t num_nodes = vertices_.size();
+  GraphTopology topology;
+  BuildTopology(topology);
+
+  // Child graphs are scheduled independently, since there is no connection.
+  // Their critical path becomes the cost of the child graph node.
+  std::vector<uint64_t> cost(num_nodes);
+  std::vector<uint32_t> in_degree(num_nodes);
+  uint64_t total_cost = 0;
+  for (size_t i = 0; i < num_nodes; ++i) {
+    Node node = vertices_[i];
+    if (node->GetType() == hipGraphNodeTypeGraph) {
+      auto child = reinterpret_cast<hip::ChildGraphNode*>(node)->GetChildGraph();
+      child->ScheduleNodes();
+      max_streams_ = std::max(max_streams_, child->max_streams_);
+      if (child->max_streams_ == 1) {
+        reinterpret_cast<hip::ChildGraphNode*>(node)->GraphExec::TopologicalOrder();
       }
     }
+    cost[i] = node->GetCostEstimate();
+    total_cost += cost[i];
+    in_degree[i] = topology.InDegree(static_cast<uint32_t>(i));
+  }
 
-    if (entry->GetInDegree() == 0) {
-      q.push(entry);
-    }
-    inDegree[entry] = entry->GetInDegree();
-  }
-  while (!q.empty())
-  {
-    Node node = q.front();
-    TopoOrder.push_back(node);
-    q.pop();
-    for (auto edge : node->GetEdges()) {
-      inDegree[edge]--;
-      if (inDegree[edge] == 0) {
-        q.push(edge);
+  // Find a topological order, cyclic graphs are rejected later by TopologicalOrder()
+  std::vector<uint32_t> order;
+  if (!topology.Sort(order)) {
+    return false;
+  }
+
+  // The priority of every node is the longest cost path from the node to the graph exit
+  for (auto it = order.rbegin(); it != order.rend(); ++it) {
+    Node node = vertices_[*it];
+    uint64_t longest_edge = 0;
+    for (auto edge = topology.EdgesBegin(*it); edge != topology.EdgesEnd(*it); ++edge) {
+      longest_edge = std::max(longest_edge, vertices_[*edge]->sched_priority_);
+    }
+    node->sched_priority_ = cost[*it] + longest_edge;
+    critical_path_cost_ = std::max(critical_path_cost_, node->sched_priority_);
+  }
+
+  // Pick the number of streams from the average parallelism of the graph.
+  // Narrow graphs collapse into a single stream without any cross stream barriers.
+  uint32_t num_streams = 1;
+  if (critical_path_cost_ != 0) {
+    num_streams = static_cast<uint32_t>(
+        std::min<uint64_t>((total_cost + critical_path_cost_ - 1) / critical_path_cost_,
+                           DEBUG_HIP_FORCE_GRAPH_QUEUES));
+    num_streams = std::max(num_streams, 1u);
+  }
+
+  // List scheduling: ready nodes are processed in priority order and each node goes to the
+  // stream with the earliest estimated start time. Cross stream dependencies are charged
+  // with an extra cost, hence a node stays on its parent's stream unless another is faster.
+  auto lower_priority = [this](uint32_t a, uint32_t b) {
+    if (vertices_[a]->sched_priority_ != vertices_[b]->sched_priority_) {
+      return vertices_[a]->sched_priority_ < vertices_[b]->sched_priority_;
+    }
+    return a > b;
+  };
+  std::priority_queue<uint32_t, std::vector<uint32_t>, decltype(lower_priority)> ready(
+      lower_priority);
+  std::vector<uint64_t> finish(num_nodes, 0);
+  std::vector<uint64_t> stream_free(num_streams, 0);
+  size_t cross_edges = 0;
+  for (size_t i = 0; i < num_nodes; ++i) {
+    if (in_degree[i] == 0) {
+      ready.push(i);
+    }
+  }
+  while (!ready.empty()) {
+    uint32_t i = ready.top();
+    ready.pop();
+    Node node = vertices_[i];
+    int32_t best_stream = 0;
+    uint64_t best_start = std::numeric_limits<uint64_t>::max();
+    for (uint32_t s = 0; s < num_streams; ++s) {
+      uint64_t start = stream_free[s];
+      for (auto dep = topology.DepsBegin(i); dep != topology.DepsEnd(i); ++dep) {
+        uint64_t dep_ready = finish[*dep] +
+            ((vertices_[*dep]->stream_id_ != static_cast<int32_t>(s)) ? kGraphCrossStreamCost
+                                                                       : 0);
+        start = std::max(start, dep_ready);
+      }
+      if (start < best_start) {
+        best_start = start;
+        best_stream = s;
+      }
+    }
+    node->stream_id_ = best_stream;
+    max_streams_ = std::max(max_streams_, best_stream + 1);
+    finish[i] = best_start + cost[i];
+    stream_free[best_stream] = finish[i];
+    for (auto dep : node->GetDependencies()) {
+      cross_edges += (dep->stream_id_ != best_stream) ? 1 : 0;
+    }
+    // Fill in only the first root in the sequence of each stream
+    if ((in_degree[i] == 0) && (roots_[best_stream] == nullptr)) {
+      roots_[best_stream] = node;
+    }
+    for (auto edge = topology.EdgesBegin(i); edge != topology.EdgesEnd(i); ++edge) {
+      if (--in_degree[*edge] == 0) {
+        ready.push(*edge);
+      }
+    }
+  }
+  ClPrint(amd::LOG_INFO, amd::LOG_CODE,
+          "[hipGraph] Scheduled %zu nodes on %d streams, critical path: %llu ns, "
+          "total: %llu ns, cross stream edges: %zu", num_nodes, max_streams_,
+          static_cast<unsigned long long>(critical_path_cost_),
+          static_cast<unsigned long long>(total_cost), cross_edges);
+  return true;
+}
+
+// ================================================================================================
+bool GraphTopology::Sort(std::vector<uint32_t>& order) const {
+  const uint32_t num_nodes = NumNodes();
+  std::vector<uint32_t> in_degree(num_nodes);
+  order.clear();
+  order.reserve(num_nodes);
+  for (uint32_t i = 0; i < num_nodes; ++i) {
+    in_degree[i] = InDegree(i);
+    if (in_degree[i] == 0) {
+      order.push_back(i);
+    }
+  }
+  // The order vector is the queue of the ready nodes
+  for (size_t head = 0; head < order.size(); ++head) {
+    for (auto edge = EdgesBegin(order[head]); edge != EdgesEnd(order[head]); ++edge) {
+      if (--in_degree[*edge] == 0) {
+        order.push_back(*edge);
+      }
+    }
+  }
+  return order.size() == num_nodes;
+}
+
+// ================================================================================================
+void Graph::BuildTopology(GraphTopology& topology) const {
+  const size_t num_nodes = vertices_.size();
+  topology.edge_offsets_.resize(num_nodes + 1);
+  topology.dep_offsets_.resize(num_nodes + 1);
+  uint32_t num_edges = 0;
+  uint32_t num_deps = 0;
+  for (size_t i = 0; i < num_nodes; ++i) {
+    topology.edge_offsets_[i] = num_edges;
+    topology.dep_offsets_[i] = num_deps;
+    num_edges += static_cast<uint32_t>(vertices_[i]->edges_.size());
+    num_deps += static_cast<uint32_t>(vertices_[i]->dependencies_.size());
+  }
+  topology.edge_offsets_[num_nodes] = num_edges;
+  topology.dep_offsets_[num_nodes] = num_deps;
+
+  topology.edges_.resize(num_edges);
+  topology.deps_.resize(num_deps);
+  uint32_t* edge_index = topology.edges_.data();
+  uint32_t* dep_index = topology.deps_.data();
+  for (auto node : vertices_) {
+    for (auto edge : node->edges_) {
+      assert(vertices_[edge->index_] == edge && "The edge is outside of the graph");
+      *edge_index++ = edge->index_;
+    }
+    for (auto dep : node->dependencies_) {
+      assert(vertices_[dep->index_] == dep && "The dependency is outside of the graph");
+      *dep_index++ = dep->index_;
+    }
+  }
+}
+
+// ================================================================================================
+bool Graph::TopologicalOrder(std::vector<Node>& TopoOrder) {
+  GraphTopology topology;
+  BuildTopology(topology);
+  for (uint32_t i = 0; i < topology.NumNodes(); ++i) {
+    // Update the dependencies if a signal is required
+    for (auto dep = topology.DepsBegin(i); dep != topology.DepsEnd(i); ++dep) {
+      // Check if the stream ID doesn't match and enable signal
+      if (vertices_[*dep]->stream_id_ != vertices_[i]->stream_id_) {
+        vertices_[*dep]->signal_is_required_ = true;
       }
     }
   }
+  std::vector<uint32_t> order;
+  topology.Sort(order);
+  TopoOrder.reserve(TopoOrder.size() + order.size());
+  for (auto i : order) {
+    TopoOrder.push_back(vertices_[i]);
+  }
   if (GetNodeCount() == TopoOrder.size()) {
     return true;
   }
@@ -269,32 +456,29 @@ bool Graph::TopologicalOrder(std::vector<Node>& TopoOrder) {
 }
 
 // ================================================================================================
-void Graph::clone(Graph* newGraph, bool cloneNodes) const {
+void Graph::clone(Graph* newGraph) const {
   newGraph->pOriginalGraph_ = this;
+  const size_t base = newGraph->vertices_.size();
+  newGraph->vertices_.reserve(base + vertices_.size());
   for (hip::GraphNode* entry : vertices_) {
     GraphNode* node = entry->clone();
     node->SetParentGraph(newGraph);
+    node->index_ = static_cast<uint32_t>(newGraph->vertices_.size());
     newGraph->vertices_.push_back(node);
-    newGraph->clonedNodes_[entry] = node;
   }
 
-  std::vector<Node> clonedEdges;
-  std::vector<Node> clonedDependencies;
-  for (auto node : vertices_) {
-    const std::vector<Node>& edges = node->GetEdges();
-    clonedEdges.clear();
-    for (auto edge : edges) {
-      clonedEdges.push_back(newGraph->clonedNodes_[edge]);
+  // The clones keep the dense indices of the original nodes, hence the edges and
+  // the dependencies are remapped without a lookup
+  for (size_t i = 0; i < vertices_.size(); ++i) {
+    GraphNode* node = newGraph->vertices_[base + i];
+    node->edges_.reserve(vertices_[i]->edges_.size());
+    for (auto edge : vertices_[i]->edges_) {
+      node->edges_.push_back(newGraph->vertices_[base + edge->index_]);
     }
-    newGraph->clonedNodes_[node]->SetEdges(clonedEdges);
-  }
-  for (auto node : vertices_) {
-    const std::vector<Node>& dependencies = node->GetDependencies();
-    clonedDependencies.clear();
-    for (auto dep : dependencies) {
-      clonedDependencies.push_back(newGraph->clonedNodes_[dep]);
+    node->dependencies_.reserve(vertices_[i]->dependencies_.size());
+    for (auto dep : vertices_[i]->dependencies_) {
+      node->dependencies_.push_back(newGraph->vertices_[base + dep->index_]);
     }
-    newGraph->clonedNodes_[node]->SetDependencies(clonedDependencies);
   }
   for (auto& userObj : graphUserObj_) {
     userObj.first->retain();
@@ -308,9 +492,6 @@ void Graph::clone(Graph* newGraph, bool cloneNodes) const {
     memcpy(&newGraph->roots_[0], &roots_[0], sizeof(Node) * roots_.size());
   }
   newGraph->memAllocNodePtrs_ = memAllocNodePtrs_;
-  if(!cloneNodes) {
-    newGraph->clonedNodes_.clear();
-  }
 }
 
 // ================================================================================================
@@ -320,6 +501,25 @@ Graph* Graph::clone() const {
   return newGraph;
 }
 
+// ================================================================================================
+Node Graph::GetClonedNode(const GraphNode* node) const {
+  if ((node == nullptr) || (pOriginalGraph_ == nullptr) ||
+      (node->parentGraph_ != pOriginalGraph_)) {
+    return nullptr;
+  }
+  // The clone keeps the index and the ID of the original node. The original graph could have
+  // been changed after the cloning, then search for the ID
+  if ((node->index_ < vertices_.size()) && (vertices_[node->index_]->GetID() == node->GetID())) {
+    return vertices_[node->index_];
+  }
+  for (auto clone : vertices_) {
+    if (clone->GetID() == node->GetID()) {
+      return clone;
+    }
+  }
+  return nullptr;
+}
+
 // ================================================================================================
 bool GraphExec::isGraphExecValid(GraphExec* pGraphExec) {
   amd::ScopedLock lock(graphExecSetLock_);
@@ -347,9 +547,143 @@ hipError_t GraphExec::CreateStreams(uint32_t num_streams) {
   return hipSuccess;
 }
 
+// ================================================================================================
+amd::Memory* Graph::AcquireSlotMemory(int32_t slot, hip::Stream* stream) {
+  MemSlot& mem_slot = mem_slots_[slot];
+  if (mem_slot.memory_ == nullptr) {
+    auto dptr = AllocateMemory(mem_slot.size_, stream, nullptr);
+    if (dptr == nullptr) {
+      return nullptr;
+    }
+    size_t offset = 0;
+    mem_slot.memory_ = getMemoryObject(dptr, offset);
+    // The physical object is tracked by the slot and mapped into VA of every node in the slot
+    amd::MemObjMap::RemoveMemObj(dptr);
+    ClPrint(amd::LOG_INFO, amd::LOG_MEM_POOL, "Graph memory slot %d allocate: %p, size: %zu",
+            slot, dptr, mem_slot.size_);
+  }
+  return mem_slot.memory_;
+}
+
+// ================================================================================================
+void Graph::ReleaseSlotMemory() {
+  for (auto& slot : mem_slots_) {
+    if (slot.memory_ != nullptr) {
+      auto device_id = slot.memory_->getUserData().deviceId;
+      if (!g_devices[device_id]->FreeMemory(slot.memory_, nullptr)) {
+        LogError("Memory didn't belong to any pool!");
+      }
+      slot.memory_ = nullptr;
+    }
+  }
+  mem_slots_.clear();
+}
+
+// ================================================================================================
+void GraphExec::PlanMemory() {
+  if (!HIP_MEM_POOL_USE_VM || !DEBUG_HIP_GRAPH_MEM_PLANNER ||
+      (flags_ & hipGraphInstantiateFlagAutoFreeOnLaunch)) {
+    return;
+  }
+  // Match the free nodes with the allocations. An allocation without a free node in the graph
+  // lives beyond the launch and keeps a dedicated memory
+  std::unordered_map<void*, GraphMemFreeNode*> free_nodes;
+  for (size_t i = 0; i < topoOrder_.size(); ++i) {
+    if (topoOrder_[i]->GetType() == hipGraphNodeTypeMemFree) {
+      void* dptr = nullptr;
+      static_cast<GraphMemFreeNode*>(topoOrder_[i])->GetParams(&dptr);
+      free_nodes[dptr] = static_cast<GraphMemFreeNode*>(topoOrder_[i]);
+    }
+  }
+  if (free_nodes.empty()) {
+    return;
+  }
+
+  // Nodes reachable from a free node, which means the nodes execute after the memory was freed.
+  // Topological order alone isn't enough, since the nodes on parallel streams can overlap
+  std::unordered_map<GraphMemFreeNode*, std::vector<bool>> reachable;
+  auto executes_after = [&](GraphMemFreeNode* free_node, Node node) {
+    auto it = reachable.find(free_node);
+    if (it == reachable.end()) {
+      std::vector<bool>& visited = reachable[free_node];
+      visited.resize(GetNodeCount(), false);
+      std::vector<Node> stack = {free_node};
+      while (!stack.empty()) {
+        Node current = stack.back();
+        stack.pop_back();
+        for (auto edge : current->GetEdges()) {
+          if (!visited[edge->index_]) {
+            visited[edge->index_] = true;
+            stack.push_back(edge);
+          }
+        }
+      }
+      it = reachable.find(free_node);
+    }
+    return it->second[node->index_];
+  };
+
+  // The slots are allocated from the memory pool of the graph device, which may not be current
+  const size_t granularity = device_->devices()[0]->info().virtualMemAllocGranularity_;
+  size_t unplanned_size = 0;
+  uint32_t num_nodes = 0;
+  // Greedy interval coloring in the topological order. A node joins the slot, which last node
+  // was freed before the node's allocation, with the best fit by size
+  for (auto node : topoOrder_) {
+    if (node->GetType() != hipGraphNodeTypeMemAlloc) {
+      continue;
+    }
+    auto alloc_node = static_cast<GraphMemAllocNode*>(node);
+    hipMemAllocNodeParams params;
+    alloc_node->GetParams(&params);
+    auto free_it = free_nodes.find(params.dptr);
+    if (free_it == free_nodes.end()) {
+      continue;
+    }
+    size_t size = amd::alignUp(params.bytesize, granularity);
+    int32_t best = -1;
+    for (int32_t i = 0; i < static_cast<int32_t>(mem_slots_.size()); ++i) {
+      if (!executes_after(mem_slots_[i].last_free_, node)) {
+        continue;
+      }
+      if (best == -1) {
+        best = i;
+        continue;
+      }
+      size_t best_size = mem_slots_[best].size_;
+      size_t slot_size = mem_slots_[i].size_;
+      bool fits = (slot_size >= size);
+      bool best_fits = (best_size >= size);
+      // Prefer the smallest slot, which fits the node, otherwise the largest slot to grow
+      if ((fits && (!best_fits || (slot_size < best_size))) ||
+          (!fits && !best_fits && (slot_size > best_size))) {
+        best = i;
+      }
+    }
+    if (best == -1) {
+      best = static_cast<int32_t>(mem_slots_.size());
+      mem_slots_.push_back(MemSlot());
+    }
+    mem_slots_[best].size_ = std::max(mem_slots_[best].size_, size);
+    mem_slots_[best].last_free_ = free_it->second;
+    alloc_node->SetMemSlot(best);
+    unplanned_size += size;
+    num_nodes++;
+  }
+
+  size_t planned_size = 0;
+  for (const auto& slot : mem_slots_) {
+    planned_size += slot.size_;
+  }
+  ClPrint(amd::LOG_INFO, amd::LOG_MEM_POOL, "Graph memory plan: %u nodes in %zu slots, "
+          "footprint %zu -> %zu bytes", num_nodes, mem_slots_.size(), unplanned_size,
+          planned_size);
+}
+
 // ================================================================================================
 hipError_t GraphExec::Init() {
   hipError_t status = hipSuccess;
+  PlanMemory();
   // create extra stream to avoid queue collision with the default execution stream
   if (max_streams_ > 1) {
     status = CreateStreams(max_streams_);
@@ -581,8 +915,9 @@ bool Graph::RunOneNode(Node node, bool wait) {
     uint32_t i = 0;
     // Execute the nodes in the edges list
     for (auto edge: node->GetEdges()) {
-      // Don't wait in the nodes, executed on the same streams and if it has just one dependency
-      bool wait = ((i < DEBUG_HIP_FORCE_GRAPH_QUEUES) ||
+      // Don't wait in the nodes, executed on the same streams and if it has just one dependency.
+      // Critical path scheduling doesn't follow the edge order, so the wait list is always built
+      bool wait = (DEBUG_HIP_GRAPH_CP_SCHEDULER || (i < DEBUG_HIP_FORCE_GRAPH_QUEUES) ||
                    (edge->GetDependencies().size() > 1)) ? true : false;
       // Execute the edge node
       if (!RunOneNode(edge, wait)) {
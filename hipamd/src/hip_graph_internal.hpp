@@ -20,6 +20,7 @@
 
 #pragma once
 #include <algorithm>
+#include <cstddef>
 #include <queue>
 #include <stack>
 #include <iostream>
@@ -46,6 +47,7 @@ class GraphNode;
 class GraphExec;
 class UserObject;
 class GraphKernelNode;
+class GraphMemFreeNode;
 typedef GraphNode* Node;
 
 class UserObject : public amd::ReferenceCountedObject {
@@ -189,6 +191,14 @@ class GraphKernelArgManager : public amd::ReferenceCountedObject,
   using KernelArgImpl = device::Settings::KernelArgImpl;
 };
 
+//! Estimated node costs in nanoseconds, used by the graph scheduler
+constexpr uint64_t kGraphNodeLaunchCost = 4000;     //!< Submission overhead of a single node
+constexpr uint64_t kGraphHostNodeCost = 50000;      //!< Host callback round trip
+constexpr uint64_t kGraphCrossStreamCost = 10000;   //!< Cross stream dependency (signal + wait)
+constexpr uint64_t kGraphKernelThreadsPerNs = 64;   //!< Approximate kernel thread throughput
+constexpr uint64_t kGraphCopyBytesPerNs = 20;       //!< Approximate copy bandwidth
+constexpr uint64_t kGraphFillBytesPerNs = 100;      //!< Approximate fill bandwidth
+
 class GraphNode : public hipGraphNodeDOTAttribute {
  public:
   GraphNode(hipGraphNodeType type, std::string style = "", std::string shape = "",
@@ -285,6 +295,8 @@ class GraphNode : public hipGraphNodeDOTAttribute {
   }
   /// Return node unique ID
   int GetID() const { return id_; }
+  /// Return the dense index of the node in the parent graph
+  uint32_t GetIndex() const { return index_; }
   /// Returns command for graph node
   virtual std::vector<amd::Command*>& GetCommands() { return commands_; }
   /// Returns graph node type
@@ -303,9 +315,7 @@ class GraphNode : public hipGraphNodeDOTAttribute {
   const std::vector<Node>& GetDependencies() const { return dependencies_; }
   /// Update graph node dependecies
   void SetDependencies(std::vector<Node>& dependencies) {
-    for (auto entry : dependencies) {
-      dependencies_.push_back(entry);
-    }
+    dependencies_.insert(dependencies_.end(), dependencies.begin(), dependencies.end());
   }
   /// Add graph node dependency
   void AddDependency(const Node& node) {
@@ -349,9 +359,7 @@ class GraphNode : public hipGraphNodeDOTAttribute {
   const std::vector<Node>& GetEdges() const { return edges_; }
   /// Updates graph node children
   void SetEdges(std::vector<Node>& edges) {
-    for (auto entry : edges) {
-      edges_.push_back(entry);
-    }
+    edges_.insert(edges_.end(), edges.begin(), edges.end());
   }
   /// Get topological sort of the nodes embedded as part of the graphnode(e.g. ChildGraph)
   virtual bool TopologicalOrder(std::vector<Node>& TopoOrder) { return true; }
@@ -396,12 +404,12 @@ class GraphNode : public hipGraphNodeDOTAttribute {
   }
   virtual void GenerateDOTNodeEdges(size_t graphId, std::ostream& fout,
                                     hipGraphDebugDotFlags flag) {
+    const std::string fromNodeName =
+        "graph_" + std::to_string(graphId) + "_node_" + std::to_string(GetID());
     for (auto node : edges_) {
-      std::string toNodeName =
-          "graph_" + std::to_string(graphId) + "_node_" + std::to_string(node->GetID());
-      std::string fromNodeName =
-          "graph_" + std::to_string(graphId) + "_node_" + std::to_string(GetID());
-      fout << "\"" << fromNodeName << "\" -> \"" << toNodeName << "\"" << std::endl;
+      // Don't flush the stream on every edge, the large graphs have many thousands of edges
+      fout << "\"" << fromNodeName << "\" -> \"graph_" << graphId << "_node_" << node->GetID()
+           << "\"\n";
     }
   }
   virtual std::string GetLabel(hipGraphDebugDotFlags flag) override {
@@ -409,6 +417,10 @@ class GraphNode : public hipGraphNodeDOTAttribute {
   }
   unsigned int GetEnabled() const { return isEnabled_; }
   void SetEnabled(unsigned int isEnabled) { isEnabled_ = isEnabled; }
+  /// Returns the estimated execution cost of the node in ns, used for the graph scheduling
+  virtual uint64_t GetCostEstimate() const {
+    return (type_ == hipGraphNodeTypeHost) ? kGraphHostNodeCost : kGraphNodeLaunchCost;
+  }
   // Returns true if capture is enabled for the current node.
   virtual bool GraphCaptureEnabled() {
     bool isGraphCapture = false;
@@ -439,6 +451,7 @@ class GraphNode : public hipGraphNodeDOTAttribute {
     if (DEBUG_HIP_GRAPH_DOT_PRINT) {
       out << "\nStreamId:" << stream_id_;
       out << "\nSignalIsRequired: " << ((signal_is_required_) ? "true" : "false");
+      out << "\nCost:" << GetCostEstimate() << " Priority:" << sched_priority_;
     }
     out << "\"";
     out << "];";
@@ -450,6 +463,7 @@ class GraphNode : public hipGraphNodeDOTAttribute {
   friend class GraphExec;
   hip::Stream* stream_ = nullptr;
   unsigned int id_;
+  uint32_t index_ = 0;  //!< Dense index of the node in the parent graph's vertices
   hipGraphNodeType type_;
   std::vector<amd::Command*> commands_;
   std::vector<Node> edges_;
@@ -459,6 +473,7 @@ class GraphNode : public hipGraphNodeDOTAttribute {
   size_t outDegree_;        //!< count of outgoing edges (@todo: remove, it's edges_.size())
   int32_t stream_id_ = -1;  //! Stream ID on which this node will be executed
   int32_t launch_id_ = -1;  //! Launch ID of this node in the entire graph execution sequence
+  uint64_t sched_priority_ = 0;  //! Longest cost path from this node to the graph exit
   static int nextID;
   Graph* parentGraph_;
   static std::unordered_set<GraphNode*> nodeSet_;
@@ -473,6 +488,29 @@ class GraphNode : public hipGraphNodeDOTAttribute {
   size_t kernargSegmentAlignment_ = 256;  //!< Kernel arg segment alignment
 };
 
+//! Compact topology of a graph. The nodes are identified by their dense index in the graph and
+//! the edges are stored in CSR (compressed sparse row) arrays, so the graph algorithms run in
+//! linear time over contiguous memory without per node hash lookups.
+struct GraphTopology {
+  std::vector<uint32_t> edge_offsets_;  //!< Start of the node's children, N + 1 entries
+  std::vector<uint32_t> edges_;         //!< Indices of the children
+  std::vector<uint32_t> dep_offsets_;   //!< Start of the node's dependencies, N + 1 entries
+  std::vector<uint32_t> deps_;          //!< Indices of the dependencies
+
+  //! Returns the number of nodes in the topology
+  uint32_t NumNodes() const {
+    return edge_offsets_.empty() ? 0 : static_cast<uint32_t>(edge_offsets_.size() - 1);
+  }
+  const uint32_t* EdgesBegin(uint32_t node) const { return edges_.data() + edge_offsets_[node]; }
+  const uint32_t* EdgesEnd(uint32_t node) const { return edges_.data() + edge_offsets_[node + 1]; }
+  const uint32_t* DepsBegin(uint32_t node) const { return deps_.data() + dep_offsets_[node]; }
+  const uint32_t* DepsEnd(uint32_t node) const { return deps_.data() + dep_offsets_[node + 1]; }
+  uint32_t InDegree(uint32_t node) const { return dep_offsets_[node + 1] - dep_offsets_[node]; }
+
+  //! Kahn's sort in the order of the node indices. Returns false on a cyclic graph
+  bool Sort(std::vector<uint32_t>& order) const;
+};
+
 class Graph {
  public:
   //!< Contains mem alloc dptrs whose corresponding free node is not added to the graph.
@@ -596,6 +634,9 @@ class Graph {
   //! Schedules all nodes in the graph into different streams
   void ScheduleNodes();
 
+  //! Schedules all nodes with critical path list scheduling. Returns false on a cyclic graph
+  bool ScheduleCriticalPath();
+
   //! Update streams for the graph execution
   void UpdateStreams(
     hip::Stream* launch_stream, //!< Launch stream from the application
@@ -617,11 +658,20 @@ class Graph {
 
   bool TopologicalOrder(std::vector<Node>& TopoOrder);
 
-  void clone(Graph* newGraph, bool cloneNodes = false) const;
+  //! Builds the compact topology of the graph from the node edges and dependencies
+  void BuildTopology(GraphTopology& topology) const;
+
+  void clone(Graph* newGraph) const;
   Graph* clone() const;
+  //! Returns the clone of a node from the original graph, nullptr if the clone doesn't have it
+  Node GetClonedNode(const GraphNode* node) const;
   void GenerateDOT(std::ostream& fout, hipGraphDebugDotFlags flag) {
     fout << "subgraph cluster_" << GetID() << " {" << std::endl;
-    fout << "label=\"graph_" << GetID() <<"\"graph[style=\"dashed\"];\n";
+    fout << "label=\"graph_" << GetID();
+    if (DEBUG_HIP_GRAPH_DOT_PRINT) {
+      fout << "\nStreams:" << max_streams_ << " CriticalPath:" << critical_path_cost_;
+    }
+    fout << "\"graph[style=\"dashed\"];\n";
     for (auto node : vertices_) {
       node->GenerateDOTNode(GetID(), fout, flag);
     }
@@ -691,6 +741,22 @@ class Graph {
     mem_pool_->FreeAllMemory(stream);
   }
 
+  //! Returns physical memory of the planned slot, allocates it on the first call
+  amd::Memory* AcquireSlotMemory(int32_t slot, hip::Stream* stream);
+
+  //! Returns true if the physical memory belongs to a planned slot
+  bool IsSlotMemory(const amd::Memory* memory) const {
+    for (const auto& slot : mem_slots_) {
+      if (slot.memory_ == memory) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  //! Releases physical memory of all planned slots back to the graph memory pool
+  void ReleaseSlotMemory();
+
   bool IsGraphInstantiated() const {
     return graphInstantiated_;
   }
@@ -710,6 +776,15 @@ class Graph {
 
  protected:
   int max_streams_ = 0;  //!< Maximum number of streams used in the graph launch
+  uint64_t critical_path_cost_ = 0;  //!< Estimated cost of the graph critical path
+
+  //! Physical memory, shared by the mem alloc nodes with disjoint lifetimes
+  struct MemSlot {
+    size_t size_ = 0;                        //!< Slot size, the largest node in the slot
+    amd::Memory* memory_ = nullptr;          //!< Physical memory, allocated on the first launch
+    GraphMemFreeNode* last_free_ = nullptr;  //!< Free node of the last node in the slot
+  };
+  std::vector<MemSlot> mem_slots_;  //!< Memory slots, assigned by the graph memory planner
 
  private:
   friend class GraphExec;
@@ -731,7 +806,6 @@ class Graph {
   hip::MemoryPool* mem_pool_;          //!< Memory pool, associated with this graph
   std::unordered_set<GraphNode*> capturedNodes_;
   bool graphInstantiated_;
-  std::unordered_map<Node, Node> clonedNodes_;
 };
 
 class GraphExec : public amd::ReferenceCountedObject, public Graph {
@@ -745,6 +819,7 @@ class GraphExec : public amd::ReferenceCountedObject, public Graph {
   }
 
   ~GraphExec() {
+    ReleaseSlotMemory();
     for (auto stream : parallel_streams_) {
       if (stream != nullptr) {
         constexpr bool kForceDestroy = true;
@@ -761,16 +836,6 @@ class GraphExec : public amd::ReferenceCountedObject, public Graph {
     }
   }
 
-  Node GetClonedNode(Node node) {
-    Node clonedNode;
-    if (clonedNodes_.find(node) == clonedNodes_.end()) {
-      return nullptr;
-    } else {
-      clonedNode = clonedNodes_[node];
-    }
-    return clonedNode;
-  }
-
   //! Check if kernel node has hidden heap
   bool HasHiddenHeap() const { return hasHiddenHeap_; }
   //! Graph has nodes that require hidden heap.
@@ -781,6 +846,8 @@ class GraphExec : public amd::ReferenceCountedObject, public Graph {
   std::vector<Node>& GetNodes() { return topoOrder_; }
   uint64_t GetFlags() const { return flags_; }
   hipError_t Init();
+  //! Assigns mem alloc nodes with disjoint lifetimes to shared physical memory slots
+  void PlanMemory();
   hipError_t CreateStreams(uint32_t num_streams);
   hipError_t Run(hipStream_t stream);
   // Capture GPU Packets from graph commands
@@ -879,6 +946,11 @@ class ChildGraphNode : public GraphNode, public GraphExec {
     return std::to_string(GraphNode::GetID()) + "\n" + "graph_" + std::to_string(Graph::GetID());
   }
 
+  uint64_t GetCostEstimate() const override {
+    // The child graph is scheduled before the parent, hence its critical path is known
+    return std::max(critical_path_cost_, kGraphNodeLaunchCost);
+  }
+
   virtual void GenerateDOT(std::ostream& fout, hipGraphDebugDotFlags flag) override {
     Graph::GenerateDOT(fout, flag);
   }
@@ -898,6 +970,12 @@ class GraphKernelNode : public GraphNode {
 
  public:
   bool HasHiddenHeap() const { return hasHiddenHeap_; }
+  uint64_t GetCostEstimate() const override {
+    uint64_t threads = static_cast<uint64_t>(kernelParams_.gridDim.x) *
+        kernelParams_.gridDim.y * kernelParams_.gridDim.z * kernelParams_.blockDim.x *
+        kernelParams_.blockDim.y * kernelParams_.blockDim.z;
+    return kGraphNodeLaunchCost + threads / kGraphKernelThreadsPerNs;
+  }
   void EnqueueCommands(hip::Stream* stream) override {
     // If the node is disabled it becomes empty node. To maintain ordering just enqueue marker.
     // Node can be enabled/disabled only for kernel, memcpy and memset nodes.
@@ -940,6 +1018,7 @@ class GraphKernelNode : public GraphNode {
     if (DEBUG_HIP_GRAPH_DOT_PRINT) {
       out << "StreamId:" << stream_id_;
       out << "\nSignalIsRequired: " << ((signal_is_required_) ? "true" : "false");
+      out << "\nCost:" << GetCostEstimate() << " Priority:" << sched_priority_;
     }
     out << "\"";
     out << "];";
@@ -1014,9 +1093,11 @@ class GraphKernelNode : public GraphNode {
     return func;
   }
 
-  hipError_t copyParams(const hipKernelNodeParams* pNodeParams) {
+  hipError_t copyParams(const hipKernelNodeParams* pNodeParams, hipFunction_t func = nullptr) {
     hasHiddenHeap_ = false;
-    hipFunction_t func = getFunc(*pNodeParams, ihipGetDevice());
+    if (func == nullptr) {
+      func = getFunc(*pNodeParams, ihipGetDevice());
+    }
     if (!func) {
       return hipErrorInvalidDeviceFunction;
     }
@@ -1025,6 +1106,9 @@ class GraphKernelNode : public GraphNode {
     if (DEBUG_CLR_GRAPH_PACKET_CAPTURE) {
       auto device = g_devices[ihipGetDevice()]->devices()[0];
       device::Kernel* devKernel = const_cast<device::Kernel*>(kernel->getDeviceKernel(*device));
+      if (devKernel == nullptr) {
+        return hipErrorInvalidDeviceFunction;
+      }
       kernargSegmentByteSize_ = devKernel->KernargSegmentByteSize();
       kernargSegmentAlignment_ = devKernel->KernargSegmentAlignment();
       alignedKernArgSize_ =
@@ -1038,18 +1122,25 @@ class GraphKernelNode : public GraphNode {
 
     // Allocate/assign memory if params are passed part of 'kernelParams'
     if (pNodeParams->kernelParams != nullptr) {
-      kernelParams_.kernelParams = (void**)malloc(numParams_ * sizeof(void*));
+      // The pointers and the values of all arguments share a single allocation, since
+      // the captured graphs have many thousands of kernel nodes
+      constexpr size_t kArgAlignment = alignof(std::max_align_t);
+      size_t size = amd::alignUp(numParams_ * sizeof(void*), kArgAlignment);
+      for (uint32_t i = 0; i < numParams_; ++i) {
+        size += amd::alignUp(signature.at(i).size_, kArgAlignment);
+      }
+      kernelParams_.kernelParams = (void**)malloc(std::max(size, kArgAlignment));
       if (kernelParams_.kernelParams == nullptr) {
         return hipErrorOutOfMemory;
       }
 
+      char* value = reinterpret_cast<char*>(kernelParams_.kernelParams) +
+          amd::alignUp(numParams_ * sizeof(void*), kArgAlignment);
       for (uint32_t i = 0; i < numParams_; ++i) {
         const amd::KernelParameterDescriptor& desc = signature.at(i);
-        kernelParams_.kernelParams[i] = malloc(desc.size_);
-        if (kernelParams_.kernelParams[i] == nullptr) {
-          return hipErrorOutOfMemory;
-        }
+        kernelParams_.kernelParams[i] = value;
         ::memcpy(kernelParams_.kernelParams[i], (pNodeParams->kernelParams[i]), desc.size_);
+        value += amd::alignUp(desc.size_, kArgAlignment);
       }
       for (uint32_t i = signature.numParameters(); i < signature.numParametersAll(); ++i) {
         if (signature.at(i).info_.oclObject_ == amd::KernelParameterDescriptor::HiddenHeap) {
@@ -1064,22 +1155,17 @@ class GraphKernelNode : public GraphNode {
       // HIP_LAUNCH_PARAM_BUFFER_POINTER, kernargs,
       // HIP_LAUNCH_PARAM_BUFFER_SIZE, &kernargs_size,
       // HIP_LAUNCH_PARAM_END }
-      unsigned int numExtra = 5;
-      kernelParams_.extra = (void**)malloc(numExtra * sizeof(void*));
+      // The struct, the size and the kernargs share a single allocation
+      constexpr unsigned int kNumExtra = 6;  // 5 items and the kernargs size
+      size_t kernargs_size = *((size_t*)pNodeParams->extra[3]);
+      kernelParams_.extra = (void**)malloc(kNumExtra * sizeof(void*) + kernargs_size);
       if (kernelParams_.extra == nullptr) {
         return hipErrorOutOfMemory;
       }
       kernelParams_.extra[0] = pNodeParams->extra[0];
-      size_t kernargs_size = *((size_t*)pNodeParams->extra[3]);
-      kernelParams_.extra[1] = malloc(kernargs_size);
-      if (kernelParams_.extra[1] == nullptr) {
-        return hipErrorOutOfMemory;
-      }
+      kernelParams_.extra[1] = &kernelParams_.extra[kNumExtra];
       kernelParams_.extra[2] = pNodeParams->extra[2];
-      kernelParams_.extra[3] = malloc(sizeof(void*));
-      if (kernelParams_.extra[3] == nullptr) {
-        return hipErrorOutOfMemory;
-      }
+      kernelParams_.extra[3] = &kernelParams_.extra[kNumExtra - 1];
       *((size_t*)kernelParams_.extra[3]) = kernargs_size;
       ::memcpy(kernelParams_.extra[1], (pNodeParams->extra[1]), kernargs_size);
       kernelParams_.extra[4] = pNodeParams->extra[4];
@@ -1088,13 +1174,13 @@ class GraphKernelNode : public GraphNode {
   }
 
   GraphKernelNode(const hipKernelNodeParams* pNodeParams, const ihipExtKernelEvents* pEvents,
-                  int coopKernel = 0)
+                  int coopKernel = 0, hipFunction_t func = nullptr)
       : GraphNode(hipGraphNodeTypeKernel, "bold", "octagon", "KERNEL") {
     kernelEvents_ = { 0 };
     if (pEvents != nullptr) {
       kernelEvents_ = *pEvents;
     }
-    if (copyParams(pNodeParams) != hipSuccess) {
+    if (copyParams(pNodeParams, func) != hipSuccess) {
       ClPrint(amd::LOG_ERROR, amd::LOG_CODE, "[hipGraph] Failed to copy params");
     }
     memset(&kernelAttr_, 0, sizeof(kernelAttr_));
@@ -1106,22 +1192,14 @@ class GraphKernelNode : public GraphNode {
   ~GraphKernelNode() { freeParams(); }
 
   void freeParams() {
-    // Deallocate memory allocated for kernargs passed via 'kernelParams'
+    // Deallocate memory allocated for kernargs passed via 'kernelParams', the values
+    // are in the same allocation
     if (kernelParams_.kernelParams != nullptr) {
-      for (size_t i = 0; i < numParams_; ++i) {
-        if (kernelParams_.kernelParams[i] != nullptr) {
-          free(kernelParams_.kernelParams[i]);
-        }
-        kernelParams_.kernelParams[i] = nullptr;
-      }
       free(kernelParams_.kernelParams);
       kernelParams_.kernelParams = nullptr;
     }
     // Deallocate memory allocated for kernargs passed via 'extra'
     else if (kernelParams_.extra != nullptr) {
-      free(kernelParams_.extra[1]);
-      free(kernelParams_.extra[3]);
-      memset(kernelParams_.extra, 0, 5 * sizeof(kernelParams_.extra[0]));  // 5 items
       free(kernelParams_.extra);
       kernelParams_.extra = nullptr;
     }
@@ -1393,6 +1471,11 @@ class GraphMemcpyNode : public GraphNode {
 
   virtual hipMemcpyKind GetMemcpyKind() const { return copyParams_.kind; };
 
+  uint64_t GetCostEstimate() const override {
+    return kGraphNodeLaunchCost + (copyParams_.extent.width * copyParams_.extent.height *
+                                   copyParams_.extent.depth) / kGraphCopyBytesPerNs;
+  }
+
   hipError_t SetParams(const hipMemcpy3DParms* params) {
     hipError_t status = ValidateParams(params);
     if (status != hipSuccess) {
@@ -1533,6 +1616,10 @@ class GraphMemcpyNode1D : public GraphMemcpyNode {
 
   GraphNode* clone() const override { return new GraphMemcpyNode1D(*this); }
 
+  uint64_t GetCostEstimate() const override {
+    return kGraphNodeLaunchCost + count_ / kGraphCopyBytesPerNs;
+  }
+
   virtual hipError_t CreateCommand(hip::Stream* stream) override {
     if ((kind_ == hipMemcpyHostToHost || kind_ == hipMemcpyDefault) && IsHtoHMemcpy(dst_, src_)) {
       return hipSuccess;
@@ -1938,6 +2025,14 @@ class GraphMemsetNode : public GraphNode {
 
   GraphNode* clone() const override { return new GraphMemsetNode(*this); }
 
+  uint64_t GetCostEstimate() const override {
+    size_t sizeBytes = memsetParams_.width * memsetParams_.elementSize;
+    if (memsetParams_.height != 1) {
+      sizeBytes *= memsetParams_.height * depth_;
+    }
+    return kGraphNodeLaunchCost + sizeBytes / kGraphFillBytesPerNs;
+  }
+
   virtual std::string GetLabel(hipGraphDebugDotFlags flag) override {
     std::string label;
     if (flag == hipGraphDebugDotFlagsMemsetNodeParams || flag == hipGraphDebugDotFlagsVerbose) {
@@ -2299,15 +2394,17 @@ class GraphEmptyNode : public GraphNode {
 class GraphMemAllocNode final : public GraphNode {
   hipMemAllocNodeParams node_params_;  // Node parameters for memory allocation
   amd::Memory* va_ = nullptr;         // Memory object, which holds a virtual address
+  int32_t mem_slot_ = -1;             // Memory slot, assigned by the graph memory planner
 
   // Derive the new class for VirtualMapCommand,
   // so runtime can allocate memory during the execution of command
   class VirtualMemAllocNode : public amd::VirtualMapCommand {
    public:
     VirtualMemAllocNode(amd::HostQueue& queue, const amd::Event::EventWaitList& eventWaitList,
-                        amd::Memory* va, size_t size, amd::Memory* memory, Graph* graph)
+                        amd::Memory* va, size_t size, amd::Memory* memory, Graph* graph,
+                        int32_t mem_slot)
         : VirtualMapCommand(queue, eventWaitList, va->getSvmPtr(), size, memory),
-          va_(va), graph_(graph) {}
+          va_(va), graph_(graph), mem_slot_(mem_slot) {}
 
     virtual void submit(device::VirtualDevice& device) final {
       // Remove VA reference from the global mapping. Runtime has to keep a dummy reference for
@@ -2321,23 +2418,33 @@ class GraphMemAllocNode final : public GraphNode {
       // Allocate real memory for mapping
       const auto& dev_info = queue()->device().info();
       auto aligned_size = amd::alignUp(size_, dev_info.virtualMemAllocGranularity_);
-      auto dptr = graph_->AllocateMemory(aligned_size, static_cast<hip::Stream*>(queue()), nullptr);
-      if (dptr == nullptr) {
+      amd::Memory* memory = nullptr;
+      if (mem_slot_ >= 0) {
+        // The memory planner assigned a slot, shared with the nodes of disjoint lifetimes
+        memory = graph_->AcquireSlotMemory(mem_slot_, static_cast<hip::Stream*>(queue()));
+      } else {
+        auto dptr =
+            graph_->AllocateMemory(aligned_size, static_cast<hip::Stream*>(queue()), nullptr);
+        if (dptr != nullptr) {
+          size_t offset = 0;
+          // Get memory object associated with the real allocation
+          memory = getMemoryObject(dptr, offset);
+          // Remove because the entry is not needed in MemObjMap after the memory_ has been
+          // saved. The Phy mem obj will be saved in virtual memory object during
+          // VirtualMapCommand::submit.
+          amd::MemObjMap::RemoveMemObj(dptr);
+        }
+      }
+      if (memory == nullptr) {
         setStatus(CL_INVALID_OPERATION);
         if (!AMD_DIRECT_DISPATCH) {
           WorkerThreadLock_.unlock();
         }
         return;
       }
-      size_t offset = 0;
-      // Get memory object associated with the real allocation
-      memory_ = getMemoryObject(dptr, offset);
+      memory_ = memory;
       // Retain memory object because command release will release it
       memory_->retain();
-
-      // Remove because the entry is not needed in MemObjMap after the memory_ has been saved.
-      // The Phy mem obj will be saved in virtual memory object during VirtualMapCommand::submit.
-      amd::MemObjMap::RemoveMemObj(dptr);
       size_ = aligned_size;
       // Execute the original mapping command
       VirtualMapCommand::submit(device);
@@ -2358,6 +2465,7 @@ class GraphMemAllocNode final : public GraphNode {
    private:
     amd::Memory* va_;   // Memory object with the new virtual address for mapping
     Graph* graph_;  // Graph which allocates/maps memory
+    int32_t mem_slot_;  // Planned memory slot in the graph or -1 for a dedicated allocation
   };
 
  public:
@@ -2402,7 +2510,7 @@ class GraphMemAllocNode final : public GraphNode {
         stream->GetDevice()->GetGraphMemoryPool()->SetGraphInUse();
         // Create command for memory mapping
         auto cmd = new VirtualMemAllocNode(*stream, amd::Event::EventWaitList{},
-            va_, node_params_.bytesize, nullptr, graph);
+            va_, node_params_.bytesize, nullptr, graph, mem_slot_);
         commands_.push_back(cmd);
         size_t offset = 0;
         // Check if memory was already added after first reserve
@@ -2456,6 +2564,10 @@ class GraphMemAllocNode final : public GraphNode {
   void GetParams(hipMemAllocNodeParams* params) const {
     std::memcpy(params, &node_params_, sizeof(hipMemAllocNodeParams));
   }
+
+  //! Returns the planned memory slot or -1 for a dedicated allocation
+  int32_t GetMemSlot() const { return mem_slot_; }
+  void SetMemSlot(int32_t slot) { mem_slot_ = slot; }
 };
 
 // ================================================================================================
@@ -2487,10 +2599,13 @@ class GraphMemFreeNode : public GraphNode {
       // Free virtual address
       vaddr_sub_obj->release();
       vaddr_mem_obj->release();
-      // Release the allocation back to graph's pool
-      auto device_id = phys_mem_obj->getUserData().deviceId;
-      if (!g_devices[device_id]->FreeMemory(phys_mem_obj, static_cast<hip::Stream*>(queue()))) {
-        LogError("Memory didn't belong to any pool!");
+      // Release the allocation back to graph's pool. Planned slots keep memory for the next
+      // node in the slot and the next launch
+      if (!graph_->IsSlotMemory(phys_mem_obj)) {
+        auto device_id = phys_mem_obj->getUserData().deviceId;
+        if (!g_devices[device_id]->FreeMemory(phys_mem_obj, static_cast<hip::Stream*>(queue()))) {
+          LogError("Memory didn't belong to any pool!");
+        }
       }
       amd::MemObjMap::AddMemObj(ptr(), vaddr_mem_obj);
       graph_->DecrementMemAllocNodeCount(); // Decrement count of unreleased memalloc nodes
@@ -19,8 +19,10 @@
  THE SOFTWARE. */
 
 #include <hip/hip_runtime.h>
+#include <hip/amd_detail/amd_hip_mem_batch.h>
 #include "hip_internal.hpp"
 #include "hip_conversions.hpp"
+#include "hip_mem_range.hpp"
 #include "platform/context.hpp"
 #include "platform/command.hpp"
 #include "platform/memory.hpp"
@@ -74,52 +76,70 @@ hipError_t hipMallocManaged(void** dev_ptr, size_t size, unsigned int flags) {
 }
 
 // ================================================================================================
-hipError_t hipMemPrefetchAsync(const void* dev_ptr, size_t count, int device,
-                               hipStream_t stream) {
-  HIP_INIT_API(hipMemPrefetchAsync, dev_ptr, count, device, stream);
-
+// Validates a prefetch range and selects the stream and the destination for it
+static hipError_t ihipMemPrefetchTarget(const void* dev_ptr, size_t count, int device,
+                                        hipStream_t stream, hip::Stream** hip_stream,
+                                        amd::Device** dev, amd::Memory** mem) {
   if ((dev_ptr == nullptr) || (count == 0)) {
-    HIP_RETURN(hipErrorInvalidValue);
-  }
-
-  if (!hip::isValid(stream)) {
-    HIP_RETURN(hipErrorContextIsDestroyed);
+    return hipErrorInvalidValue;
   }
 
   size_t offset = 0;
   amd::Memory* memObj = getMemoryObject(dev_ptr, offset);
 
   if ((memObj != nullptr) && (count  > (memObj->getSize() - offset))) {
-    HIP_RETURN(hipErrorInvalidValue);
+    return hipErrorInvalidValue;
   }
   if (device != hipCpuDeviceId && (static_cast<size_t>(device) >= g_devices.size())) {
-    HIP_RETURN(hipErrorInvalidDevice);
+    return hipErrorInvalidDevice;
   }
 
-  hip::Stream* hip_stream = nullptr;
-  amd::Device* dev = nullptr;
-  bool cpu_access = false;
-
   if ((memObj == nullptr) && (device != hipCpuDeviceId) &&
       (!g_devices[device]->devices()[0]->info().hmmCpuMemoryAccessible_)) {
-    HIP_RETURN(hipErrorNotSupported);
+    return hipErrorNotSupported;
   }
 
   // Pick the specified stream or Null one from the provided device
+  *dev = nullptr;
   if (device == hipCpuDeviceId) {
-    cpu_access = true;
-    hip_stream = (stream == nullptr || stream == hipStreamLegacy) ?
+    *hip_stream = (stream == nullptr || stream == hipStreamLegacy) ?
                   hip::getCurrentDevice()->NullStream() : hip::getStream(stream);
   } else {
-    dev = g_devices[device]->devices()[0];
-    hip_stream = (stream == nullptr || stream == hipStreamLegacy) ?
+    *dev = g_devices[device]->devices()[0];
+    *hip_stream = (stream == nullptr || stream == hipStreamLegacy) ?
                   g_devices[device]->NullStream() : hip::getStream(stream);
   }
 
-  if (hip_stream == nullptr) {
+  if (*hip_stream == nullptr) {
+    return hipErrorInvalidValue;
+  }
+  *mem = memObj;
+  return hipSuccess;
+}
+
+// ================================================================================================
+hipError_t hipMemPrefetchAsync(const void* dev_ptr, size_t count, int device,
+                               hipStream_t stream) {
+  HIP_INIT_API(hipMemPrefetchAsync, dev_ptr, count, device, stream);
+
+  if ((dev_ptr == nullptr) || (count == 0)) {
     HIP_RETURN(hipErrorInvalidValue);
   }
 
+  if (!hip::isValid(stream)) {
+    HIP_RETURN(hipErrorContextIsDestroyed);
+  }
+
+  hip::Stream* hip_stream = nullptr;
+  amd::Device* dev = nullptr;
+  amd::Memory* memObj = nullptr;
+  hipError_t status = ihipMemPrefetchTarget(dev_ptr, count, device, stream, &hip_stream, &dev,
+                                            &memObj);
+  if (status != hipSuccess) {
+    HIP_RETURN(status);
+  }
+  bool cpu_access = (device == hipCpuDeviceId);
+
   amd::Command::EventWaitList waitList;
   amd::SvmPrefetchAsyncCommand* command =
       new amd::SvmPrefetchAsyncCommand(*hip_stream, waitList, dev_ptr, count, dev, cpu_access);
@@ -134,29 +154,43 @@ hipError_t hipMemPrefetchAsync(const void* dev_ptr, size_t count, int device,
 }
 
 // ================================================================================================
-hipError_t hipMemAdvise(const void* dev_ptr, size_t count, hipMemoryAdvise advice, int device) {
-  HIP_INIT_API(hipMemAdvise, dev_ptr, count, advice, device);
-
+// Validates an advise range and selects the device for it
+static hipError_t ihipMemAdviseTarget(const void* dev_ptr, size_t count, hipMemoryAdvise advice,
+                                      int device, amd::Device** dev, amd::Memory** mem) {
   bool isAdviseReadMostly = (advice == hipMemAdviseSetReadMostly) ||
                             (advice == hipMemAdviseUnsetReadMostly);
 
   if (!isAdviseReadMostly && ((device != hipCpuDeviceId) &&
       (static_cast<size_t>(device) >= g_devices.size()))) {
-    HIP_RETURN(hipErrorInvalidDevice);
+    return hipErrorInvalidDevice;
   }
 
   if ((dev_ptr == nullptr) || (count == 0)) {
-    HIP_RETURN(hipErrorInvalidValue);
+    return hipErrorInvalidValue;
   }
 
   size_t offset = 0;
   amd::Memory* memObj = getMemoryObject(dev_ptr, offset);
   if (memObj && count > (memObj->getSize() - offset)) {
-    HIP_RETURN(hipErrorInvalidValue);
+    return hipErrorInvalidValue;
   }
 
-  amd::Device* dev = (device == hipCpuDeviceId || isAdviseReadMostly) ?
+  *dev = (device == hipCpuDeviceId || isAdviseReadMostly) ?
     g_devices[0]->devices()[0] : g_devices[device]->devices()[0];
+  *mem = memObj;
+  return hipSuccess;
+}
+
+// ================================================================================================
+hipError_t hipMemAdvise(const void* dev_ptr, size_t count, hipMemoryAdvise advice, int device) {
+  HIP_INIT_API(hipMemAdvise, dev_ptr, count, advice, device);
+
+  amd::Device* dev = nullptr;
+  amd::Memory* memObj = nullptr;
+  hipError_t status = ihipMemAdviseTarget(dev_ptr, count, advice, device, &dev, &memObj);
+  if (status != hipSuccess) {
+    HIP_RETURN(status);
+  }
   bool use_cpu = (device == hipCpuDeviceId) ? true : false;
 
   // Set the allocation attributes in AMD HMM
@@ -167,6 +201,141 @@ hipError_t hipMemAdvise(const void* dev_ptr, size_t count, hipMemoryAdvise advic
   HIP_RETURN(hipSuccess);
 }
 
+// ================================================================================================
+// Destination of a batched prefetch. The allocation is a part of the key, because a prefetch
+// or an advise can't cross the allocation boundary
+struct PrefetchKey {
+  hip::Stream* stream_;
+  amd::Device* dev_;
+  bool cpu_access_;
+  amd::Memory* mem_;
+  bool operator==(const PrefetchKey& key) const {
+    return (stream_ == key.stream_) && (dev_ == key.dev_) && (cpu_access_ == key.cpu_access_) &&
+           (mem_ == key.mem_);
+  }
+};
+
+// ================================================================================================
+hipError_t hipExtMemPrefetchBatchAsync(const void* const* dev_ptrs, const size_t* counts,
+                                       const int* devices, size_t num_ranges,
+                                       hipStream_t stream) {
+  HIP_INIT_API(hipExtMemPrefetchBatchAsync, dev_ptrs, counts, devices, num_ranges, stream);
+
+  if ((dev_ptrs == nullptr) || (counts == nullptr) || (devices == nullptr) ||
+      (num_ranges == 0)) {
+    HIP_RETURN(hipErrorInvalidValue);
+  }
+
+  if (!hip::isValid(stream)) {
+    HIP_RETURN(hipErrorContextIsDestroyed);
+  }
+
+  // Validate the whole batch before any prefetch is issued
+  MemRangeCoalescer<PrefetchKey> coalescer;
+  for (size_t i = 0; i < num_ranges; ++i) {
+    PrefetchKey key = {};
+    hipError_t status = ihipMemPrefetchTarget(dev_ptrs[i], counts[i], devices[i], stream,
+                                              &key.stream_, &key.dev_, &key.mem_);
+    if (status != hipSuccess) {
+      HIP_RETURN(status);
+    }
+    key.cpu_access_ = (devices[i] == hipCpuDeviceId);
+    coalescer.Add(reinterpret_cast<uintptr_t>(dev_ptrs[i]), counts[i], key);
+  }
+  std::vector<MemRange<PrefetchKey>> ranges = coalescer.Finish();
+  ClPrint(amd::LOG_INFO, amd::LOG_API, "Prefetch batch of %zu ranges coalesced into %zu ranges",
+          num_ranges, ranges.size());
+
+  // A single command per epoch and destination prefetches all its ranges
+  amd::Command::EventWaitList waitList;
+  for (size_t first = 0; first < ranges.size(); ) {
+    size_t last = first;
+    while ((last < ranges.size()) && (ranges[last].epoch_ == ranges[first].epoch_)) {
+      ++last;
+    }
+    std::vector<bool> issued(last - first, false);
+    for (size_t i = first; i < last; ++i) {
+      if (issued[i - first]) {
+        continue;
+      }
+      const PrefetchKey& key = ranges[i].key_;
+      std::vector<amd::SvmPrefetchAsyncCommand::Range> command_ranges;
+      for (size_t j = i; j < last; ++j) {
+        const PrefetchKey& other = ranges[j].key_;
+        if (!issued[j - first] && (other.stream_ == key.stream_) && (other.dev_ == key.dev_) &&
+            (other.cpu_access_ == key.cpu_access_)) {
+          command_ranges.push_back(amd::SvmPrefetchAsyncCommand::Range(
+              reinterpret_cast<const void*>(ranges[j].start_),
+              ranges[j].end_ - ranges[j].start_));
+          issued[j - first] = true;
+        }
+      }
+      amd::SvmPrefetchAsyncCommand* command = new amd::SvmPrefetchAsyncCommand(
+          *key.stream_, waitList, std::move(command_ranges), key.dev_, key.cpu_access_);
+      if (command == nullptr) {
+        HIP_RETURN(hipErrorOutOfMemory);
+      }
+      command->enqueue();
+      command->release();
+    }
+    first = last;
+  }
+
+  HIP_RETURN(hipSuccess);
+}
+
+// ================================================================================================
+// Advice of a batched advise
+struct AdviseKey {
+  amd::Device* dev_;
+  hipMemoryAdvise advice_;
+  bool use_cpu_;
+  amd::Memory* mem_;
+  bool operator==(const AdviseKey& key) const {
+    return (dev_ == key.dev_) && (advice_ == key.advice_) && (use_cpu_ == key.use_cpu_) &&
+           (mem_ == key.mem_);
+  }
+};
+
+// ================================================================================================
+hipError_t hipExtMemAdviseBatch(const void* const* dev_ptrs, const size_t* counts,
+                                const hipMemoryAdvise* advice, const int* devices,
+                                size_t num_ranges) {
+  HIP_INIT_API(hipExtMemAdviseBatch, dev_ptrs, counts, advice, devices, num_ranges);
+
+  if ((dev_ptrs == nullptr) || (counts == nullptr) || (advice == nullptr) ||
+      (devices == nullptr) || (num_ranges == 0)) {
+    HIP_RETURN(hipErrorInvalidValue);
+  }
+
+  MemRangeCoalescer<AdviseKey> coalescer;
+  for (size_t i = 0; i < num_ranges; ++i) {
+    AdviseKey key = {};
+    hipError_t status = ihipMemAdviseTarget(dev_ptrs[i], counts[i], advice[i], devices[i],
+                                            &key.dev_, &key.mem_);
+    if (status != hipSuccess) {
+      HIP_RETURN(status);
+    }
+    key.advice_ = advice[i];
+    key.use_cpu_ = (devices[i] == hipCpuDeviceId);
+    coalescer.Add(reinterpret_cast<uintptr_t>(dev_ptrs[i]), counts[i], key);
+  }
+  std::vector<MemRange<AdviseKey>> ranges = coalescer.Finish();
+  ClPrint(amd::LOG_INFO, amd::LOG_API, "Advise batch of %zu ranges coalesced into %zu ranges",
+          num_ranges, ranges.size());
+
+  for (const auto& range : ranges) {
+    if (!range.key_.dev_->SetSvmAttributes(reinterpret_cast<const void*>(range.start_),
+                                           range.end_ - range.start_,
+                                           static_cast<amd::MemoryAdvice>(range.key_.advice_),
+                                           range.key_.use_cpu_)) {
+      HIP_RETURN(hipErrorInvalidValue);
+    }
+  }
+
+  HIP_RETURN(hipSuccess);
+}
+
 // ================================================================================================
 hipError_t hipMemRangeGetAttribute(void* data, size_t data_size, hipMemRangeAttribute attribute,
                                    const void* dev_ptr, size_t count) {
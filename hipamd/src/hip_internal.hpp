@@ -23,6 +23,7 @@
 
 #include "vdi_common.hpp"
 #include "hip_prof_api.h"
+#include "hip_api_stats.hpp"
 #include "trace_helper.h"
 #include "rocclr/utils/debug.hpp"
 #include "hip_formatting.hpp"
@@ -155,6 +156,7 @@ const char* ihipGetErrorName(hipError_t hip_error);
   }                                                                                                \
   HIP_INIT(noReturn)                                                                               \
   HIP_API_PRINT(__VA_ARGS__)                                                                       \
+  HIP_API_STATS_OBJECT(cid)                                                                        \
   HIP_CB_SPAWNER_OBJECT(cid);
 
 // This macro should be called at the beginning of every HIP API.
@@ -169,6 +171,7 @@ const char* ihipGetErrorName(hipError_t hip_error);
 
 #define HIP_RETURN_DURATION(ret, ...)                                                              \
   hip::tls.last_command_error_ = ret;                                                              \
+  hip::tls.api_status_ = hip::tls.last_command_error_;                                             \
   if (DEBUG_HIP_7_PREVIEW & amd::CHANGE_HIP_GET_LAST_ERROR) {                                      \
     if (hip::tls.last_command_error_ != hipSuccess &&                                              \
            hip::tls.last_command_error_ != hipErrorNotReady) {                                     \
@@ -184,6 +187,7 @@ const char* ihipGetErrorName(hipError_t hip_error);
 
 #define HIP_RETURN(ret, ...)                                                                       \
   hip::tls.last_command_error_ = ret;                                                              \
+  hip::tls.api_status_ = hip::tls.last_command_error_;                                             \
   if (DEBUG_HIP_7_PREVIEW & amd::CHANGE_HIP_GET_LAST_ERROR) {                                      \
     if (hip::tls.last_command_error_ != hipSuccess &&                                              \
            hip::tls.last_command_error_ != hipErrorNotReady) {                                     \
@@ -305,6 +309,7 @@ public:
   class Device;
   class MemoryPool;
   class Event;
+  class EventPool;
   class Stream : public amd::HostQueue {
   public:
     enum Priority : int { High = -1, Normal = 0, Low = 1 };
@@ -432,6 +437,8 @@ public:
     }
     /// reset capture parameters
     hipError_t EndCapture();
+    /// Returns a drained stream from the device stream pool to the created state
+    void Reuse(unsigned int flags);
     /// Set capture status
     void SetCaptureStatus(hipStreamCaptureStatus captureStatus) { captureStatus_ = captureStatus; }
     /// Set capture mode
@@ -512,6 +519,12 @@ public:
 
     std::set<MemoryPool*> mem_pools_;
 
+    EventPool* event_pool_ = nullptr;  //!< Destroyed events, cached for reuse
+
+    std::vector<Stream*> stream_pool_;  //!< Destroyed streams, kept with their queues for reuse
+    uint64_t stream_pool_hits_ = 0;     //!< Stream creations, served from the pool
+    uint64_t stream_pool_misses_ = 0;   //!< Stream creations, which missed the pool
+
   public:
     Device(amd::Context* ctx, int devId): context_(ctx),
         deviceId_(devId),
@@ -584,6 +597,19 @@ public:
     /// Get the graph memory pool on the device
     MemoryPool* GetGraphMemoryPool() const { return graph_mem_pool_; }
 
+    /// Get the pool of destroyed events on the device
+    EventPool* GetEventPool() const { return event_pool_; }
+
+    /// Returns a stream with the provided priority from the stream pool or nullptr
+    Stream* AcquirePooledStream(Stream::Priority priority, unsigned int flags);
+
+    /// Drains the destroyed stream and keeps it in the pool. Returns false if the pool
+    /// doesn't take the stream and the caller must destroy it
+    bool RecycleStream(Stream* stream);
+
+    /// Destroys all streams in the stream pool
+    void DestroyStreamPool();
+
     /// Add memory pool to the device
     void AddMemoryPool(MemoryPool* pool);
 
@@ -628,6 +654,7 @@ public:
     Device* device_;
     std::stack<Device*> ctxt_stack_;
     hipError_t last_error_, last_command_error_;
+    hipError_t api_status_;  //!< Return status of the current API for the statistics
     std::vector<hip::Stream*> capture_streams_;
     hipStreamCaptureMode stream_capture_mode_;
     std::stack<ihipExec_t> exec_stack_;
@@ -636,6 +663,7 @@ public:
     TlsAggregator(): device_(nullptr),
       last_error_(hipSuccess),
       last_command_error_(hipSuccess),
+      api_status_(hipSuccess),
       stream_capture_mode_(hipStreamCaptureModeGlobal) {
     }
     ~TlsAggregator() {
@@ -0,0 +1,127 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#ifndef HIP_SRC_HIP_MEM_RANGE_H
+#define HIP_SRC_HIP_MEM_RANGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <vector>
+
+namespace hip {
+
+//! Memory range of a batched prefetch or advise. Ranges with equal keys request the same
+//! operation, hence they can be merged if they overlap or touch each other
+template <typename Key>
+struct MemRange {
+  uintptr_t start_;  //!< Start address
+  uintptr_t end_;    //!< End address, exclusive
+  Key key_;          //!< Operation of the range
+  size_t epoch_;     //!< Epoch of the range. The epochs must be applied in order
+};
+
+//! Coalesces a batch of memory ranges into the minimal list of operations with the same effect.
+//! Ranges of the same key are merged in any order. Overlapping ranges of different keys must
+//! keep the order of the batch, hence such ranges start a new epoch. The output is ordered by
+//! epoch and by address within the epoch.
+template <typename Key>
+class MemRangeCoalescer {
+ public:
+  //! Adds the next range of the batch. The range must not be empty
+  void Add(uintptr_t start, size_t size, const Key& key) {
+    uintptr_t end = start + size;
+    if (Conflicts(start, end, key)) {
+      Flush();
+      epochs_++;
+    }
+    // Absorb all ranges of the same key, which overlap or touch the new range
+    auto it = epoch_.upper_bound(start);
+    if (it != epoch_.begin()) {
+      auto prev = std::prev(it);
+      if ((prev->second.end_ >= start) && (prev->second.key_ == key)) {
+        it = prev;
+      }
+    }
+    while ((it != epoch_.end()) && (it->first <= end)) {
+      if (it->second.key_ == key) {
+        start = (it->first < start) ? it->first : start;
+        end = (it->second.end_ > end) ? it->second.end_ : end;
+        it = epoch_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    epoch_[start] = Entry{end, key};
+  }
+
+  //! Returns the coalesced ranges and resets the coalescer
+  std::vector<MemRange<Key>> Finish() {
+    Flush();
+    epochs_ = 0;
+    std::vector<MemRange<Key>> result;
+    result.swap(ranges_);
+    return result;
+  }
+
+  //! Returns the number of the epochs, started by the order dependencies
+  size_t Epochs() const { return epochs_ + 1; }
+
+ private:
+  struct Entry {
+    uintptr_t end_;
+    Key key_;
+  };
+
+  //! Returns true if the range overlaps a range of another key in the current epoch
+  bool Conflicts(uintptr_t start, uintptr_t end, const Key& key) const {
+    // The ranges in the epoch are disjoint, so only the previous range can reach the start
+    auto it = epoch_.upper_bound(start);
+    if (it != epoch_.begin()) {
+      auto prev = std::prev(it);
+      if ((prev->second.end_ > start) && !(prev->second.key_ == key)) {
+        return true;
+      }
+    }
+    for (; (it != epoch_.end()) && (it->first < end); ++it) {
+      if (!(it->second.key_ == key)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  //! Moves the current epoch into the result
+  void Flush() {
+    for (const auto& it : epoch_) {
+      ranges_.push_back(MemRange<Key>{it.first, it.second.end_, it.second.key_, epochs_});
+    }
+    epoch_.clear();
+  }
+
+  std::map<uintptr_t, Entry> epoch_;    //!< Disjoint ranges of the current epoch by address
+  std::vector<MemRange<Key>> ranges_;   //!< Coalesced ranges of the finished epochs
+  size_t epochs_ = 0;                   //!< Number of finished epochs
+};
+
+}  // namespace hip
+
+#endif  // HIP_SRC_HIP_MEM_RANGE_H
@@ -3286,6 +3286,9 @@ hipError_t hipIpcOpenMemHandle(void** dev_ptr, hipIpcMemHandle_t handle, unsigne
   }
 
   amd_mem_obj = getMemoryObject(*dev_ptr, offset);
+  if (amd_mem_obj == nullptr) {
+    HIP_RETURN(hipErrorInvalidDevicePointer);
+  }
   amd_mem_obj->getUserData().deviceId = hip::getCurrentDevice()->deviceId();
 
   HIP_RETURN(hipSuccess, ReturnPtrValue(dev_ptr));
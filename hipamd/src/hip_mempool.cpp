@@ -503,8 +503,9 @@ hipError_t hipMemPoolImportPointer(
   }
   auto mpool = reinterpret_cast<hip::MemoryPool*>(mem_pool);
   auto shared = reinterpret_cast<hip::SharedMemPointer*>(export_data);
+  // The pool frees the imported memory, so it can't be shared through the IPC cache
   if (!mpool->Device()->devices()[0]->IpcAttach(
-      &shared->handle_[0], shared->size_, shared->offset_, 0, ptr)) {
+      &shared->handle_[0], shared->size_, shared->offset_, 0, ptr, false)) {
     HIP_RETURN(hipErrorOutOfMemory);
   }
   size_t offset = 0;
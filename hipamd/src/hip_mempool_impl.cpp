@@ -62,6 +62,8 @@ amd::Memory* Heap::FindMemory(size_t size, Stream* stream, bool opportunistic,
       total_size_ -= memory->getSize();
       // Preserve event, since the logic could skip GPU wait on reuse
       ts->event_ = it->second.event_;
+      ts->timeline_stream_ = it->second.timeline_stream_;
+      ts->timeline_value_ = it->second.timeline_value_;
       // Remove found allocation from the map
       it = allocations_.erase(it);
       break;
@@ -153,8 +155,8 @@ bool Heap::ReleaseAllMemory() {
 
 // ================================================================================================
 void Heap::RemoveStream(Stream* stream) {
-  for (auto it : allocations_) {
-    it.second.safe_streams_.erase(stream);
+  for (auto& it : allocations_) {
+    it.second.RemoveStream(stream);
   }
 }
 
@@ -292,7 +294,17 @@ bool MemoryPool::FreeMemory(amd::Memory* memory, Stream* stream, Event* event) {
       // The stream of destruction is a safe stream, because the app must handle sync
       ts.AddSafeStream(stream);
 
-      if (event == nullptr) {
+      uint64_t timeline_value = 0;
+      // Only the streams of the pool device are dropped from the pool on destruction,
+      // hence a stream of another device falls back to the event path
+      if ((event == nullptr) && AMD_DIRECT_DISPATCH && (stream->GetDevice() == device_)) {
+        // Direct dispatch submits all previous work of the stream, so a timeline marker
+        // can trace availability of this memory without a command and an event
+        timeline_value = stream->vdev()->AdvanceTimeline();
+      }
+      if (timeline_value != 0) {
+        ts.SetTimeline(stream, timeline_value);
+      } else if (event == nullptr) {
         // Add a marker to the stream to trace availability of this memory
         Event* e = new hip::Event(0);
         if (e != nullptr) {
@@ -339,6 +351,8 @@ void MemoryPool::RemoveStream(Stream* stream) {
   amd::ScopedLock lock(lock_pool_ops_);
 
   free_heap_.RemoveStream(stream);
+  // Busy allocations keep the tracking of the previous release for a reuse later
+  busy_heap_.RemoveStream(stream);
 }
 
 // ================================================================================================
@@ -62,40 +62,69 @@ struct MemoryTimestamp {
     Wait();
     delete event_;
     event_ = event;
+    timeline_stream_ = nullptr;
+    timeline_value_ = 0;
+  }
+  /// Changes last known stream timeline value, associated with memory
+  void SetTimeline(hip::Stream* stream, uint64_t value) {
+    // A timeline value doesn't own any objects, so only the old event requires a wait
+    if (event_ != nullptr) {
+      SetEvent(nullptr);
+    }
+    timeline_stream_ = stream;
+    timeline_value_ = value;
   }
   /// Wait for memory to be available
   void Wait() {
     if (event_ != nullptr) {
       auto hip_error = event_->synchronize();
+    } else if (timeline_stream_ != nullptr) {
+      timeline_stream_->vdev()->WaitTimeline(timeline_value_);
     }
   }
+  /// Returns true if the last release is tracked with an event or a timeline value
+  bool IsTracked() const { return (event_ != nullptr) || (timeline_stream_ != nullptr); }
+  /// Returns true if the last tracked release is done on the device
+  bool IsRetired() {
+    if (event_ != nullptr) {
+      // Check HIP event for a retired status
+      return (event_->query() == hipSuccess) ? true : false;
+    } else if (timeline_stream_ != nullptr) {
+      return timeline_stream_->vdev()->IsTimelineComplete(timeline_value_);
+    }
+    return true;
+  }
   /// Returns if memory object is safe for reuse
   bool IsSafeFind(hip::Stream* stream = nullptr, bool opportunistic = true) {
     bool result = false;
     if (safe_streams_.find(stream) != safe_streams_.end()) {
       // A safe stream doesn't require TS validation
       result = true;
-    } else if (opportunistic && (event_ != nullptr)) {
-      // Check HIP event for a retired status
-      result = (event_->query() == hipSuccess) ? true : false;
-    } else if (event_ == nullptr) {
+    } else if (opportunistic && IsTracked()) {
+      result = IsRetired();
+    } else if (!IsTracked()) {
       // Event doesn't exist. It was a safe release with explicit wait
       return true;
     }
     return result;
   }
   /// Returns if memory object is safe for reuse
-  bool IsSafeRelease() {
-    bool result = true;
-    if (event_ != nullptr) {
-      // Check HIP event for a retired status
-      result = (event_->query() == hipSuccess) ? true : false;
+  bool IsSafeRelease() { return IsRetired(); }
+  /// Removes the destroyed stream from the tracking
+  void RemoveStream(hip::Stream* stream) {
+    safe_streams_.erase(stream);
+    if (timeline_stream_ == stream) {
+      // The timeline value can't be checked after the stream is gone
+      Wait();
+      timeline_stream_ = nullptr;
+      timeline_value_ = 0;
     }
-    return result;
   }
 
   std::unordered_set<hip::Stream*>  safe_streams_;  //!< Safe streams for memory reuse
   hip::Event*   event_ = nullptr;   //!< Last known HIP event, associated with the memory object
+  hip::Stream*  timeline_stream_ = nullptr;  //!< Stream of the last release, tracked by timeline
+  uint64_t      timeline_value_ = 0;         //!< Timeline value of the last release
 };
 
 class Heap : public amd::EmbeddedObject {
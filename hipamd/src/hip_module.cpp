@@ -125,8 +125,12 @@ hipError_t hipFuncGetAttribute(int* value, hipFunction_attribute attrib, hipFunc
     HIP_RETURN(hipErrorInvalidDeviceFunction);
   }
 
-  const device::Kernel::WorkGroupInfo* wrkGrpInfo =
-      kernel->getDeviceKernel(*(hip::getCurrentDevice()->devices()[0]))->workGroupInfo();
+  const device::Kernel* devKernel =
+      kernel->getDeviceKernel(*(hip::getCurrentDevice()->devices()[0]));
+  if (devKernel == nullptr) {
+    HIP_RETURN(hipErrorInvalidDeviceFunction);
+  }
+  const device::Kernel::WorkGroupInfo* wrkGrpInfo = devKernel->workGroupInfo();
   if (wrkGrpInfo == nullptr) {
     HIP_RETURN(hipErrorMissingConfiguration);
   }
@@ -208,6 +212,9 @@ hipError_t hipFuncSetAttribute(const void* func, hipFuncAttribute attr, int valu
   device::Kernel* d_kernel =
                  (device::Kernel*)(kernel->getDeviceKernel(
                   *(hip::getCurrentDevice()->devices()[0])));
+  if (d_kernel == nullptr) {
+    HIP_RETURN(hipErrorInvalidDeviceFunction);
+  }
 
   if (attr == hipFuncAttributeMaxDynamicSharedMemorySize) {
     if ((value < 0) || (value > (d_kernel->workGroupInfo()->availableLDSSize_ -
@@ -441,8 +448,12 @@ hipError_t ihipModuleLaunchKernel(hipFunction_t f, uint32_t globalWorkSizeX,
   if (globalWorkSizeZ < blockDimZ) blockDimZ = globalWorkSizeZ;
 
   auto device = g_devices[deviceId]->devices()[0];
+  const device::Kernel* devKernel = kernel->getDeviceKernel(*device);
+  if (devKernel == nullptr) {
+    return hipErrorInvalidDeviceFunction;
+  }
   // Check if it's a uniform kernel and validate dimensions
-  if (kernel->getDeviceKernel(*device)->getUniformWorkGroupSize()) {
+  if (devKernel->getUniformWorkGroupSize()) {
     if (((globalWorkSizeX % blockDimX) != 0) ||
         ((globalWorkSizeY % blockDimY) != 0) ||
         ((globalWorkSizeZ % blockDimZ) != 0)) {
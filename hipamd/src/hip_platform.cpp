@@ -104,6 +104,15 @@ void __hipRegisterFunction(hip::FatBinaryInfo** modules, const void* hostFunctio
     HIP_INIT_VOID();
     hipFunction_t hfunc = nullptr;
 
+    // The lookup on the current device extracts the fat binary and builds its program.
+    // The programs of the other devices are built in parallel before the per device lookup
+    hip_error = PlatformState::instance().getStatFunc(&hfunc, hostFunction, ihipGetDevice());
+    guarantee((hip_error == hipSuccess), "Cannot retrieve Static function, error: %d",
+                                          hip_error);
+    hip_error = (*modules)->BuildPrograms(g_devices);
+    guarantee((hip_error == hipSuccess), "Cannot build Static function programs, error: %d",
+                                          hip_error);
+
     for (size_t dev_idx = 0; dev_idx < g_devices.size(); ++dev_idx) {
       hip_error = PlatformState::instance().getStatFunc(&hfunc, hostFunction, dev_idx);
       guarantee((hip_error == hipSuccess), "Cannot retrieve Static function, error: %d",
@@ -350,7 +359,11 @@ hipError_t ihipOccupancyMaxActiveBlocksPerMultiprocessor(
   hip::DeviceFunc* function = hip::DeviceFunc::asFunction(func);
   const amd::Kernel& kernel = *function->kernel();
 
-  const device::Kernel::WorkGroupInfo* wrkGrpInfo = kernel.getDeviceKernel(device)->workGroupInfo();
+  const device::Kernel* devKernel = kernel.getDeviceKernel(device);
+  if (devKernel == nullptr) {
+    return hipErrorInvalidDeviceFunction;
+  }
+  const device::Kernel::WorkGroupInfo* wrkGrpInfo = devKernel->workGroupInfo();
   if (bCalcPotentialBlkSz == false) {
     if (inputBlockSize <= 0) {
       return hipErrorInvalidValue;
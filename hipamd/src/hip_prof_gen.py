@@ -130,7 +130,11 @@ def pointer_ck(arg_type):
   if m:
     ptr_type = m.group(1)
     n = re.match(r'(.*)\*\*$', arg_type)
-    if not n:
+    # The value of a const pointer array, i.e. 'const void* const*', keeps the pointee type
+    k = re.match(r'(.*\*)\s*const$', ptr_type)
+    if k:
+      ptr_type = k.group(1)
+    elif not n:
       ptr_type = re.sub(r'const ', '', ptr_type)
     if ptr_type == 'void': ptr_type = ''
   return ptr_type
@@ -401,6 +405,8 @@ def generate_prof_header(f, api_map, callback_ids, opts_map):
   f.write('\n#include <hip/hip_runtime_api.h>\n')
   f.write('#include <hip/hip_deprecated.h>\n')
   f.write('#include "amd_hip_gl_interop.h"\n')
+  f.write('#include "amd_hip_mem_batch.h"\n')
+  f.write('#include "amd_hip_fp_convert.h"\n')
 
   # Check for non-public API
   for name in sorted(opts_map.keys()):
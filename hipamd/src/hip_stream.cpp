@@ -66,6 +66,22 @@ hipError_t Stream::EndCapture() {
   return hipSuccess;
 }
 
+// ================================================================================================
+void Stream::Reuse(unsigned int flags) {
+  flags_ = flags;
+  captureStatus_ = hipStreamCaptureStatusNone;
+  pCaptureGraph_ = nullptr;
+  captureMode_ = hipStreamCaptureModeGlobal;
+  originStream_ = false;
+  parentStream_ = nullptr;
+  lastCapturedNodes_.clear();
+  removedDependencies_.clear();
+  parallelCaptureStreams_.clear();
+  captureEvents_.clear();
+  captureID_ = 0;
+  device_->AddStream(this);
+}
+
 // ================================================================================================
 bool Stream::Create() {
   return create();
@@ -74,6 +90,8 @@ bool Stream::Create() {
 // ================================================================================================
 void Stream::Destroy(hip::Stream* stream, bool forceDestroy) {
   stream->device_->RemoveStream(stream);
+  // Memory pools may track the stream timeline, so they must drop the stream before it's gone
+  stream->device_->RemoveStreamFromPools(stream);
   stream->SetForceDestroy(forceDestroy);
   stream->release();
   stream = nullptr;
@@ -186,7 +204,16 @@ static hipError_t ihipStreamCreate(hipStream_t* stream,
   if (flags != hipStreamDefault && flags != hipStreamNonBlocking) {
     return hipErrorInvalidValue;
   }
-  hip::Stream* hStream = new hip::Stream(hip::getCurrentDevice(), priority, flags, false, cuMask);
+  hip::Stream* hStream = nullptr;
+  if (cuMask.empty()) {
+    // A destroyed stream keeps its queue, so the reuse skips the queue creation
+    hStream = hip::getCurrentDevice()->AcquirePooledStream(priority, flags);
+    if (hStream != nullptr) {
+      *stream = reinterpret_cast<hipStream_t>(hStream);
+      return hipSuccess;
+    }
+  }
+  hStream = new hip::Stream(hip::getCurrentDevice(), priority, flags, false, cuMask);
 
   if (hStream == nullptr) {
     return hipErrorOutOfMemory;
@@ -407,8 +434,6 @@ hipError_t hipStreamDestroy(hipStream_t stream) {
     }
     auto error = s->EndCapture();
   }
-  s->GetDevice()->RemoveStreamFromPools(s);
-
   {
     amd::ScopedLock lock(g_captureStreamsLock);
     const auto& g_it = std::find(g_captureStreams.begin(), g_captureStreams.end(), s);
@@ -428,7 +453,9 @@ hipError_t hipStreamDestroy(hipStream_t stream) {
   if (l_it != hip::tls.capture_streams_.end()) {
     hip::tls.capture_streams_.erase(l_it);
   }
-  hip::Stream::Destroy(s);
+  if (!s->GetDevice()->RecycleStream(s)) {
+    hip::Stream::Destroy(s);
+  }
 
   HIP_RETURN(hipSuccess);
 }
@@ -437,10 +464,10 @@ hipError_t hipStreamDestroy(hipStream_t stream) {
 void WaitThenDecrementSignal(hipStream_t stream, hipError_t status, void* user_data) {
   CallbackData* data =  reinterpret_cast<CallbackData*>(user_data);
   int offset = data->previous_read_index % IPC_SIGNALS_PER_EVENT;
-  while (data->shmem->read_index < data->previous_read_index + IPC_SIGNALS_PER_EVENT &&
-         data->shmem->signal[offset] != 0) {
-    amd::Os::sleep(1);
-  }
+  data->shmem->wait_word.Wait([&]() {
+    return (data->shmem->read_index >= data->previous_read_index + IPC_SIGNALS_PER_EVENT) ||
+           (__atomic_load_n(&data->shmem->signal[offset], __ATOMIC_ACQUIRE) == 0);
+  }, static_cast<uint64_t>(DEBUG_CLR_SHARED_WAIT_SPIN) * 1000);
   delete data;
 }
 
@@ -20,6 +20,8 @@
     THE SOFTWARE.
    */
 #include <hip/amd_detail/hip_api_trace.hpp>
+#include <hip/amd_detail/amd_hip_mem_batch.h>
+#include <hip/amd_detail/amd_hip_fp_convert.h>
 namespace hip {
 const HipDispatchTable* GetHipDispatchTable();
 const HipCompilerDispatchTable* GetHipCompilerDispatchTable();
@@ -1843,4 +1845,44 @@ hipError_t hipGraphExecBatchMemOpNodeSetParams(hipGraphExec_t hGraphExec,
 }
 hipError_t hipEventRecordWithFlags(hipEvent_t event, hipStream_t stream, unsigned int flags) {
   return hip::GetHipDispatchTable()->hipEventRecordWithFlags_fn(event, stream, flags);
-}
\ No newline at end of file
+}
+hipError_t hipExtMemPrefetchBatchAsync(const void* const* dev_ptrs, const size_t* counts,
+                                       const int* devices, size_t num_ranges,
+                                       hipStream_t stream) {
+  return hip::GetHipDispatchTable()->hipExtMemPrefetchBatchAsync_fn(dev_ptrs, counts, devices,
+                                                                    num_ranges, stream);
+}
+hipError_t hipExtMemAdviseBatch(const void* const* dev_ptrs, const size_t* counts,
+                                const hipMemoryAdvise* advice, const int* devices,
+                                size_t num_ranges) {
+  return hip::GetHipDispatchTable()->hipExtMemAdviseBatch_fn(dev_ptrs, counts, advice, devices,
+                                                             num_ranges);
+}
+hipError_t hipExtGetApiStats(hipApiStats_t* stats, size_t* count) {
+  return hip::GetHipDispatchTable()->hipExtGetApiStats_fn(stats, count);
+}
+hipError_t hipExtResetApiStats(void) {
+  return hip::GetHipDispatchTable()->hipExtResetApiStats_fn();
+}
+hipError_t hipExtConvertFloatToFp8(const float* src, uint8_t* dst, size_t count,
+                                   hipExtFp8Format_t format, int saturate,
+                                   hipExtFp8Rounding_t rounding, uint32_t seed) {
+  return hip::GetHipDispatchTable()->hipExtConvertFloatToFp8_fn(src, dst, count, format, saturate,
+                                                                rounding, seed);
+}
+hipError_t hipExtConvertFp8ToFloat(const uint8_t* src, float* dst, size_t count,
+                                   hipExtFp8Format_t format) {
+  return hip::GetHipDispatchTable()->hipExtConvertFp8ToFloat_fn(src, dst, count, format);
+}
+hipError_t hipExtConvertFloatToBf16(const float* src, uint16_t* dst, size_t count) {
+  return hip::GetHipDispatchTable()->hipExtConvertFloatToBf16_fn(src, dst, count);
+}
+hipError_t hipExtConvertBf16ToFloat(const uint16_t* src, float* dst, size_t count) {
+  return hip::GetHipDispatchTable()->hipExtConvertBf16ToFloat_fn(src, dst, count);
+}
+hipError_t hipExtConvertFloatToHalf(const float* src, uint16_t* dst, size_t count) {
+  return hip::GetHipDispatchTable()->hipExtConvertFloatToHalf_fn(src, dst, count);
+}
+hipError_t hipExtConvertHalfToFloat(const uint16_t* src, float* dst, size_t count) {
+  return hip::GetHipDispatchTable()->hipExtConvertHalfToFloat_fn(src, dst, count);
+}
@@ -0,0 +1,477 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+#define CHECK(call)                                                                   \
+  do {                                                                                \
+    hipError_t err = (call);                                                          \
+    if (err != hipSuccess) {                                                          \
+      printf("%s:%d: %s failed: %s\n", __FILE__, __LINE__, #call,                     \
+             hipGetErrorString(err));                                                 \
+      return false;                                                                   \
+    }                                                                                 \
+  } while (0)
+
+__global__ void emptyKernel() {}
+
+__global__ void argsKernel(int* ptr, size_t size, float a, float b, uint4 c) {}
+
+// Runs the body for the iterations and prints the average CPU time of one operation
+static bool measure(const char* name, unsigned int iterations, unsigned int opsPerIteration,
+                    const std::function<bool()>& body) {
+  // Warm up the code paths, the caches and the pools of the runtime
+  if (!body()) {
+    return false;
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < iterations; ++i) {
+    if (!body()) {
+      return false;
+    }
+  }
+  double us = std::chrono::duration<double, std::micro>(
+      std::chrono::steady_clock::now() - start).count();
+  double ops = static_cast<double>(iterations) * opsPerIteration;
+  printf("%-40s %9.3f us/op %12.0f ops/s\n", name, us / ops, ops * 1e6 / us);
+  return true;
+}
+
+// ================================================================================================
+static bool launchRate(unsigned int iterations) {
+  constexpr unsigned int kBatch = 1000;
+  hipStream_t stream;
+  CHECK(hipStreamCreate(&stream));
+  int* ptr = nullptr;
+  CHECK(hipMalloc(&ptr, sizeof(int)));
+
+  bool ret = measure("launch, empty kernel", iterations, kBatch, [&]() {
+    for (unsigned int i = 0; i < kBatch; ++i) {
+      hipLaunchKernelGGL(emptyKernel, dim3(1), dim3(64), 0, stream);
+    }
+    CHECK(hipGetLastError());
+    CHECK(hipStreamSynchronize(stream));
+    return true;
+  });
+  ret = ret && measure("launch, kernel with arguments", iterations, kBatch, [&]() {
+    for (unsigned int i = 0; i < kBatch; ++i) {
+      hipLaunchKernelGGL(argsKernel, dim3(1024), dim3(256), 0, stream, ptr, size_t{i}, 1.0f,
+                         2.0f, make_uint4(i, i, i, i));
+    }
+    CHECK(hipGetLastError());
+    CHECK(hipStreamSynchronize(stream));
+    return true;
+  });
+  ret = ret && measure("launch + stream synchronize", iterations * 10, 1, [&]() {
+    hipLaunchKernelGGL(emptyKernel, dim3(1), dim3(64), 0, stream);
+    CHECK(hipStreamSynchronize(stream));
+    return true;
+  });
+
+  CHECK(hipFree(ptr));
+  CHECK(hipStreamDestroy(stream));
+  return ret;
+}
+
+// ================================================================================================
+static bool memcpyOverhead(unsigned int iterations) {
+  constexpr unsigned int kBatch = 100;
+  constexpr size_t kSize = 4 * 1024;
+  hipStream_t stream;
+  CHECK(hipStreamCreate(&stream));
+  void* device = nullptr;
+  void* device2 = nullptr;
+  void* pinned = nullptr;
+  std::vector<char> pageable(kSize);
+  CHECK(hipMalloc(&device, kSize));
+  CHECK(hipMalloc(&device2, kSize));
+  CHECK(hipHostMalloc(&pinned, kSize));
+
+  bool ret = measure("hipMemcpyAsync H2D 4KB pinned", iterations, kBatch, [&]() {
+    for (unsigned int i = 0; i < kBatch; ++i) {
+      CHECK(hipMemcpyAsync(device, pinned, kSize, hipMemcpyHostToDevice, stream));
+    }
+    CHECK(hipStreamSynchronize(stream));
+    return true;
+  });
+  ret = ret && measure("hipMemcpyAsync D2H 4KB pinned", iterations, kBatch, [&]() {
+    for (unsigned int i = 0; i < kBatch; ++i) {
+      CHECK(hipMemcpyAsync(pinned, device, kSize, hipMemcpyDeviceToHost, stream));
+    }
+    CHECK(hipStreamSynchronize(stream));
+    return true;
+  });
+  ret = ret && measure("hipMemcpyAsync D2D 4KB", iterations, kBatch, [&]() {
+    for (unsigned int i = 0; i < kBatch; ++i) {
+      CHECK(hipMemcpyAsync(device2, device, kSize, hipMemcpyDeviceToDevice, stream));
+    }
+    CHECK(hipStreamSynchronize(stream));
+    return true;
+  });
+  ret = ret && measure("hipMemsetAsync 4KB", iterations, kBatch, [&]() {
+    for (unsigned int i = 0; i < kBatch; ++i) {
+      CHECK(hipMemsetAsync(device, 0, kSize, stream));
+    }
+    CHECK(hipStreamSynchronize(stream));
+    return true;
+  });
+  ret = ret && measure("hipMemcpy H2D 4KB pageable", iterations * 10, 1, [&]() {
+    CHECK(hipMemcpy(device, pageable.data(), kSize, hipMemcpyHostToDevice));
+    return true;
+  });
+  ret = ret && measure("hipMemcpy D2H 4KB pageable", iterations * 10, 1, [&]() {
+    CHECK(hipMemcpy(pageable.data(), device, kSize, hipMemcpyDeviceToHost));
+    return true;
+  });
+
+  CHECK(hipHostFree(pinned));
+  CHECK(hipFree(device2));
+  CHECK(hipFree(device));
+  CHECK(hipStreamDestroy(stream));
+  return ret;
+}
+
+// ================================================================================================
+static bool eventStreamOps(unsigned int iterations) {
+  constexpr unsigned int kBatch = 100;
+  hipStream_t stream;
+  hipStream_t stream2;
+  CHECK(hipStreamCreate(&stream));
+  CHECK(hipStreamCreate(&stream2));
+  hipEvent_t event;
+  CHECK(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+
+  bool ret = measure("hipEventCreate + hipEventDestroy", iterations, kBatch, [&]() {
+    for (unsigned int i = 0; i < kBatch; ++i) {
+      hipEvent_t e;
+      CHECK(hipEventCreate(&e));
+      CHECK(hipEventDestroy(e));
+    }
+    return true;
+  });
+  // The per op event pattern of the frameworks
+  ret = ret && measure("hipEventCreate + Record + Query + Destroy", iterations, kBatch, [&]() {
+    for (unsigned int i = 0; i < kBatch; ++i) {
+      hipEvent_t e;
+      CHECK(hipEventCreateWithFlags(&e, hipEventDisableTiming));
+      CHECK(hipEventRecord(e, stream));
+      hipError_t status = hipEventQuery(e);
+      if ((status != hipSuccess) && (status != hipErrorNotReady)) {
+        CHECK(status);
+      }
+      CHECK(hipEventDestroy(e));
+    }
+    CHECK(hipStreamSynchronize(stream));
+    return true;
+  });
+  ret = ret && measure("hipEventRecord", iterations, kBatch, [&]() {
+    for (unsigned int i = 0; i < kBatch; ++i) {
+      CHECK(hipEventRecord(event, stream));
+    }
+    CHECK(hipEventSynchronize(event));
+    return true;
+  });
+  ret = ret && measure("hipEventRecord + hipEventSynchronize", iterations * 10, 1, [&]() {
+    CHECK(hipEventRecord(event, stream));
+    CHECK(hipEventSynchronize(event));
+    return true;
+  });
+  ret = ret && measure("hipEventQuery, completed", iterations, kBatch, [&]() {
+    for (unsigned int i = 0; i < kBatch; ++i) {
+      CHECK(hipEventQuery(event));
+    }
+    return true;
+  });
+  ret = ret && measure("hipStreamWaitEvent cross stream", iterations, kBatch, [&]() {
+    for (unsigned int i = 0; i < kBatch; ++i) {
+      CHECK(hipEventRecord(event, stream));
+      CHECK(hipStreamWaitEvent(stream2, event, 0));
+      hipLaunchKernelGGL(emptyKernel, dim3(1), dim3(64), 0, stream2);
+    }
+    CHECK(hipStreamSynchronize(stream2));
+    return true;
+  });
+  ret = ret && measure("hipStreamQuery, idle", iterations, kBatch, [&]() {
+    for (unsigned int i = 0; i < kBatch; ++i) {
+      CHECK(hipStreamQuery(stream));
+    }
+    return true;
+  });
+  ret = ret && measure("hipStreamCreate + hipStreamDestroy", iterations, 1, [&]() {
+    hipStream_t s;
+    CHECK(hipStreamCreate(&s));
+    CHECK(hipStreamDestroy(s));
+    return true;
+  });
+  // A short lived stream per request, the pattern of the libraries
+  ret = ret && measure("hipStreamCreate + launch + hipStreamDestroy", iterations, 1, [&]() {
+    hipStream_t s;
+    CHECK(hipStreamCreateWithFlags(&s, hipStreamNonBlocking));
+    hipLaunchKernelGGL(emptyKernel, dim3(1), dim3(64), 0, s);
+    CHECK(hipStreamDestroy(s));
+    return true;
+  });
+
+  CHECK(hipEventDestroy(event));
+  CHECK(hipStreamDestroy(stream2));
+  CHECK(hipStreamDestroy(stream));
+  return ret;
+}
+
+// ================================================================================================
+static bool graphLaunch(unsigned int iterations) {
+  hipStream_t stream;
+  CHECK(hipStreamCreate(&stream));
+  void* device = nullptr;
+  CHECK(hipMalloc(&device, 4096));
+
+  // Capture cost of a kernel node, compare with the eager launch of the same kernel
+  constexpr unsigned int kBatch = 1000;
+  bool ret = measure("capture, kernel with arguments", iterations, kBatch, [&]() {
+    hipGraph_t graph;
+    CHECK(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    for (unsigned int i = 0; i < kBatch; ++i) {
+      hipLaunchKernelGGL(argsKernel, dim3(1024), dim3(256), 0, stream,
+                         reinterpret_cast<int*>(device), size_t{i}, 1.0f, 2.0f,
+                         make_uint4(i, i, i, i));
+    }
+    CHECK(hipStreamEndCapture(stream, &graph));
+    CHECK(hipGraphDestroy(graph));
+    return true;
+  });
+  for (unsigned int nodes : {1u, 10u, 100u}) {
+    // Capture a chain of kernels and memsets, the common shape of an inference step
+    hipGraph_t graph;
+    hipGraphExec_t graphExec;
+    CHECK(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    for (unsigned int i = 0; i < nodes; ++i) {
+      if ((i % 10) == 9) {
+        CHECK(hipMemsetAsync(device, 0, 4096, stream));
+      } else {
+        hipLaunchKernelGGL(emptyKernel, dim3(1), dim3(64), 0, stream);
+      }
+    }
+    CHECK(hipStreamEndCapture(stream, &graph));
+
+    char name[64];
+    snprintf(name, sizeof(name), "hipGraphInstantiate, %u nodes", nodes);
+    ret = ret && measure(name, std::max(iterations / nodes, 1u), 1, [&]() {
+      hipGraphExec_t exec;
+      CHECK(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+      CHECK(hipGraphExecDestroy(exec));
+      return true;
+    });
+    CHECK(hipGraphInstantiate(&graphExec, graph, nullptr, nullptr, 0));
+    snprintf(name, sizeof(name), "hipGraphLaunch, %u nodes", nodes);
+    ret = ret && measure(name, std::max(iterations * 10 / nodes, 1u), 1, [&]() {
+      CHECK(hipGraphLaunch(graphExec, stream));
+      CHECK(hipStreamSynchronize(stream));
+      return true;
+    });
+    CHECK(hipGraphExecDestroy(graphExec));
+    CHECK(hipGraphDestroy(graph));
+  }
+
+  CHECK(hipFree(device));
+  CHECK(hipStreamDestroy(stream));
+  return ret;
+}
+
+// ================================================================================================
+// Runs the body once and prints its CPU time
+static bool measureOnce(const char* name, const std::function<bool()>& body) {
+  auto start = std::chrono::steady_clock::now();
+  if (!body()) {
+    return false;
+  }
+  double ms = std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - start).count();
+  printf("%-40s %12.3f ms\n", name, ms);
+  return true;
+}
+
+// ================================================================================================
+static bool graphScale(unsigned int maxNodes) {
+  bool ret = true;
+  for (unsigned int nodes = 1000; ret && (nodes <= maxNodes); nodes *= 10) {
+    // A layered graph, the shape of a captured multi stream workload: every node depends
+    // on one or two nodes of the previous layer
+    constexpr unsigned int kWidth = 16;
+    hipGraph_t graph;
+    CHECK(hipGraphCreate(&graph, 0));
+    std::vector<hipGraphNode_t> graphNodes(nodes);
+    char name[64];
+    snprintf(name, sizeof(name), "hipGraphAddEmptyNode, %u nodes", nodes);
+    ret = ret && measureOnce(name, [&]() {
+      for (unsigned int i = 0; i < nodes; ++i) {
+        hipGraphNode_t deps[2];
+        size_t numDeps = 0;
+        if (i >= kWidth) {
+          deps[numDeps++] = graphNodes[i - kWidth];
+          if ((i % kWidth) != (kWidth - 1)) {
+            deps[numDeps++] = graphNodes[i - kWidth + 1];
+          }
+        }
+        CHECK(hipGraphAddEmptyNode(&graphNodes[i], graph, deps, numDeps));
+      }
+      return true;
+    });
+
+    hipGraph_t clone = nullptr;
+    snprintf(name, sizeof(name), "hipGraphClone, %u nodes", nodes);
+    ret = ret && measureOnce(name, [&]() {
+      CHECK(hipGraphClone(&clone, graph));
+      return true;
+    });
+    size_t numNodes = 0;
+    snprintf(name, sizeof(name), "hipGraphGetNodes, %u nodes", nodes);
+    ret = ret && measureOnce(name, [&]() {
+      CHECK(hipGraphGetNodes(graph, nullptr, &numNodes));
+      return numNodes == nodes;
+    });
+    hipGraphExec_t exec = nullptr;
+    snprintf(name, sizeof(name), "hipGraphInstantiate, %u nodes", nodes);
+    ret = ret && measureOnce(name, [&]() {
+      CHECK(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+      return true;
+    });
+    snprintf(name, sizeof(name), "hipGraphDestroy, %u nodes", nodes);
+    ret = ret && measureOnce(name, [&]() {
+      if (exec != nullptr) {
+        CHECK(hipGraphExecDestroy(exec));
+      }
+      if (clone != nullptr) {
+        CHECK(hipGraphDestroy(clone));
+      }
+      CHECK(hipGraphDestroy(graph));
+      return true;
+    });
+  }
+  return ret;
+}
+
+// ================================================================================================
+// Returns the resident set size of the process in bytes
+static size_t residentSize() {
+  size_t pages = 0;
+  size_t resident = 0;
+#if defined(__linux__)
+  FILE* statm = fopen("/proc/self/statm", "r");
+  if (statm != nullptr) {
+    if (fscanf(statm, "%zu %zu", &pages, &resident) != 2) {
+      resident = 0;
+    }
+    fclose(statm);
+  }
+#endif
+  return resident * 4096;
+}
+
+// ================================================================================================
+static bool moduleLoad(const hipDeviceProp_t& props, unsigned int kernels) {
+  // A library shaped code object: many kernels, of which the application uses a few
+  std::string source;
+  for (unsigned int i = 0; i < kernels; ++i) {
+    source += "extern \"C\" __global__ void kernel" + std::to_string(i) +
+        "(float* out, const float* in, int n, float a) {\n"
+        "  int i = blockIdx.x * blockDim.x + threadIdx.x;\n"
+        "  if (i < n) out[i] = a * in[i] + " + std::to_string(i) + ".0f;\n}\n";
+  }
+  hiprtcProgram program;
+  if (hiprtcCreateProgram(&program, source.c_str(), "module.cpp", 0, nullptr, nullptr) !=
+      HIPRTC_SUCCESS) {
+    printf("hiprtcCreateProgram failed\n");
+    return false;
+  }
+  std::string arch = std::string("--gpu-architecture=") + props.gcnArchName;
+  const char* options[] = {arch.c_str()};
+  size_t codeSize = 0;
+  std::vector<char> code;
+  if ((hiprtcCompileProgram(program, 1, options) != HIPRTC_SUCCESS) ||
+      (hiprtcGetCodeSize(program, &codeSize) != HIPRTC_SUCCESS)) {
+    printf("hiprtcCompileProgram failed\n");
+    hiprtcDestroyProgram(&program);
+    return false;
+  }
+  code.resize(codeSize);
+  if ((hiprtcGetCode(program, code.data()) != HIPRTC_SUCCESS) ||
+      (hiprtcDestroyProgram(&program) != HIPRTC_SUCCESS)) {
+    printf("hiprtcGetCode failed\n");
+    return false;
+  }
+
+  // The load covers the kernel objects creation, the first lookups the deferred metadata
+  size_t rss = residentSize();
+  auto start = std::chrono::steady_clock::now();
+  hipModule_t module;
+  CHECK(hipModuleLoadData(&module, code.data()));
+  double loadMs = std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - start).count();
+  double rssMb = (static_cast<double>(residentSize()) - rss) / (1024 * 1024);
+
+  constexpr unsigned int kUsed = 32;
+  const unsigned int used = std::min(kUsed, kernels);
+  hipFunction_t function = nullptr;
+  start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < used; ++i) {
+    CHECK(hipModuleGetFunction(&function, module, ("kernel" + std::to_string(i)).c_str()));
+  }
+  double lookupUs = std::chrono::duration<double, std::micro>(
+      std::chrono::steady_clock::now() - start).count() / used;
+
+  printf("hipModuleLoadData, %5u kernels %12.3f ms, RSS %+9.2f MiB\n", kernels, loadMs, rssMb);
+  printf("%-40s %9.3f us/op\n", "hipModuleGetFunction, first lookup", lookupUs);
+  CHECK(hipModuleUnload(module));
+  return true;
+}
+
+int main(int argc, char** argv) {
+  // hip_perf_test [iterations] [kernels in the loaded module] [max graph nodes]
+  unsigned int iterations = (argc > 1) ? strtoul(argv[1], nullptr, 0) : 100;
+  unsigned int kernels = (argc > 2) ? strtoul(argv[2], nullptr, 0) : 2000;
+  unsigned int graphNodes = (argc > 3) ? strtoul(argv[3], nullptr, 0) : 100000;
+  iterations = std::max(iterations, 1u);
+
+  hipDeviceProp_t props;
+  if ((hipSetDevice(0) != hipSuccess) || (hipGetDeviceProperties(&props, 0) != hipSuccess)) {
+    printf("No HIP device\n");
+    return 1;
+  }
+  printf("Device: %s (%s)\n", props.name, props.gcnArchName);
+
+  bool ret = true;
+  ret = ret && launchRate(iterations);
+  ret = ret && memcpyOverhead(iterations);
+  ret = ret && eventStreamOps(iterations);
+  ret = ret && graphLaunch(iterations);
+  ret = ret && graphScale(graphNodes);
+  ret = ret && ((kernels == 0) || moduleLoad(props, kernels));
+  printf("%s: %u iterations %s!\n", __func__, iterations, ret ? "Succeeded" : "Failed");
+  return ret ? 0 : 1;
+}
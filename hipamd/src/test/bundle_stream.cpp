@@ -0,0 +1,402 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#include "hip_bundle_stream.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <dlfcn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// CPU test and benchmark of the streaming extraction of compressed offload bundles. The
+// synthetic bundles have the layout of clang-offload-bundler: the index, a host entry without
+// data and a code object per target, compressed with zstd into a CCOB bundle.
+struct Zstd {
+  hip::ZstdStreamApi stream;
+  size_t (*compressBound)(size_t size);
+  size_t (*compress)(void* dst, size_t capacity, const void* src, size_t size, int level);
+  size_t (*decompress)(void* dst, size_t capacity, const void* src, size_t size);
+};
+
+static bool loadZstd(Zstd* zstd) {
+  void* handle = dlopen("libzstd.so.1", RTLD_NOW);
+  if (handle == nullptr) {
+    return false;
+  }
+  auto symbol = [handle](auto* fn, const char* name) {
+    *fn = reinterpret_cast<std::remove_reference_t<decltype(*fn)>>(dlsym(handle, name));
+    return *fn != nullptr;
+  };
+  return symbol(&zstd->stream.createDStream, "ZSTD_createDStream") &&
+      symbol(&zstd->stream.freeDStream, "ZSTD_freeDStream") &&
+      symbol(&zstd->stream.initDStream, "ZSTD_initDStream") &&
+      symbol(&zstd->stream.decompressStream, "ZSTD_decompressStream") &&
+      symbol(&zstd->stream.isError, "ZSTD_isError") &&
+      symbol(&zstd->stream.dStreamOutSize, "ZSTD_DStreamOutSize") &&
+      symbol(&zstd->compressBound, "ZSTD_compressBound") &&
+      symbol(&zstd->compress, "ZSTD_compress") &&
+      symbol(&zstd->decompress, "ZSTD_decompress");
+}
+
+static Zstd zstd;
+
+struct Bundle {
+  std::vector<std::string> ids;
+  std::vector<std::string> images;  // Code objects, the host entry is empty
+  std::string data;                 // Uncompressed bundle
+  std::string compressed;           // CCOB bundle
+};
+
+static void append(std::string& out, uint64_t value) {
+  out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// Code objects compress like real ones, somewhere between text and random data
+static std::string makeImage(size_t size, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::string image(size, 0);
+  for (size_t i = 0; i < size; i += 8) {
+    uint64_t word = (rng() % 4 == 0) ? rng() : (rng() % 64);
+    memcpy(&image[i], &word, std::min<size_t>(8, size - i));
+  }
+  return image;
+}
+
+static Bundle makeBundle(size_t targets, size_t image_size, uint16_t version = 2) {
+  Bundle bundle;
+  bundle.ids.push_back("host-x86_64-unknown-linux-gnu-");
+  bundle.images.push_back(std::string());
+  for (size_t i = 0; i < targets; ++i) {
+    bundle.ids.push_back("hipv4-amdgcn-amd-amdhsa--gfx" + std::to_string(900 + i));
+    bundle.images.push_back(makeImage(image_size + i * 8, static_cast<uint32_t>(i + 1)));
+  }
+
+  size_t index_size = 24 + sizeof(uint64_t);
+  for (const auto& id : bundle.ids) {
+    index_size += 3 * sizeof(uint64_t) + id.size();
+  }
+  // The bundler aligns the code objects to 4KB
+  std::vector<uint64_t> offsets;
+  uint64_t offset = index_size;
+  for (const auto& image : bundle.images) {
+    offset = (offset + 4095) & ~uint64_t(4095);
+    offsets.push_back(offset);
+    offset += image.size();
+  }
+
+  std::string& data = bundle.data;
+  data = "__CLANG_OFFLOAD_BUNDLE__";
+  append(data, bundle.ids.size());
+  for (size_t i = 0; i < bundle.ids.size(); ++i) {
+    append(data, offsets[i]);
+    append(data, bundle.images[i].size());
+    append(data, bundle.ids[i].size());
+    data += bundle.ids[i];
+  }
+  for (size_t i = 0; i < bundle.images.size(); ++i) {
+    data.resize(offsets[i], 0);
+    data += bundle.images[i];
+  }
+
+  std::string payload(zstd.compressBound(data.size()), 0);
+  size_t size = zstd.compress(&payload[0], payload.size(), data.data(), data.size(), 3);
+  payload.resize(size);
+
+  std::string& ccob = bundle.compressed;
+  ccob = "CCOB";
+  uint16_t method = hip::kBundleCompressionZstd;
+  ccob.append(reinterpret_cast<const char*>(&version), sizeof(version));
+  ccob.append(reinterpret_cast<const char*>(&method), sizeof(method));
+  if (version == 2) {
+    uint32_t total = static_cast<uint32_t>(24 + payload.size());
+    uint32_t uncompressed = static_cast<uint32_t>(data.size());
+    ccob.append(reinterpret_cast<const char*>(&total), sizeof(total));
+    ccob.append(reinterpret_cast<const char*>(&uncompressed), sizeof(uncompressed));
+  } else {
+    append(ccob, 32 + payload.size());
+    append(ccob, data.size());
+  }
+  append(ccob, 0x1234567890abcdefull);
+  ccob += payload;
+  return bundle;
+}
+
+static hip::BundleStream::Selector selectIds(const std::vector<std::string>& ids) {
+  return [ids](std::vector<hip::BundleEntry>& entries) {
+    for (auto& entry : entries) {
+      entry.selected_ = std::find(ids.begin(), ids.end(), entry.id_) != ids.end();
+    }
+  };
+}
+
+static bool checkEntries(const char* name, const Bundle& bundle, hip::BundleStream& stream,
+                         const std::vector<std::string>& ids) {
+  const auto& entries = stream.Entries();
+  if (entries.size() != bundle.ids.size()) {
+    printf("%s: %zu entries instead of %zu\n", name, entries.size(), bundle.ids.size());
+    return false;
+  }
+  for (size_t i = 0; i < entries.size(); ++i) {
+    bool wanted = (std::find(ids.begin(), ids.end(), bundle.ids[i]) != ids.end()) &&
+        !bundle.images[i].empty();
+    if (wanted != (entries[i].data_ != nullptr)) {
+      printf("%s: entry %s is %sextracted\n", name, bundle.ids[i].c_str(),
+             wanted ? "not " : "");
+      return false;
+    }
+    if (wanted && (memcmp(entries[i].data_, bundle.images[i].data(),
+                          bundle.images[i].size()) != 0)) {
+      printf("%s: entry %s differs\n", name, bundle.ids[i].c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool decompress(const Bundle& bundle, hip::BundleStream& stream) {
+  hip::CompressedBundleInfo info;
+  if (!hip::ParseCompressedBundle(bundle.compressed.data(), bundle.compressed.size(), &info)) {
+    return false;
+  }
+  return hip::ZstdDecompress(zstd.stream, info.payload_, info.payloadSize_, stream);
+}
+
+static bool testFixed() {
+  bool ret = true;
+  for (uint16_t version : {2, 3}) {
+    Bundle bundle = makeBundle(4, 300 * 1000, version);
+    hip::CompressedBundleInfo info;
+    if (!hip::ParseCompressedBundle(bundle.compressed.data(), bundle.compressed.size(), &info) ||
+        (info.version_ != version) || (info.uncompressedSize_ != bundle.data.size()) ||
+        (info.totalSize_ != bundle.compressed.size())) {
+      printf("header v%u: parse failed\n", version);
+      ret = false;
+      continue;
+    }
+
+    // The first target only, the decompression must stop before the end
+    std::vector<std::string> ids = {bundle.ids[1]};
+    hip::BundleStream first(selectIds(ids), info.uncompressedSize_);
+    ret = ret && decompress(bundle, first) && checkEntries("first", bundle, first, ids) &&
+        (first.Position() < bundle.data.size());
+
+    // All targets and the host entry without data
+    hip::BundleStream all(selectIds(bundle.ids), info.uncompressedSize_);
+    ret = ret && decompress(bundle, all) && checkEntries("all", bundle, all, bundle.ids);
+
+    // No matching target stops after the index
+    hip::BundleStream none(selectIds({"hipv4-amdgcn-amd-amdhsa--gfx1200"}),
+                           info.uncompressedSize_);
+    ret = ret && decompress(bundle, none) && checkEntries("none", bundle, none, {}) &&
+        (none.Position() < 2 * zstd.stream.dStreamOutSize());
+  }
+
+  Bundle bundle = makeBundle(3, 200 * 1000);
+  // A truncated payload must fail
+  {
+    hip::CompressedBundleInfo info;
+    hip::ParseCompressedBundle(bundle.compressed.data(), bundle.compressed.size(), &info);
+    hip::BundleStream stream(selectIds({bundle.ids.back()}), info.uncompressedSize_);
+    if (hip::ZstdDecompress(zstd.stream, info.payload_, info.payloadSize_ / 2, stream)) {
+      printf("truncated: succeeded\n");
+      ret = false;
+    }
+  }
+  // A corrupted index must fail
+  {
+    std::string data = bundle.data;
+    data[0] = 'X';
+    hip::BundleStream stream(selectIds(bundle.ids), data.size());
+    if (stream.Consume(data.data(), data.size())) {
+      printf("bad magic: succeeded\n");
+      ret = false;
+    }
+  }
+  // An entry beyond the bundle must fail
+  {
+    hip::BundleStream stream(selectIds(bundle.ids), bundle.data.size() - 1);
+    if (stream.Consume(bundle.data.data(), bundle.data.size())) {
+      printf("bad entry: succeeded\n");
+      ret = false;
+    }
+  }
+  // The zlib and the unknown versions are left to comgr
+  {
+    std::string ccob = bundle.compressed;
+    ccob[4] = 7;
+    hip::CompressedBundleInfo info;
+    if (hip::ParseCompressedBundle(ccob.data(), ccob.size(), &info)) {
+      printf("version 7: parsed\n");
+      ret = false;
+    }
+  }
+  // A buffer shorter than the header of its version must fail without reading past its end
+  for (uint16_t version : {2, 3}) {
+    Bundle small = makeBundle(1, 1000, version);
+    hip::CompressedBundleInfo info;
+    for (size_t size = 8; size < 32; ++size) {
+      std::vector<char> ccob(small.compressed.begin(), small.compressed.begin() + size);
+      if (hip::ParseCompressedBundle(ccob.data(), ccob.size(), &info)) {
+        printf("short header of %zu bytes: parsed\n", size);
+        ret = false;
+      }
+    }
+  }
+  printf("%s: %s\n", __func__, ret ? "Succeeded" : "Failed");
+  return ret;
+}
+
+// Feeds the uncompressed bundle in random chunks, so the index and the code objects are split
+// at every possible place
+static bool testChunks(unsigned int iterations) {
+  std::mt19937 rng(7);
+  Bundle bundle = makeBundle(5, 20 * 1000);
+  bool ret = true;
+  for (unsigned int it = 0; it < iterations && ret; ++it) {
+    std::vector<std::string> ids;
+    for (const auto& id : bundle.ids) {
+      if (rng() % 2) {
+        ids.push_back(id);
+      }
+    }
+    hip::BundleStream stream(selectIds(ids), bundle.data.size());
+    size_t max_chunk = 1 + rng() % ((it % 2) ? 64 : 8192);
+    for (size_t pos = 0; (pos < bundle.data.size()) && !stream.Done();) {
+      size_t size = std::min<size_t>(1 + rng() % max_chunk, bundle.data.size() - pos);
+      if (!stream.Consume(bundle.data.data() + pos, size)) {
+        printf("chunks: consume failed at %zu\n", pos);
+        ret = false;
+        break;
+      }
+      pos += size;
+    }
+    ret = ret && stream.Done() && checkEntries("chunks", bundle, stream, ids);
+  }
+  printf("%s(%u iterations): %s\n", __func__, iterations, ret ? "Succeeded" : "Failed");
+  return ret;
+}
+
+struct Result {
+  double ms;
+  long rss_kb;  // Peak RSS growth
+  bool ok;
+};
+
+// Runs the extraction in a child process, so the peak RSS of every mode is separate
+template <typename Fn>
+static Result measure(Fn fn) {
+  int fds[2];
+  Result result = {0, 0, false};
+  if (pipe(fds) != 0) {
+    return result;
+  }
+  pid_t child = fork();
+  if (child == 0) {
+    close(fds[0]);
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    long base = usage.ru_maxrss;
+    auto start = std::chrono::steady_clock::now();
+    result.ok = fn();
+    result.ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    getrusage(RUSAGE_SELF, &usage);
+    result.rss_kb = usage.ru_maxrss - base;
+    ssize_t written = write(fds[1], &result, sizeof(result));
+    _exit((written == sizeof(result)) ? 0 : 1);
+  }
+  close(fds[1]);
+  if ((child < 0) || (read(fds[0], &result, sizeof(result)) != sizeof(result))) {
+    result.ok = false;
+  }
+  close(fds[0]);
+  int status = 0;
+  if (child > 0) {
+    waitpid(child, &status, 0);
+  }
+  return result;
+}
+
+static bool benchmark(size_t targets, size_t image_mb) {
+  Bundle bundle = makeBundle(targets, image_mb * 1000 * 1000);
+  // The parent keeps only the compressed bundle and the reference image
+  const size_t selected = targets / 2 + 1;
+  const std::string reference = bundle.images[selected];
+  const std::string id = bundle.ids[selected];
+  std::string().swap(bundle.data);
+  bundle.images.clear();
+  printf("Bundle: %zu targets x %zu MB, %.1f MB compressed, select %s\n", targets, image_mb,
+         bundle.compressed.size() / 1e6, id.c_str());
+
+  hip::CompressedBundleInfo info;
+  hip::ParseCompressedBundle(bundle.compressed.data(), bundle.compressed.size(), &info);
+
+  // The whole bundle is decompressed in memory and the code object is copied out of it
+  Result full = measure([&]() {
+    char* data = new char[info.uncompressedSize_];
+    size_t size = zstd.decompress(data, info.uncompressedSize_, info.payload_,
+                                  info.payloadSize_);
+    bool ok = !zstd.stream.isError(size);
+    hip::BundleStream stream(selectIds({id}), size);
+    ok = ok && stream.Consume(data, size) && stream.Done() &&
+        (memcmp(stream.Entries()[selected].data_, reference.data(), reference.size()) == 0);
+    delete[] data;
+    return ok;
+  });
+  // Only the selected code object is kept, the decompression stops after it
+  Result streamed = measure([&]() {
+    hip::BundleStream stream(selectIds({id}), info.uncompressedSize_);
+    return hip::ZstdDecompress(zstd.stream, info.payload_, info.payloadSize_, stream) &&
+        (memcmp(stream.Entries()[selected].data_, reference.data(), reference.size()) == 0);
+  });
+
+  printf("%-12s %10.2f ms, peak RSS +%8ld KB\n", "full", full.ms, full.rss_kb);
+  printf("%-12s %10.2f ms, peak RSS +%8ld KB\n", "streaming", streamed.ms, streamed.rss_kb);
+  bool ret = full.ok && streamed.ok;
+  printf("%s: %s\n", __func__, ret ? "Succeeded" : "Failed");
+  return ret;
+}
+
+int main(int argc, char** argv) {
+  // bundle_stream_test [targets] [MB per target]
+  size_t targets = (argc > 1) ? strtoul(argv[1], nullptr, 0) : 8;
+  size_t image_mb = (argc > 2) ? strtoul(argv[2], nullptr, 0) : 25;
+  targets = std::max<size_t>(targets, 1);
+  image_mb = std::max<size_t>(image_mb, 1);
+
+  if (!loadZstd(&zstd)) {
+    printf("Cannot load libzstd.so.1\n");
+    return 1;
+  }
+  bool ret = testFixed();
+  ret = testChunks(2000) && ret;
+  ret = benchmark(targets, image_mb) && ret;
+  return ret ? 0 : 1;
+}
@@ -0,0 +1,315 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+
+#include <hip/hip_runtime.h>
+#include <hip/hip_fp8.h>
+#include <hip/hip_bf16.h>
+#include <hip/hip_fp16.h>
+#include <hip/amd_detail/amd_hip_fp_convert.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+struct Fp8Format {
+  const char* name;
+  hipExtFp8Format_t format;
+  int wm;
+  int we;
+  bool fnuz;
+};
+
+static const Fp8Format kFp8Formats[] = {
+    {"E4M3", hipExtFp8E4M3, 3, 4, false},
+    {"E5M2", hipExtFp8E5M2, 2, 5, false},
+    {"E4M3 FNUZ", hipExtFp8E4M3Fnuz, 3, 4, true},
+    {"E5M2 FNUZ", hipExtFp8E5M2Fnuz, 2, 5, true},
+};
+
+static const uint32_t kSeed = 0x1234567;
+
+static uint32_t floatBits(float f) {
+  uint32_t u;
+  memcpy(&u, &f, sizeof(u));
+  return u;
+}
+
+static float bitsFloat(uint32_t u) {
+  float f;
+  memcpy(&f, &u, sizeof(f));
+  return f;
+}
+
+template <typename T>
+static uint16_t rawBits(T value) {
+  static_assert(sizeof(T) == sizeof(uint16_t), "16 bit type is expected");
+  uint16_t u;
+  memcpy(&u, &value, sizeof(u));
+  return u;
+}
+
+template <typename T>
+static T fromRawBits(uint16_t u) {
+  T value;
+  memcpy(&value, &u, sizeof(u));
+  return value;
+}
+
+static bool isNaN(uint32_t u) { return (u & 0x7FFFFFFF) > 0x7F800000; }
+
+// Scalar reference of the float to fp8 conversion
+static uint8_t fp8Reference(float f, const Fp8Format& fmt, bool saturate, bool stochastic,
+                            size_t index) {
+  uint32_t rng = stochastic ? hipExtFp8StochasticBits(kSeed, index) : 0;
+  return fmt.fnuz
+      ? internal::cast_to_f8<float, true>(f, fmt.wm, fmt.we, saturate, stochastic, rng)
+      : internal::cast_to_f8<float, false>(f, fmt.wm, fmt.we, saturate, stochastic, rng);
+}
+
+static float fp8ToFloatReference(uint8_t x, const Fp8Format& fmt) {
+  return fmt.fnuz ? internal::cast_from_f8<float, true>(x, fmt.wm, fmt.we)
+                  : internal::cast_from_f8<float, false>(x, fmt.wm, fmt.we);
+}
+
+// Stride sweep over all floats and a dense sweep of the fp8 range
+static std::vector<float> testInputs() {
+  std::vector<float> inputs;
+  for (uint64_t bits = 0; bits <= 0xFFFFFFFFull; bits += 4099) {
+    inputs.push_back(bitsFloat(static_cast<uint32_t>(bits)));
+  }
+  for (uint32_t bits = 0x30000000; bits < 0x48000000; bits += 37) {
+    inputs.push_back(bitsFloat(bits));
+    inputs.push_back(bitsFloat(bits | 0x80000000));
+  }
+  for (uint32_t bits : {0x0u, 0x80000000u, 0x7F800000u, 0xFF800000u, 0x7FC00000u, 0x7F800001u,
+                        0xFFBFFFFFu, 0x43700000u, 0x43E00000u, 0x47600000u, 0x477FE000u,
+                        0x477FF000u, 0x33000000u, 0x33000001u, 0x387FC000u, 0x387FE000u}) {
+    inputs.push_back(bitsFloat(bits));
+  }
+  return inputs;
+}
+
+static bool testFp8(const std::vector<float>& inputs) {
+  size_t count = inputs.size();
+  std::vector<uint8_t> out(count);
+  bool ret = true;
+  for (const auto& fmt : kFp8Formats) {
+    for (int saturate = 0; saturate < 2; ++saturate) {
+      for (int stochastic = 0; stochastic < 2; ++stochastic) {
+        hipError_t err = hipExtConvertFloatToFp8(
+            inputs.data(), out.data(), count, fmt.format, saturate,
+            stochastic ? hipExtFp8RoundStochastic : hipExtFp8RoundNearestEven, kSeed);
+        size_t errors = (err != hipSuccess) ? count : 0;
+        for (size_t i = 0; (err == hipSuccess) && (i < count); ++i) {
+          if ((floatBits(inputs[i]) & 0x7FFFFFFF) < 0x21800000) {
+            // The scalar reference is undefined below 2^-60, but the result must be zero
+            errors += ((out[i] & 0x7F) != 0) ? 1 : 0;
+            continue;
+          }
+          uint8_t ref = fp8Reference(inputs[i], fmt, saturate, stochastic, i);
+          if (out[i] != ref) {
+            if (errors++ < 4) {
+              printf("  %s: %08x -> %02x, expected %02x\n", fmt.name, floatBits(inputs[i]),
+                     out[i], ref);
+            }
+          }
+        }
+        printf("float -> %-9s %s %s: %s\n", fmt.name, saturate ? "satfinite" : "noSat    ",
+               stochastic ? "SR " : "RNE", (errors == 0) ? "passed" : "FAILED");
+        ret = ret && (errors == 0);
+      }
+    }
+
+    uint8_t all[256];
+    float values[256];
+    for (uint32_t i = 0; i < 256; ++i) {
+      all[i] = static_cast<uint8_t>(i);
+    }
+    size_t errors = (hipExtConvertFp8ToFloat(all, values, 256, fmt.format) != hipSuccess) ? 1 : 0;
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t ref = floatBits(fp8ToFloatReference(all[i], fmt));
+      uint32_t got = floatBits(values[i]);
+      if ((got != ref) && !(isNaN(got) && isNaN(ref))) {
+        errors++;
+        printf("  %s: %02x -> %08x, expected %08x\n", fmt.name, i, got, ref);
+      }
+    }
+    printf("%-9s -> float: %s\n", fmt.name, (errors == 0) ? "passed" : "FAILED");
+    ret = ret && (errors == 0);
+  }
+  return ret;
+}
+
+template <typename T, typename ToT, typename FromT, typename BulkTo, typename BulkFrom>
+static bool test16(const char* name, const std::vector<float>& inputs, ToT toT, FromT fromT,
+                   BulkTo bulkTo, BulkFrom bulkFrom) {
+  size_t count = inputs.size();
+  std::vector<uint16_t> out(count);
+  size_t errors = (bulkTo(inputs.data(), out.data(), count) != hipSuccess) ? count : 0;
+  for (size_t i = 0; (errors == 0) && (i < count); ++i) {
+    uint16_t ref = rawBits(toT(inputs[i]));
+    if (out[i] != ref) {
+      if (errors++ < 4) {
+        printf("  %08x -> %04x, expected %04x\n", floatBits(inputs[i]), out[i], ref);
+      }
+    }
+  }
+  printf("float -> %-9s: %s\n", name, (errors == 0) ? "passed" : "FAILED");
+  bool ret = (errors == 0);
+
+  std::vector<uint16_t> all(65536);
+  std::vector<float> values(65536);
+  for (uint32_t i = 0; i < 65536; ++i) {
+    all[i] = static_cast<uint16_t>(i);
+  }
+  errors = (bulkFrom(all.data(), values.data(), all.size()) != hipSuccess) ? 1 : 0;
+  for (uint32_t i = 0; i < 65536; ++i) {
+    uint32_t ref = floatBits(fromT(fromRawBits<T>(all[i])));
+    uint32_t got = floatBits(values[i]);
+    if (got != ref) {
+      if (errors++ < 4) {
+        printf("  %04x -> %08x, expected %08x\n", i, got, ref);
+      }
+    }
+  }
+  printf("%-9s -> float: %s\n", name, (errors == 0) ? "passed" : "FAILED");
+  return ret && (errors == 0);
+}
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+template <typename Func>
+static double timeMs(unsigned int iterations, Func func) {
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < iterations; ++i) {
+    func();
+  }
+  return elapsedMs(start) / iterations;
+}
+
+static void benchmark(size_t count, unsigned int iterations) {
+  std::vector<float> src(count);
+  std::vector<uint8_t> fp8(count);
+  std::vector<uint16_t> half(count);
+  std::vector<float> dst(count);
+  // Weights like values in the fp8 range
+  for (size_t i = 0; i < count; ++i) {
+    src[i] = bitsFloat(0x3C000000u + static_cast<uint32_t>(i * 2654435761u) % 0x07000000u) *
+        ((i & 1) ? -1.0f : 1.0f);
+  }
+
+  auto report = [&](const char* name, size_t bytes, double bulk, double scalar) {
+    printf("%-24s bulk %8.2f ms (%7.2f GB/s), scalar %8.2f ms, speedup %6.2fx\n", name, bulk,
+           bytes / bulk / 1e6, scalar, scalar / bulk);
+  };
+  size_t bytes = count * sizeof(float);
+
+  double bulk = timeMs(iterations, [&]() {
+    hipExtConvertFloatToFp8(src.data(), fp8.data(), count, hipExtFp8E4M3, 1,
+                            hipExtFp8RoundNearestEven, 0);
+  });
+  double scalar = timeMs(iterations, [&]() {
+    for (size_t i = 0; i < count; ++i) {
+      fp8[i] = __hip_cvt_float_to_fp8(src[i], __HIP_SATFINITE, __HIP_E4M3);
+    }
+  });
+  report("float -> E4M3 RNE", bytes, bulk, scalar);
+
+  bulk = timeMs(iterations, [&]() {
+    hipExtConvertFloatToFp8(src.data(), fp8.data(), count, hipExtFp8E4M3Fnuz, 1,
+                            hipExtFp8RoundStochastic, kSeed);
+  });
+  scalar = timeMs(iterations, [&]() {
+    for (size_t i = 0; i < count; ++i) {
+      fp8[i] = internal::cast_to_f8<float, true>(src[i], 3, 4, true, true,
+                                                 hipExtFp8StochasticBits(kSeed, i));
+    }
+  });
+  report("float -> E4M3 FNUZ SR", bytes, bulk, scalar);
+
+  bulk = timeMs(iterations,
+                [&]() { hipExtConvertFp8ToFloat(fp8.data(), dst.data(), count, hipExtFp8E4M3); });
+  scalar = timeMs(iterations, [&]() {
+    for (size_t i = 0; i < count; ++i) {
+      dst[i] = internal::cast_from_f8<float, false>(fp8[i], 3, 4);
+    }
+  });
+  report("E4M3 -> float", bytes, bulk, scalar);
+
+  bulk = timeMs(iterations, [&]() { hipExtConvertFloatToBf16(src.data(), half.data(), count); });
+  scalar = timeMs(iterations, [&]() {
+    for (size_t i = 0; i < count; ++i) {
+      half[i] = rawBits(__float2bfloat16(src[i]));
+    }
+  });
+  report("float -> bf16", bytes, bulk, scalar);
+
+  bulk = timeMs(iterations, [&]() { hipExtConvertFloatToHalf(src.data(), half.data(), count); });
+  scalar = timeMs(iterations, [&]() {
+    for (size_t i = 0; i < count; ++i) {
+      half[i] = rawBits(__float2half(src[i]));
+    }
+  });
+  report("float -> half", bytes, bulk, scalar);
+
+  bulk = timeMs(iterations, [&]() { hipExtConvertHalfToFloat(half.data(), dst.data(), count); });
+  scalar = timeMs(iterations, [&]() {
+    for (size_t i = 0; i < count; ++i) {
+      dst[i] = __half2float(fromRawBits<__half>(half[i]));
+    }
+  });
+  report("half -> float", bytes, bulk, scalar);
+}
+
+int main(int argc, char** argv) {
+  // Initializes the runtime, so DEBUG_HIP_FP_CONVERT_ISA is applied
+  if (hipInit(0) != hipSuccess) {
+    printf("hipInit() failed\n");
+    return 1;
+  }
+  // fp_convert_test [elements] [iterations]
+  size_t count = (argc > 1) ? strtoull(argv[1], nullptr, 0) : (64 << 20);
+  unsigned int iterations = (argc > 2) ? strtoul(argv[2], nullptr, 0) : 5;
+  iterations = (iterations == 0) ? 1 : iterations;
+
+  std::vector<float> inputs = testInputs();
+  bool ret = testFp8(inputs);
+  ret = test16<__hip_bfloat16>(
+            "bf16", inputs, [](float f) { return __float2bfloat16(f); },
+            [](__hip_bfloat16 h) { return __bfloat162float(h); }, hipExtConvertFloatToBf16,
+            hipExtConvertBf16ToFloat) &&
+      ret;
+  ret = test16<__half>(
+            "half", inputs, [](float f) { return __float2half(f); },
+            [](__half h) { return __half2float(h); }, hipExtConvertFloatToHalf,
+            hipExtConvertHalfToFloat) &&
+      ret;
+
+  benchmark(count, iterations);
+  printf("%s: %zu elements, %u iterations %s!\n", __func__, count, iterations,
+         ret ? "Succeeded" : "Failed");
+  return ret ? 0 : 1;
+}
@@ -0,0 +1,196 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#include "hip_mem_range.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// CPU test of the range coalescing of the batched prefetch and advise. The reference applies
+// every range of the batch in order to a byte map, where the last key wins. The coalesced
+// ranges must produce the same map.
+typedef hip::MemRange<int> Range;
+
+struct Input {
+  uintptr_t start;
+  size_t size;
+  int key;
+};
+
+static std::vector<Range> coalesce(const std::vector<Input>& batch, size_t* epochs = nullptr) {
+  hip::MemRangeCoalescer<int> coalescer;
+  for (const auto& it : batch) {
+    coalescer.Add(it.start, it.size, it.key);
+  }
+  if (epochs != nullptr) {
+    *epochs = coalescer.Epochs();
+  }
+  return coalescer.Finish();
+}
+
+static bool check(const char* name, const std::vector<Input>& batch, size_t space,
+                  size_t expected = 0, bool quiet = false) {
+  std::vector<int> reference(space, -1);
+  for (const auto& it : batch) {
+    for (size_t i = it.start; i < it.start + it.size; ++i) {
+      reference[i] = it.key;
+    }
+  }
+  size_t epochs = 0;
+  std::vector<Range> ranges = coalesce(batch, &epochs);
+  std::vector<int> result(space, -1);
+  for (const auto& it : ranges) {
+    if ((it.start_ >= it.end_) || (it.end_ > space)) {
+      printf("%s: invalid range [%zu, %zu)\n", name, static_cast<size_t>(it.start_),
+             static_cast<size_t>(it.end_));
+      return false;
+    }
+    for (size_t i = it.start_; i < it.end_; ++i) {
+      result[i] = it.key_;
+    }
+  }
+  if (result != reference) {
+    printf("%s: the coalesced ranges change the result\n", name);
+    return false;
+  }
+  // The epochs are in order, the ranges of an epoch are sorted and disjoint and a key never
+  // touches itself
+  for (size_t i = 1; i < ranges.size(); ++i) {
+    const Range& prev = ranges[i - 1];
+    const Range& next = ranges[i];
+    if (next.epoch_ < prev.epoch_) {
+      printf("%s: epoch %zu follows epoch %zu\n", name, next.epoch_, prev.epoch_);
+      return false;
+    }
+    if ((next.epoch_ == prev.epoch_) && ((next.start_ < prev.end_) ||
+        ((next.start_ == prev.end_) && (next.key_ == prev.key_)))) {
+      printf("%s: ranges [%zu, %zu) and [%zu, %zu) weren't merged\n", name,
+             static_cast<size_t>(prev.start_), static_cast<size_t>(prev.end_),
+             static_cast<size_t>(next.start_), static_cast<size_t>(next.end_));
+      return false;
+    }
+  }
+  if ((expected != 0) && (ranges.size() != expected)) {
+    printf("%s: %zu ranges, expected %zu\n", name, ranges.size(), expected);
+    return false;
+  }
+  if (!quiet) {
+    printf("%-20s %6zu ranges -> %6zu ranges, %4zu epochs\n", name, batch.size(),
+           ranges.size(), epochs);
+  }
+  return true;
+}
+
+static bool testCases() {
+  bool ret = true;
+  std::vector<Input> batch;
+
+  // Adjacent tensors of one allocation become a single range
+  batch.clear();
+  for (size_t i = 0; i < 1000; ++i) {
+    batch.push_back({i * 64, 64, 0});
+  }
+  ret &= check("adjacent", batch, 64000, 1);
+
+  // The same tensors in reverse order
+  batch.clear();
+  for (size_t i = 1000; i > 0; --i) {
+    batch.push_back({(i - 1) * 64, 64, 0});
+  }
+  ret &= check("adjacent reversed", batch, 64000, 1);
+
+  // Gaps keep the ranges separate
+  batch.clear();
+  for (size_t i = 0; i < 100; ++i) {
+    batch.push_back({i * 128, 64, 0});
+  }
+  ret &= check("gaps", batch, 12800, 100);
+
+  // Interleaved destinations without overlaps: one range per touching run, one epoch
+  batch.clear();
+  for (size_t i = 0; i < 100; ++i) {
+    batch.push_back({i * 64, 64, static_cast<int>((i / 10) % 2)});
+  }
+  ret &= check("interleaved", batch, 6400, 10);
+
+  // Duplicates and nested ranges of the same key
+  batch = {{0, 100, 1}, {10, 20, 1}, {0, 100, 1}, {50, 100, 1}, {150, 10, 1}};
+  ret &= check("nested", batch, 200, 1);
+
+  // A later range of another key overrides a part of an earlier range
+  batch = {{0, 100, 1}, {20, 10, 2}, {100, 50, 1}};
+  ret &= check("override", batch, 200, 3);
+
+  // Migrate back and forth: the order must be kept
+  batch = {{0, 64, 1}, {0, 64, 2}, {0, 64, 1}, {64, 64, 1}};
+  ret &= check("ping-pong", batch, 128, 3);
+  return ret;
+}
+
+static bool testRandom(unsigned int iterations) {
+  std::mt19937 rng(0x1234567);
+  bool ret = true;
+  for (unsigned int iter = 0; (iter < iterations) && ret; ++iter) {
+    const size_t space = 4096;
+    std::vector<Input> batch(1 + rng() % 256);
+    for (auto& it : batch) {
+      it.size = 1 + rng() % ((iter % 2) ? 64 : 512);
+      it.start = rng() % (space - it.size);
+      it.key = rng() % (1 + iter % 4);
+    }
+    ret = check("random", batch, space, 0, true);
+  }
+  printf("%-20s %6u batches %s\n", "random", iterations, ret ? "matched" : "failed");
+  return ret;
+}
+
+static void benchmark(size_t count) {
+  // A training step: many small tensors of a few allocations, prefetched to one device
+  std::vector<Input> batch;
+  std::mt19937 rng(0x7654321);
+  const size_t allocations = 8;
+  for (size_t i = 0; i < count; ++i) {
+    size_t alloc = i % allocations;
+    batch.push_back({(alloc << 32) + (i / allocations) * 4096, 4096, static_cast<int>(alloc)});
+  }
+  std::shuffle(batch.begin(), batch.end(), rng);
+  auto start = std::chrono::steady_clock::now();
+  std::vector<Range> ranges = coalesce(batch);
+  auto end = std::chrono::steady_clock::now();
+  printf("benchmark: %zu ranges -> %zu ranges in %.3f ms\n", count, ranges.size(),
+         std::chrono::duration<double, std::milli>(end - start).count());
+}
+
+int main(int argc, char** argv) {
+  // mem_range_test [random iterations] [benchmark ranges]
+  unsigned int iterations = (argc > 1) ? strtoul(argv[1], nullptr, 0) : 2000;
+  size_t count = (argc > 2) ? strtoul(argv[2], nullptr, 0) : 100000;
+
+  bool ret = testCases() && testRandom(iterations);
+  if (ret) {
+    benchmark(count);
+  }
+  printf("mem_range_test %s!\n", ret ? "Succeeded" : "Failed");
+  return ret ? 0 : 1;
+}
@@ -18,6 +18,15 @@
 #include <cstring>
 #include <cstdlib>
 #include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "cltrace.hpp"
 
 #ifdef _MSC_VER
 #include <windows.h>
@@ -4358,6 +4367,349 @@ modified_dispatch = {
     NULL, /* clSetProgramSpecializationConstant */
 };
 
+// ================================================================================================
+// Binary trace mode (CL_TRACE_MODE=binary). Every call writes a fixed size record into a buffer
+// of the calling thread, which is flushed to the file only when it's full. The buffer lock is
+// contended only by the final flush, so the threads don't serialize and nothing is formatted
+// on the hot path. cltrace_convert turns the file
+// into the text trace or a Chrome/Perfetto JSON timeline. The per API latency summary is
+// printed at exit.
+
+#define TRACED_APIS(X) \
+    X(GetPlatformIDs) \
+    X(GetPlatformInfo) \
+    X(GetDeviceIDs) \
+    X(GetDeviceInfo) \
+    X(CreateContext) \
+    X(CreateContextFromType) \
+    X(RetainContext) \
+    X(ReleaseContext) \
+    X(GetContextInfo) \
+    X(CreateCommandQueue) \
+    X(RetainCommandQueue) \
+    X(ReleaseCommandQueue) \
+    X(GetCommandQueueInfo) \
+    X(SetCommandQueueProperty) \
+    X(CreateBuffer) \
+    X(CreateImage2D) \
+    X(CreateImage3D) \
+    X(RetainMemObject) \
+    X(ReleaseMemObject) \
+    X(GetSupportedImageFormats) \
+    X(GetMemObjectInfo) \
+    X(GetImageInfo) \
+    X(CreateSampler) \
+    X(RetainSampler) \
+    X(ReleaseSampler) \
+    X(GetSamplerInfo) \
+    X(CreateProgramWithSource) \
+    X(CreateProgramWithBinary) \
+    X(RetainProgram) \
+    X(ReleaseProgram) \
+    X(BuildProgram) \
+    X(UnloadCompiler) \
+    X(GetProgramInfo) \
+    X(GetProgramBuildInfo) \
+    X(CreateKernel) \
+    X(CreateKernelsInProgram) \
+    X(RetainKernel) \
+    X(ReleaseKernel) \
+    X(SetKernelArg) \
+    X(GetKernelInfo) \
+    X(GetKernelWorkGroupInfo) \
+    X(WaitForEvents) \
+    X(GetEventInfo) \
+    X(RetainEvent) \
+    X(ReleaseEvent) \
+    X(GetEventProfilingInfo) \
+    X(Flush) \
+    X(Finish) \
+    X(EnqueueReadBuffer) \
+    X(EnqueueWriteBuffer) \
+    X(EnqueueCopyBuffer) \
+    X(EnqueueReadImage) \
+    X(EnqueueWriteImage) \
+    X(EnqueueCopyImage) \
+    X(EnqueueCopyImageToBuffer) \
+    X(EnqueueCopyBufferToImage) \
+    X(EnqueueMapBuffer) \
+    X(EnqueueMapImage) \
+    X(EnqueueUnmapMemObject) \
+    X(EnqueueNDRangeKernel) \
+    X(EnqueueTask) \
+    X(EnqueueNativeKernel) \
+    X(EnqueueMarker) \
+    X(EnqueueWaitForEvents) \
+    X(EnqueueBarrier) \
+    X(GetExtensionFunctionAddress) \
+    X(CreateFromGLBuffer) \
+    X(CreateFromGLTexture2D) \
+    X(CreateFromGLTexture3D) \
+    X(CreateFromGLRenderbuffer) \
+    X(GetGLObjectInfo) \
+    X(GetGLTextureInfo) \
+    X(EnqueueAcquireGLObjects) \
+    X(EnqueueReleaseGLObjects) \
+    X(GetGLContextInfoKHR) \
+    X(SetEventCallback) \
+    X(CreateSubBuffer) \
+    X(SetMemObjectDestructorCallback) \
+    X(CreateUserEvent) \
+    X(SetUserEventStatus) \
+    X(EnqueueReadBufferRect) \
+    X(EnqueueWriteBufferRect) \
+    X(EnqueueCopyBufferRect) \
+    X(RetainDevice) \
+    X(ReleaseDevice) \
+    X(CreateImage) \
+    X(CreateProgramWithBuiltInKernels) \
+    X(CompileProgram) \
+    X(LinkProgram) \
+    X(UnloadPlatformCompiler) \
+    X(GetKernelArgInfo) \
+    X(EnqueueFillBuffer) \
+    X(EnqueueFillImage) \
+    X(EnqueueMigrateMemObjects) \
+    X(EnqueueMarkerWithWaitList) \
+    X(EnqueueBarrierWithWaitList) \
+    X(GetExtensionFunctionAddressForPlatform) \
+    X(CreateFromGLTexture) \
+    X(CreateCommandQueueWithProperties) \
+    X(CreatePipe) \
+    X(GetPipeInfo) \
+    X(SVMAlloc) \
+    X(SVMFree) \
+    X(EnqueueSVMFree) \
+    X(EnqueueSVMMemcpy) \
+    X(EnqueueSVMMemFill) \
+    X(EnqueueSVMMap) \
+    X(EnqueueSVMUnmap) \
+    X(CreateSamplerWithProperties) \
+    X(SetKernelArgSVMPointer) \
+    X(SetKernelExecInfo)
+
+enum TracedApi {
+#define X(name) Api_##name,
+    TRACED_APIS(X)
+#undef X
+    NumTracedApis
+};
+
+static const char* tracedApiNames[NumTracedApis] = {
+#define X(name) "cl" #name,
+    TRACED_APIS(X)
+#undef X
+};
+
+// Number of the records in a thread buffer, 256KB per thread
+static const uint32_t traceBufferRecords = 4096;
+
+struct TraceBuffer {
+    std::mutex lock;       // Guards the records and the stats against the final flush
+    uint32_t thread;
+    uint32_t count;
+    TraceRecord records[traceBufferRecords];
+    TraceStats stats[NumTracedApis];
+};
+
+// The globals below are never destroyed, since a thread can exit after the static destruction.
+// Lock order: traceMtx, TraceBuffer::lock, traceFileMtx
+static FILE* traceFile = NULL;
+static std::mutex& traceFileMtx = *new std::mutex();       // Guards the file
+static std::mutex& traceMtx = *new std::mutex();           // Guards the buffer list and stats
+static std::vector<TraceBuffer*>& traceBuffers =           // Buffers of the live threads
+    *new std::vector<TraceBuffer*>();
+static std::vector<TraceStats>& traceStats =               // Stats of the exited threads
+    *new std::vector<TraceStats>(NumTracedApis);
+static std::atomic<bool> traceActive(false);
+static uint32_t traceThreads = 0;
+
+static inline uint64_t
+traceTime(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Writes the records of the buffer. Called with the buffer lock held
+static void
+flushTraceBuffer(TraceBuffer* b)
+{
+    std::lock_guard<std::mutex> lock(traceFileMtx);
+    if (traceFile != NULL && b->count != 0) {
+        fwrite(b->records, sizeof(TraceRecord), b->count, traceFile);
+    }
+    b->count = 0;
+}
+
+// Owns the buffer of a thread, which is flushed and merged into the totals at thread exit
+struct TraceBufferHolder {
+    TraceBuffer* buffer = NULL;
+
+    TraceBuffer*
+    get(void)
+    {
+        if (buffer == NULL) {
+            buffer = new TraceBuffer();
+            std::lock_guard<std::mutex> lock(traceMtx);
+            buffer->thread = traceThreads++;
+            traceBuffers.push_back(buffer);
+        }
+        return buffer;
+    }
+
+    ~TraceBufferHolder()
+    {
+        if (buffer == NULL) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(traceMtx);
+        {
+            std::lock_guard<std::mutex> bufferLock(buffer->lock);
+            flushTraceBuffer(buffer);
+            for (uint32_t i = 0; i < NumTracedApis; ++i) {
+                traceStats[i].merge(buffer->stats[i]);
+            }
+        }
+        traceBuffers.erase(
+            std::find(traceBuffers.begin(), traceBuffers.end(), buffer));
+        delete buffer;
+    }
+};
+
+static thread_local TraceBufferHolder traceBuffer;
+
+template <typename T>
+static inline uint64_t
+traceArg(T value)
+{
+    if constexpr (std::is_pointer<T>::value) {
+        return reinterpret_cast<uintptr_t>(value);
+    }
+    else {
+        return static_cast<uint64_t>(value);
+    }
+}
+
+template <typename... A>
+static inline void
+recordCall(uint16_t api, uint64_t start, uint8_t ret, uint64_t value, A... args)
+{
+    uint64_t end = traceTime();
+    if (!traceActive.load(std::memory_order_relaxed)) {
+        return;
+    }
+    TraceBuffer* b = traceBuffer.get();
+    std::lock_guard<std::mutex> lock(b->lock);
+    TraceRecord& r = b->records[b->count];
+    r.api = api;
+    r.numArgs = static_cast<uint8_t>(std::min<size_t>(sizeof...(A), MaxTraceArgs));
+    r.ret = ret;
+    r.thread = b->thread;
+    r.start = start;
+    r.end = end;
+    r.value = value;
+    const uint64_t all[] = { traceArg(args)..., 0 };
+    for (uint32_t i = 0; i < MaxTraceArgs; ++i) {
+        r.args[i] = (i < r.numArgs) ? all[i] : 0;
+    }
+    b->stats[api].add(end - start);
+
+    if (++b->count == traceBufferRecords) {
+        flushTraceBuffer(b);
+    }
+}
+
+// The binary trace wrapper of a dispatch table entry
+template <typename T, T cl_icd_dispatch_table::*Entry, uint16_t Api>
+struct BinaryTrace;
+
+template <typename R, typename... A, R (CL_API_CALL* cl_icd_dispatch_table::*Entry)(A...),
+          uint16_t Api>
+struct BinaryTrace<R (CL_API_CALL*)(A...), Entry, Api> {
+    static R CL_API_CALL
+    call(A... args)
+    {
+        uint64_t start = traceTime();
+        if constexpr (std::is_void<R>::value) {
+            (original_dispatch.*Entry)(args...);
+            recordCall(Api, start, TraceReturnVoid, 0, args...);
+        }
+        else {
+            R ret = (original_dispatch.*Entry)(args...);
+            if constexpr (std::is_pointer<R>::value) {
+                recordCall(Api, start, TraceReturnHandle, traceArg(ret), args...);
+            }
+            else {
+                recordCall(Api, start, TraceReturnStatus,
+                    static_cast<uint64_t>(static_cast<int64_t>(ret)), args...);
+            }
+            return ret;
+        }
+    }
+};
+
+static cl_icd_dispatch_table binary_dispatch;
+
+// Flushes all buffers, prints the summary and closes the file. A thread, which is still
+// in a call at exit, may lose its last record.
+static void
+finishBinaryTrace(void)
+{
+    if (!traceActive.exchange(false)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(traceMtx);
+    std::vector<TraceStats> stats = traceStats;
+    for (TraceBuffer* b : traceBuffers) {
+        std::lock_guard<std::mutex> bufferLock(b->lock);
+        flushTraceBuffer(b);
+        for (uint32_t i = 0; i < NumTracedApis; ++i) {
+            stats[i].merge(b->stats[i]);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> fileLock(traceFileMtx);
+        fclose(traceFile);
+        traceFile = NULL;
+    }
+
+    std::vector<std::string> names(tracedApiNames, tracedApiNames + NumTracedApis);
+    printTraceSummary(stderr, names, stats);
+}
+
+static int32_t
+startBinaryTrace(const std::string& fileName, int32_t pid)
+{
+    traceFile = fopen(fileName.c_str(), "wb");
+    if (traceFile == NULL) {
+        std::cerr << "cltrace: can't open " << fileName << std::endl;
+        return CL_INVALID_VALUE;
+    }
+
+    TraceHeader header = {};
+    memcpy(header.magic, TraceMagic, sizeof(TraceMagic));
+    header.version = TraceVersion;
+    header.recordSize = sizeof(TraceRecord);
+    header.numApis = NumTracedApis;
+    header.pid = static_cast<uint32_t>(pid);
+    fwrite(&header, sizeof(header), 1, traceFile);
+    for (uint32_t i = 0; i < NumTracedApis; ++i) {
+        fwrite(tracedApiNames[i], strlen(tracedApiNames[i]) + 1, 1, traceFile);
+    }
+
+    binary_dispatch = modified_dispatch;
+#define X(name) \
+    binary_dispatch.name = BinaryTrace<decltype(cl_icd_dispatch_table::name), \
+        &cl_icd_dispatch_table::name, Api_##name>::call;
+    TRACED_APIS(X)
+#undef X
+
+    traceActive = true;
+    std::atexit(finishBinaryTrace);
+    return CL_SUCCESS;
+}
+
 static void
 cleanup(void)
 {
@@ -4383,21 +4735,30 @@ vdiAgent_OnLoad(vdi_agent * agent)
         return err;
     }
 
+#if defined(_WIN32)
+    const std::int32_t pid = _getpid();
+#else
+    const std::int32_t pid = getpid();
+#endif
+    const char* clTraceModeEnv = getenv("CL_TRACE_MODE");
+    const bool binaryTrace = clTraceModeEnv != NULL && strcmp(clTraceModeEnv, "binary") == 0;
+
+    std::string clTraceLogStr;
     clTraceLogEnv = getenv("CL_TRACE_OUTPUT");
     if(clTraceLogEnv!=NULL) {
-        std::string clTraceLogStr = clTraceLogEnv;
+        clTraceLogStr = clTraceLogEnv;
         const std::size_t pidPos = clTraceLogStr.find("%pid%");
         if (pidPos != std::string::npos) {
-#if defined(_WIN32)
-            const std::int32_t pid = _getpid();
-#else
-            const std::int32_t pid = getpid();
-#endif
             clTraceLogStr.replace(pidPos, 5, std::to_string(pid));
         }
-        clTraceLog.open(clTraceLogStr);
-        cerrStreamBufSave = std::cerr.rdbuf(clTraceLog.rdbuf());
-        std::atexit(cleanup);
+        if (!binaryTrace) {
+            clTraceLog.open(clTraceLogStr);
+            cerrStreamBufSave = std::cerr.rdbuf(clTraceLog.rdbuf());
+            std::atexit(cleanup);
+        }
+    }
+    else if (binaryTrace) {
+        clTraceLogStr = "cltrace_" + std::to_string(pid) + ".bin";
     }
 
     cl_platform_id platform;
@@ -4433,6 +4794,17 @@ vdiAgent_OnLoad(vdi_agent * agent)
     SET_ORIGINAL(SetProgramReleaseCallback);
     SET_ORIGINAL(SetProgramSpecializationConstant);
 
+    if (binaryTrace) {
+        err = startBinaryTrace(clTraceLogStr, pid);
+        if (err != CL_SUCCESS) {
+            return err;
+        }
+        std::cerr << "!!! Binary trace to \"" << clTraceLogStr << "\"" << std::endl;
+        // The binary wrappers don't use the checker list
+        return agent->SetICDDispatchTable(
+            agent, &binary_dispatch, sizeof(binary_dispatch));
+    }
+
     err = agent->SetICDDispatchTable(
             agent, &modified_dispatch, sizeof(modified_dispatch));
     if (err != CL_SUCCESS) {
@@ -4447,5 +4819,6 @@ vdiAgent_OnLoad(vdi_agent * agent)
 void CL_CALLBACK
 vdiAgent_OnUnload(vdi_agent * agent)
 {
+    finishBinaryTrace();
     clTraceLog.close();
 }
@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Binary trace file, written with CL_TRACE_MODE=binary and read by cltrace_convert:
+// a TraceHeader, numApis NUL terminated API names and then TraceRecords in the flush order.
+static const char TraceMagic[8] = {'C', 'L', 'T', 'R', 'A', 'C', 'E', 0};
+static const uint32_t TraceVersion = 1;
+static const uint32_t MaxTraceArgs = 4;
+
+struct TraceHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;   // sizeof(TraceRecord)
+    uint32_t numApis;      // Number of API names after the header
+    uint32_t pid;
+};
+
+// Kind of the returned value
+enum TraceReturn {
+    TraceReturnVoid = 0,
+    TraceReturnStatus = 1,  // cl_int error code
+    TraceReturnHandle = 2,  // Object handle or pointer
+};
+
+// A fixed size record of one API call. The first MaxTraceArgs arguments are kept as
+// integers, pointers and handles as their addresses.
+struct TraceRecord {
+    uint16_t api;          // Index in the API names
+    uint8_t numArgs;       // Number of the valid args
+    uint8_t ret;           // TraceReturn
+    uint32_t thread;       // Sequential thread id
+    uint64_t start;        // Steady clock time in ns
+    uint64_t end;
+    uint64_t value;        // Returned value
+    uint64_t args[MaxTraceArgs];
+};
+
+static_assert(sizeof(TraceRecord) == 64, "TraceRecord must be a fixed 64 bytes record");
+
+// Aggregate latency of an API
+struct TraceStats {
+    uint64_t count = 0;
+    uint64_t total = 0;
+    uint64_t min = UINT64_MAX;
+    uint64_t max = 0;
+
+    void add(uint64_t ns) {
+        ++count;
+        total += ns;
+        min = std::min(min, ns);
+        max = std::max(max, ns);
+    }
+
+    void merge(const TraceStats& s) {
+        count += s.count;
+        total += s.total;
+        min = std::min(min, s.min);
+        max = std::max(max, s.max);
+    }
+};
+
+// Prints the per API latency summary, the most expensive APIs first
+static inline void
+printTraceSummary(FILE* out, const std::vector<std::string>& names,
+    const std::vector<TraceStats>& stats)
+{
+    std::vector<size_t> order;
+    for (size_t i = 0; i < stats.size(); ++i) {
+        if (stats[i].count != 0) {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&stats](size_t a, size_t b) {
+        return stats[a].total > stats[b].total;
+    });
+
+    fprintf(out, "%-40s %10s %14s %12s %12s %12s\n", "API", "Calls", "Total(us)",
+        "Avg(us)", "Min(us)", "Max(us)");
+    for (size_t i : order) {
+        const TraceStats& s = stats[i];
+        fprintf(out, "%-40s %10llu %14.3f %12.3f %12.3f %12.3f\n",
+            (i < names.size()) ? names[i].c_str() : "unknown",
+            static_cast<unsigned long long>(s.count), s.total / 1e3,
+            s.total / 1e3 / s.count, s.min / 1e3, s.max / 1e3);
+    }
+}
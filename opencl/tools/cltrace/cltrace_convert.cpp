@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+
+// Converts a binary trace of cltrace (CL_TRACE_MODE=binary) into the text trace,
+// a Chrome/Perfetto JSON timeline or the per API latency summary.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "cltrace.hpp"
+
+static void
+usage(const char* name)
+{
+    fprintf(stderr, "Usage: %s <trace file> [text|json|summary]\n", name);
+}
+
+static bool
+readTrace(const char* fileName, TraceHeader* header, std::vector<std::string>* names,
+    std::vector<TraceRecord>* records)
+{
+    FILE* f = fopen(fileName, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "Can't open %s\n", fileName);
+        return false;
+    }
+    if (fread(header, sizeof(*header), 1, f) != 1 ||
+        memcmp(header->magic, TraceMagic, sizeof(TraceMagic)) != 0 ||
+        header->version != TraceVersion || header->recordSize != sizeof(TraceRecord)) {
+        fprintf(stderr, "%s isn't a cltrace binary trace\n", fileName);
+        fclose(f);
+        return false;
+    }
+
+    for (uint32_t i = 0; i < header->numApis; ++i) {
+        std::string name;
+        int c;
+        while ((c = fgetc(f)) != EOF && c != '\0') {
+            name += static_cast<char>(c);
+        }
+        if (c == EOF) {
+            fprintf(stderr, "Truncated API names in %s\n", fileName);
+            fclose(f);
+            return false;
+        }
+        names->push_back(name);
+    }
+
+    TraceRecord r;
+    while (fread(&r, sizeof(r), 1, f) == 1) {
+        if (r.api < header->numApis) {
+            records->push_back(r);
+        }
+    }
+    fclose(f);
+
+    // The threads flush their buffers independently, so restore the time order
+    std::stable_sort(records->begin(), records->end(),
+        [](const TraceRecord& a, const TraceRecord& b) { return a.start < b.start; });
+    return true;
+}
+
+static void
+printValue(FILE* out, uint8_t ret, uint64_t value)
+{
+    if (ret == TraceReturnStatus) {
+        int32_t status = static_cast<int32_t>(value);
+        if (status == 0) {
+            fprintf(out, "CL_SUCCESS");
+        }
+        else {
+            fprintf(out, "%d", status);
+        }
+    }
+    else if (ret == TraceReturnHandle) {
+        fprintf(out, "0x%" PRIx64, value);
+    }
+}
+
+// The same shape as the text trace, with the recorded arguments only
+static void
+writeText(FILE* out, const std::vector<std::string>& names,
+    const std::vector<TraceRecord>& records)
+{
+    uint64_t base = records.empty() ? 0 : records.front().start;
+    for (const TraceRecord& r : records) {
+        fprintf(out, "[%u] %12.3f us %10.3f us %s(", r.thread, (r.start - base) / 1e3,
+            (r.end - r.start) / 1e3, names[r.api].c_str());
+        for (uint32_t i = 0; i < r.numArgs; ++i) {
+            fprintf(out, "%s0x%" PRIx64, (i != 0) ? "," : "", r.args[i]);
+        }
+        fprintf(out, ")");
+        if (r.ret != TraceReturnVoid) {
+            fprintf(out, " = ");
+            printValue(out, r.ret, r.value);
+        }
+        fprintf(out, "\n");
+    }
+}
+
+// Chrome trace event format, which chrome://tracing and Perfetto load
+static void
+writeJson(FILE* out, const TraceHeader& header, const std::vector<std::string>& names,
+    const std::vector<TraceRecord>& records)
+{
+    uint64_t base = records.empty() ? 0 : records.front().start;
+    fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    for (size_t i = 0; i < records.size(); ++i) {
+        const TraceRecord& r = records[i];
+        fprintf(out, "{\"name\":\"%s\",\"cat\":\"cl\",\"ph\":\"X\",\"pid\":%u,\"tid\":%u,"
+            "\"ts\":%.3f,\"dur\":%.3f,\"args\":{", names[r.api].c_str(), header.pid, r.thread,
+            (r.start - base) / 1e3, (r.end - r.start) / 1e3);
+        for (uint32_t a = 0; a < r.numArgs; ++a) {
+            fprintf(out, "%s\"arg%u\":\"0x%" PRIx64 "\"", (a != 0) ? "," : "", a, r.args[a]);
+        }
+        if (r.ret != TraceReturnVoid) {
+            fprintf(out, "%s\"ret\":\"", (r.numArgs != 0) ? "," : "");
+            printValue(out, r.ret, r.value);
+            fprintf(out, "\"");
+        }
+        fprintf(out, "}}%s\n", (i + 1 < records.size()) ? "," : "");
+    }
+    fprintf(out, "]}\n");
+}
+
+int
+main(int argc, char** argv)
+{
+    if (argc < 2) {
+        usage(argv[0]);
+        return 1;
+    }
+    const char* mode = (argc > 2) ? argv[2] : "text";
+
+    TraceHeader header;
+    std::vector<std::string> names;
+    std::vector<TraceRecord> records;
+    if (!readTrace(argv[1], &header, &names, &records)) {
+        return 1;
+    }
+
+    if (strcmp(mode, "text") == 0) {
+        writeText(stdout, names, records);
+    }
+    else if (strcmp(mode, "json") == 0) {
+        writeJson(stdout, header, names, records);
+    }
+    else if (strcmp(mode, "summary") == 0) {
+        std::vector<TraceStats> stats(names.size());
+        for (const TraceRecord& r : records) {
+            stats[r.api].add(r.end - r.start);
+        }
+        printTraceSummary(stdout, names, stats);
+    }
+    else {
+        usage(argv[0]);
+        return 1;
+    }
+    return 0;
+}
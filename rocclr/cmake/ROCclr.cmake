@@ -30,6 +30,7 @@ option(ROCCLR_ENABLE_HSAIL "Enable support for HSAIL compiler" OFF)
 option(ROCCLR_ENABLE_LC    "Enable support for LC compiler"    ON)
 option(ROCCLR_ENABLE_HSA   "Enable support for HSA runtime"    ON)
 option(ROCCLR_ENABLE_PAL   "Enable support for PAL runtime"    OFF)
+option(ROCCLR_ENABLE_HSA_MOCK "Link a mock HSA runtime for CPU-only testing" OFF)
 
 if((NOT ROCCLR_ENABLE_HSAIL) AND (NOT ROCCLR_ENABLE_LC))
   message(FATAL "Support for at least one compiler needs to be enabled!")
@@ -67,15 +68,20 @@ target_sources(rocclr PRIVATE
   ${ROCCLR_SRC_DIR}/device/appprofile.cpp
   ${ROCCLR_SRC_DIR}/device/blit.cpp
   ${ROCCLR_SRC_DIR}/device/blitcl.cpp
+  ${ROCCLR_SRC_DIR}/device/blittuner.cpp
   ${ROCCLR_SRC_DIR}/device/comgrctx.cpp
   ${ROCCLR_SRC_DIR}/device/devhcmessages.cpp
   ${ROCCLR_SRC_DIR}/device/devhcprintf.cpp
   ${ROCCLR_SRC_DIR}/device/devhostcall.cpp
+  ${ROCCLR_SRC_DIR}/device/devipccache.cpp
+  ${ROCCLR_SRC_DIR}/device/devurirange.cpp
   ${ROCCLR_SRC_DIR}/device/device.cpp
   ${ROCCLR_SRC_DIR}/device/devkernel.cpp
   ${ROCCLR_SRC_DIR}/device/devprogram.cpp
+  ${ROCCLR_SRC_DIR}/device/hostblit.cpp
   ${ROCCLR_SRC_DIR}/device/hsailctx.cpp
   ${ROCCLR_SRC_DIR}/elf/elf.cpp
+  ${ROCCLR_SRC_DIR}/elf/elfview.cpp
   ${ROCCLR_SRC_DIR}/os/alloc.cpp
   ${ROCCLR_SRC_DIR}/os/os_posix.cpp
   ${ROCCLR_SRC_DIR}/os/os_win32.cpp
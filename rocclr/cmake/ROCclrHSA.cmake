@@ -26,7 +26,14 @@ find_package(hsa-runtime64 1.11 REQUIRED CONFIG
     cmake/hsa-runtime64
     lib/cmake/hsa-runtime64
     lib64/cmake/hsa-runtime64)
-target_link_libraries(rocclr PUBLIC hsa-runtime64::hsa-runtime64)
+if(ROCCLR_ENABLE_HSA_MOCK)
+  # Only the headers of the HSA runtime are used, the mock implements the API without a GPU
+  target_include_directories(rocclr PUBLIC
+    $<TARGET_PROPERTY:hsa-runtime64::hsa-runtime64,INTERFACE_INCLUDE_DIRECTORIES>)
+  target_sources(rocclr PRIVATE ${ROCCLR_SRC_DIR}/device/rocm/mock/hsamock.cpp)
+else()
+  target_link_libraries(rocclr PUBLIC hsa-runtime64::hsa-runtime64)
+endif()
 
 find_package(NUMA)
 if(NUMA_FOUND)
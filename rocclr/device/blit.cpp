@@ -21,10 +21,9 @@
 #include "platform/commandqueue.hpp"
 #include "device/device.hpp"
 #include "device/blit.hpp"
+#include "device/hostblit.hpp"
 #include "utils/debug.hpp"
 
-#include <cmath>
-
 namespace amd::device {
 
 HostBlitManager::HostBlitManager(VirtualDevice& vDev, Setup setup)
@@ -41,7 +40,8 @@ bool HostBlitManager::readBuffer(device::Memory& srcMemory, void* dstHost,
   }
 
   // Copy memory
-  std::memcpy(dstHost, reinterpret_cast<const_address>(src) + origin[0], size[0]);
+  HostBlit::CopyRect(dstHost, 0, 0, reinterpret_cast<const_address>(src) + origin[0], 0, 0,
+                     size[0], 1, 1, false);
 
   // Unmap device memory
   srcMemory.cpuUnmap(vDev_);
@@ -60,19 +60,11 @@ bool HostBlitManager::readBufferRect(device::Memory& srcMemory, void* dstHost,
     return false;
   }
 
-  size_t srcOffset;
-  size_t dstOffset;
-
-  for (size_t z = 0; z < size[2]; ++z) {
-    for (size_t y = 0; y < size[1]; ++y) {
-      srcOffset = bufRect.offset(0, y, z);
-      dstOffset = hostRect.offset(0, y, z);
-
-      // Copy memory line by line
-      std::memcpy((reinterpret_cast<address>(dstHost) + dstOffset),
-                  (reinterpret_cast<const_address>(src) + srcOffset), size[0]);
-    }
-  }
+  // Copy memory, the contiguous lines are merged into a single copy
+  HostBlit::CopyRect(reinterpret_cast<address>(dstHost) + hostRect.offset(0, 0, 0),
+                     hostRect.rowPitch_, hostRect.slicePitch_,
+                     reinterpret_cast<const_address>(src) + bufRect.offset(0, 0, 0),
+                     bufRect.rowPitch_, bufRect.slicePitch_, size[0], size[1], size[2], false);
 
   // Unmap source memory
   srcMemory.cpuUnmap(vDev_);
@@ -106,8 +98,6 @@ bool HostBlitManager::readImage(device::Memory& srcMemory, void* dstHost,
   size_t elementSize = srcMemory.owner()->asImage()->getImageFormat().getElementSize();
   size_t srcOffsBase = origin[0] * elementSize;
   size_t copySize = size[0] * elementSize;
-  size_t srcOffs;
-  size_t dstOffs = 0;
 
   // Make sure we use the right pitch if it's not specified
   if (rowPitch == 0) {
@@ -125,21 +115,10 @@ bool HostBlitManager::readImage(device::Memory& srcMemory, void* dstHost,
   // Adjust the destination offset with Z dimension
   srcOffsBase += srcSlicePitch * origin[2];
 
-  // Copy memory line by line
-  for (size_t slice = 0; slice < size[2]; ++slice) {
-    srcOffs = srcOffsBase + slice * srcSlicePitch;
-    dstOffs = slice * slicePitch;
-
-    // Copy memory line by line
-    for (size_t row = 0; row < size[1]; ++row) {
-      // Copy memory
-      std::memcpy((reinterpret_cast<address>(dstHost) + dstOffs),
-                  (reinterpret_cast<const_address>(src) + srcOffs), copySize);
-
-      srcOffs += srcRowPitch;
-      dstOffs += rowPitch;
-    }
-  }
+  // Copy memory, the contiguous lines are merged into a single copy
+  HostBlit::CopyRect(dstHost, rowPitch, slicePitch,
+                     reinterpret_cast<const_address>(src) + srcOffsBase, srcRowPitch,
+                     srcSlicePitch, copySize, size[1], size[2], false);
 
   // Unmap the device memory
   srcMemory.cpuUnmap(vDev_);
@@ -163,7 +142,8 @@ bool HostBlitManager::writeBuffer(const void* srcHost, device::Memory& dstMemory
   }
 
   // Copy memory
-  std::memcpy(reinterpret_cast<address>(dst) + origin[0], srcHost, size[0]);
+  HostBlit::CopyRect(reinterpret_cast<address>(dst) + origin[0], 0, 0, srcHost, 0, 0, size[0], 1,
+                     1, true);
 
   // Unmap the device memory
   dstMemory.cpuUnmap(vDev_);
@@ -182,19 +162,11 @@ bool HostBlitManager::writeBufferRect(const void* srcHost, device::Memory& dstMe
     return false;
   }
 
-  size_t srcOffset;
-  size_t dstOffset;
-
-  for (size_t z = 0; z < size[2]; ++z) {
-    for (size_t y = 0; y < size[1]; ++y) {
-      srcOffset = hostRect.offset(0, y, z);
-      dstOffset = bufRect.offset(0, y, z);
-
-      // Copy memory line by line
-      std::memcpy((reinterpret_cast<address>(dst) + dstOffset),
-                  (reinterpret_cast<const_address>(srcHost) + srcOffset), size[0]);
-    }
-  }
+  // Copy memory, the contiguous lines are merged into a single copy
+  HostBlit::CopyRect(reinterpret_cast<address>(dst) + bufRect.offset(0, 0, 0), bufRect.rowPitch_,
+                     bufRect.slicePitch_,
+                     reinterpret_cast<const_address>(srcHost) + hostRect.offset(0, 0, 0),
+                     hostRect.rowPitch_, hostRect.slicePitch_, size[0], size[1], size[2], true);
 
   // Unmap destination memory
   dstMemory.cpuUnmap(vDev_);
@@ -229,10 +201,8 @@ bool HostBlitManager::writeImage(const void* srcHost, device::Memory& dstMemory,
   }
 
   size_t elementSize = dstMemory.owner()->asImage()->getImageFormat().getElementSize();
-  size_t srcOffs = 0;
   size_t copySize = size[0] * elementSize;
   size_t dstOffsBase = origin[0] * elementSize;
-  size_t dstOffs;
 
   // Make sure we use the right pitch if it's not specified
   if (rowPitch == 0) {
@@ -250,21 +220,9 @@ bool HostBlitManager::writeImage(const void* srcHost, device::Memory& dstMemory,
   // Adjust the destination offset with Z dimension
   dstOffsBase += dstSlicePitch * origin[2];
 
-  // Copy memory slice by slice
-  for (size_t slice = 0; slice < size[2]; ++slice) {
-    dstOffs = dstOffsBase + slice * dstSlicePitch;
-    srcOffs = slice * slicePitch;
-
-    // Copy memory line by line
-    for (size_t row = 0; row < size[1]; ++row) {
-      // Copy memory
-      std::memcpy((reinterpret_cast<address>(dst) + dstOffs),
-                  (reinterpret_cast<const_address>(srcHost) + srcOffs), copySize);
-
-      dstOffs += dstRowPitch;
-      srcOffs += rowPitch;
-    }
-  }
+  // Copy memory, the contiguous lines are merged into a single copy
+  HostBlit::CopyRect(reinterpret_cast<address>(dst) + dstOffsBase, dstRowPitch, dstSlicePitch,
+                     srcHost, rowPitch, slicePitch, copySize, size[1], size[2], true);
 
   // Unmap the device memory
   dstMemory.cpuUnmap(vDev_);
@@ -293,8 +251,9 @@ bool HostBlitManager::copyBuffer(device::Memory& srcMemory, device::Memory& dstM
   }
 
   // Straight forward buffer copy
-  std::memcpy((reinterpret_cast<address>(dst) + dstOrigin[0]),
-              (reinterpret_cast<const_address>(src) + srcOrigin[0]), size[0]);
+  HostBlit::CopyRect(reinterpret_cast<address>(dst) + dstOrigin[0], 0, 0,
+                     reinterpret_cast<const_address>(src) + srcOrigin[0], 0, 0, size[0], 1, 1,
+                     true);
 
   // Unmap source and destination memory
   dstMemory.cpuUnmap(vDev_);
@@ -323,16 +282,11 @@ bool HostBlitManager::copyBufferRect(device::Memory& srcMemory, device::Memory&
     return false;
   }
 
-  for (size_t z = 0; z < size[2]; ++z) {
-    for (size_t y = 0; y < size[1]; ++y) {
-      size_t srcOffset = srcRect.offset(0, y, z);
-      size_t dstOffset = dstRect.offset(0, y, z);
-
-      // Copy memory line by line
-      std::memcpy((reinterpret_cast<address>(dst) + dstOffset),
-                  (reinterpret_cast<const_address>(src) + srcOffset), size[0]);
-    }
-  }
+  // Copy memory, the contiguous lines are merged into a single copy
+  HostBlit::CopyRect(reinterpret_cast<address>(dst) + dstRect.offset(0, 0, 0), dstRect.rowPitch_,
+                     dstRect.slicePitch_,
+                     reinterpret_cast<const_address>(src) + srcRect.offset(0, 0, 0),
+                     srcRect.rowPitch_, srcRect.slicePitch_, size[0], size[1], size[2], true);
 
   // Unmap source and destination memory
   dstMemory.cpuUnmap(vDev_);
@@ -373,7 +327,6 @@ bool HostBlitManager::copyImageToBuffer(device::Memory& srcMemory, device::Memor
 
   size_t srcOffs = srcOrigin[0];
   size_t dstOffs = dstOrigin[0];
-  size_t srcOffsOrg;
   size_t copySize = size[0];
 
   // Calculate the offset in bytes
@@ -384,21 +337,10 @@ bool HostBlitManager::copyImageToBuffer(device::Memory& srcMemory, device::Memor
   srcOffs += srcRowPitch * srcOrigin[1];
   srcOffs += srcSlicePitch * srcOrigin[2];
 
-  srcOffsOrg = srcOffs;
-
-  // Copy memory slice by slice
-  for (size_t slice = 0; slice < size[2]; ++slice) {
-    srcOffs = srcOffsOrg + slice * srcSlicePitch;
-
-    // Copy memory line by line
-    for (size_t rows = 0; rows < size[1]; ++rows) {
-      std::memcpy((reinterpret_cast<address>(dst) + dstOffs),
-                  (reinterpret_cast<const_address>(src) + srcOffs), copySize);
-
-      srcOffs += srcRowPitch;
-      dstOffs += copySize;
-    }
-  }
+  // Copy memory into the packed buffer, the contiguous lines are merged into a single copy
+  HostBlit::CopyRect(reinterpret_cast<address>(dst) + dstOffs, copySize, copySize * size[1],
+                     reinterpret_cast<const_address>(src) + srcOffs, srcRowPitch, srcSlicePitch,
+                     copySize, size[1], size[2], true);
 
   // Unmap source and destination memory
   srcMemory.cpuUnmap(vDev_);
@@ -439,7 +381,6 @@ bool HostBlitManager::copyBufferToImage(device::Memory& srcMemory, device::Memor
   size_t elementSize = dstMemory.owner()->asImage()->getImageFormat().getElementSize();
   size_t srcOffs = srcOrigin[0];
   size_t dstOffs = dstOrigin[0];
-  size_t dstOffsOrg;
   size_t copySize = size[0];
 
   // Calculate the offset in bytes
@@ -450,21 +391,10 @@ bool HostBlitManager::copyBufferToImage(device::Memory& srcMemory, device::Memor
   dstOffs += dstRowPitch * dstOrigin[1];
   dstOffs += dstSlicePitch * dstOrigin[2];
 
-  dstOffsOrg = dstOffs;
-
-  // Copy memory slice by slice
-  for (size_t slice = 0; slice < size[2]; ++slice) {
-    dstOffs = dstOffsOrg + slice * dstSlicePitch;
-
-    // Copy memory line by line
-    for (size_t rows = 0; rows < size[1]; ++rows) {
-      std::memcpy((reinterpret_cast<address>(dst) + dstOffs),
-                  (reinterpret_cast<const_address>(src) + srcOffs), copySize);
-
-      srcOffs += copySize;
-      dstOffs += dstRowPitch;
-    }
-  }
+  // Copy memory from the packed buffer, the contiguous lines are merged into a single copy
+  HostBlit::CopyRect(reinterpret_cast<address>(dst) + dstOffs, dstRowPitch, dstSlicePitch,
+                     reinterpret_cast<const_address>(src) + srcOffs, copySize,
+                     copySize * size[1], copySize, size[1], size[2], true);
 
   // Unmap source and destination memory
   srcMemory.cpuUnmap(vDev_);
@@ -517,8 +447,6 @@ bool HostBlitManager::copyImage(device::Memory& srcMemory, device::Memory& dstMe
 
   size_t srcOffs = srcOrigin[0];
   size_t dstOffs = dstOrigin[0];
-  size_t srcOffsOrg;
-  size_t dstOffsOrg;
   size_t copySize = size[0];
 
   // Calculate the offsets in bytes
@@ -534,23 +462,10 @@ bool HostBlitManager::copyImage(device::Memory& srcMemory, device::Memory& dstMe
   srcOffs += srcSlicePitch * srcOrigin[2];
   dstOffs += dstSlicePitch * dstOrigin[2];
 
-  srcOffsOrg = srcOffs;
-  dstOffsOrg = dstOffs;
-
-  // Copy memory slice by slice
-  for (size_t slice = 0; slice < size[2]; ++slice) {
-    srcOffs = srcOffsOrg + slice * srcSlicePitch;
-    dstOffs = dstOffsOrg + slice * dstSlicePitch;
-
-    // Copy memory line by line
-    for (size_t rows = 0; rows < size[1]; ++rows) {
-      std::memcpy((reinterpret_cast<address>(dst) + dstOffs),
-                  (reinterpret_cast<const_address>(src) + srcOffs), copySize);
-
-      srcOffs += srcRowPitch;
-      dstOffs += dstRowPitch;
-    }
-  }
+  // Copy memory, the contiguous lines are merged into a single copy
+  HostBlit::CopyRect(reinterpret_cast<address>(dst) + dstOffs, dstRowPitch, dstSlicePitch,
+                     reinterpret_cast<const_address>(src) + srcOffs, srcRowPitch, srcSlicePitch,
+                     copySize, size[1], size[2], true);
 
   // Unmap source and destination memory
   srcMemory.cpuUnmap(vDev_);
@@ -577,11 +492,8 @@ bool HostBlitManager::fillBuffer(device::Memory& memory, const void* pattern, si
   }
 
   // Fill the buffer memory with a pattern
-  for (size_t i = 0; i < (fillSize / patternSize); i++) {
-    memcpy((reinterpret_cast<address>(fillMem) + offset),
-           (reinterpret_cast<const_address>(pattern)), patternSize);
-    offset += patternSize;
-  }
+  HostBlit::FillPattern(reinterpret_cast<address>(fillMem) + offset, fillSize, pattern,
+                        patternSize, true);
 
   // Unmap source and destination memory
   memory.cpuUnmap(vDev_);
@@ -630,7 +542,6 @@ bool HostBlitManager::fillImage(device::Memory& memory, const void* pattern,
 
   size_t elementSize = memory.owner()->asImage()->getImageFormat().getElementSize();
   size_t offset = origin[0] * elementSize;
-  size_t offsetOrg;
 
   // Adjust offset with Y dimension
   offset += devRowPitch * origin[1];
@@ -638,25 +549,9 @@ bool HostBlitManager::fillImage(device::Memory& memory, const void* pattern,
   // Adjust offset with Z dimension
   offset += devSlicePitch * origin[2];
 
-  offsetOrg = offset;
-
-  // Fill the image memory with a pattern
-  for (size_t slice = 0; slice < size[2]; ++slice) {
-    offset = offsetOrg + slice * devSlicePitch;
-
-    for (size_t rows = 0; rows < size[1]; ++rows) {
-      size_t pixOffset = offset;
-
-      // Copy memory pixel by pixel
-      for (size_t column = 0; column < size[0]; ++column) {
-        memcpy((reinterpret_cast<address>(fillMem) + pixOffset),
-               (reinterpret_cast<const_address>(fillValue)), elementSize);
-        pixOffset += elementSize;
-      }
-
-      offset += devRowPitch;
-    }
-  }
+  // Fill the image memory with the pixel, broadcasted over the whole rows
+  HostBlit::FillRect(reinterpret_cast<address>(fillMem) + offset, devRowPitch, devSlicePitch,
+                     fillValue, elementSize, size[0], size[1], size[2], true);
 
   // Unmap memory
   memory.cpuUnmap(vDev_);
@@ -664,26 +559,7 @@ bool HostBlitManager::fillImage(device::Memory& memory, const void* pattern,
   return true;
 }
 
-uint32_t HostBlitManager::sRGBmap(float fc) const {
-  double c = (double)fc;
-
-#ifdef ATI_OS_LINUX
-  if (std::isnan(c)) c = 0.0;
-#else
-  if (_isnan(c)) c = 0.0;
-#endif
-
-  if (c > 1.0)
-    c = 1.0;
-  else if (c < 0.0)
-    c = 0.0;
-  else if (c < 0.0031308)
-    c = 12.92 * c;
-  else
-    c = (1055.0 / 1000.0) * pow(c, 5.0 / 12.0) - (55.0 / 1000.0);
-
-  return (uint32_t)(c * 255.0 + 0.5);
-}
+uint32_t HostBlitManager::sRGBmap(float fc) const { return HostBlit::sRGBmap(fc); }
 
 // ================================================================================================
 void HostBlitManager::FillBufferInfo::ExpandPattern(uint32_t pattern_size, const void* pattern) {
@@ -0,0 +1,241 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#include "top.hpp"
+#include "os/os.hpp"
+#include "utils/debug.hpp"
+#include "utils/flags.hpp"
+#include "device/blittuner.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace amd::device {
+
+static constexpr const char* kCacheHeader = "rocclr-blit-tune 1";
+
+// ================================================================================================
+BlitTuner::BlitTuner(const std::string& key) : key_(key) {
+  for (auto& kind : table_) {
+    for (auto& bucket : kind) {
+      bucket.fill(Decision{Kernel, 0});
+    }
+  }
+}
+
+// ================================================================================================
+void BlitTuner::Calibrate(Timer& timer, uint32_t max_workgroups, bool sdma) {
+  max_workgroups = std::max(max_workgroups, 4u);
+  // Workgroup candidates around the default, which is the number of CUs
+  std::vector<uint32_t> workgroups;
+  for (uint32_t wg = max_workgroups / 4; wg <= max_workgroups * 4; wg *= 2) {
+    workgroups.push_back(wg);
+  }
+
+  auto measure = [&timer](Kind kind, Engine engine, size_t size, bool aligned, uint32_t wg) {
+    uint64_t best = 0;
+    for (uint32_t i = 0; i < kRepeats; ++i) {
+      uint64_t ns = timer.Measure(kind, engine, size, aligned, wg);
+      if (ns == 0) {
+        return uint64_t{0};
+      }
+      best = (best == 0) ? ns : std::min(best, ns);
+    }
+    return best;
+  };
+
+  for (uint32_t kind = 0; kind < KindTotal; ++kind) {
+    for (uint32_t bucket = 0; bucket < kSizeBuckets; ++bucket) {
+      size_t size = size_t{1} << (bucket + kMinSizeLog2);
+      for (uint32_t aligned = 0; aligned < 2; ++aligned) {
+        Decision best{Kernel, 0};
+        uint64_t best_ns = 0;
+        for (uint32_t wg : workgroups) {
+          uint64_t ns = measure(static_cast<Kind>(kind), Kernel, size, aligned != 0, wg);
+          if ((ns != 0) && ((best_ns == 0) || (ns < best_ns))) {
+            best = Decision{Kernel, wg};
+            best_ns = ns;
+          }
+        }
+        // The fill has no DMA path. The SDMA decision keeps the kernel workgroups for a fallback
+        if (sdma && (kind != Fill)) {
+          uint64_t ns = measure(static_cast<Kind>(kind), Sdma, size, aligned != 0, 0);
+          if ((ns != 0) && ((best_ns == 0) || (ns < best_ns))) {
+            best.engine_ = Sdma;
+            best.workgroups_ = (best.workgroups_ != 0) ? best.workgroups_ : max_workgroups;
+            best_ns = ns;
+          }
+        }
+        table_[kind][bucket][aligned] = best;
+        ClPrint(LOG_INFO, LOG_COPY, "Blit tune %s: kind %u, size %zu, aligned %u -> %s, wg %u, "
+                "%llu ns", key_.c_str(), kind, size, aligned,
+                (best.engine_ == Sdma) ? "SDMA" : "kernel", best.workgroups_,
+                static_cast<unsigned long long>(best_ns));
+      }
+    }
+  }
+}
+
+// ================================================================================================
+bool BlitTuner::Calibrated() const {
+  for (const auto& kind : table_) {
+    for (const auto& bucket : kind) {
+      for (const auto& decision : bucket) {
+        if (decision.workgroups_ != 0) {
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+// ================================================================================================
+std::string BlitTuner::CacheFile() {
+  if (DEBUG_CLR_BLIT_TUNE_FILE[0] != '\0') {
+    return DEBUG_CLR_BLIT_TUNE_FILE;
+  }
+#if defined(_WIN32)
+  std::string home = Os::getEnvironment("LOCALAPPDATA");
+#else
+  std::string home = Os::getEnvironment("HOME");
+#endif
+  if (home.empty()) {
+    home = Os::getTempPath();
+  }
+  return home + Os::fileSeparator() + ".cache" + Os::fileSeparator() + "rocclr_blit_tune";
+}
+
+// ================================================================================================
+bool BlitTuner::Load(const std::string& file_name, uint32_t max_workgroups) {
+  // The calibration sweeps up to 4x of the default, a larger count is a corrupted entry
+  const uint32_t workgroups_limit = std::max(max_workgroups, 4u) * 4;
+  std::ifstream file(file_name);
+  std::string line;
+  if (!file.is_open() || !std::getline(file, line) || (line != kCacheHeader)) {
+    return false;
+  }
+
+  bool found = false;
+  bool section = false;
+  while (std::getline(file, line)) {
+    std::istringstream fields(line);
+    std::string tag;
+    fields >> tag;
+    if (tag.empty()) {
+      continue;
+    } else if (tag == "device") {
+      std::string key;
+      fields >> key;
+      section = (key == key_);
+      found = found || section;
+    } else if (tag == "end") {
+      section = false;
+    } else if (section) {
+      // <kind> <size log2> <aligned> <engine> <workgroups>
+      char* end = nullptr;
+      uint32_t kind = strtoul(tag.c_str(), &end, 10);
+      uint32_t size_log2 = 0, aligned = 0, engine = 0, workgroups = 0;
+      fields >> size_log2 >> aligned >> engine >> workgroups;
+      if (fields.fail() || (*end != '\0') || (kind >= KindTotal) || (size_log2 < kMinSizeLog2) ||
+          (size_log2 > kMaxSizeLog2) || (aligned > 1) || (engine > Sdma) || (workgroups == 0) ||
+          (workgroups > workgroups_limit)) {
+        LogPrintfError("Invalid blit tune entry in %s: %s", file_name.c_str(), line.c_str());
+        return false;
+      }
+      table_[kind][size_log2 - kMinSizeLog2][aligned] =
+          Decision{static_cast<Engine>(engine), workgroups};
+    }
+  }
+  return found && Calibrated();
+}
+
+// ================================================================================================
+bool BlitTuner::Save(const std::string& file_name) const {
+  // Keep the sections of the other devices
+  std::ostringstream others;
+  {
+    std::ifstream file(file_name);
+    std::string line;
+    if (file.is_open() && std::getline(file, line) && (line == kCacheHeader)) {
+      bool keep = false;
+      while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::string tag, key;
+        fields >> tag >> key;
+        if (tag == "device") {
+          keep = (key != key_);
+        }
+        if (keep) {
+          others << line << '\n';
+        }
+        if (tag == "end") {
+          keep = false;
+        }
+      }
+    }
+  }
+
+  auto separator = file_name.find_last_of(Os::fileSeparator());
+  if (separator != std::string::npos) {
+    Os::createPath(file_name.substr(0, separator));
+  }
+
+  // Write a temporary file and replace the cache, so a concurrent reader never sees a partial one
+  std::string tmp_name = file_name + "." + std::to_string(Os::getProcessId());
+  {
+    std::ofstream file(tmp_name, std::ios::trunc);
+    if (!file.is_open()) {
+      return false;
+    }
+    file << kCacheHeader << '\n' << others.str();
+    file << "device " << key_ << '\n';
+    for (uint32_t kind = 0; kind < KindTotal; ++kind) {
+      for (uint32_t bucket = 0; bucket < kSizeBuckets; ++bucket) {
+        for (uint32_t aligned = 0; aligned < 2; ++aligned) {
+          const Decision& decision = table_[kind][bucket][aligned];
+          if (decision.workgroups_ != 0) {
+            file << kind << ' ' << (bucket + kMinSizeLog2) << ' ' << aligned << ' '
+                 << decision.engine_ << ' ' << decision.workgroups_ << '\n';
+          }
+        }
+      }
+    }
+    file << "end\n";
+    file.close();
+    if (file.fail()) {
+      std::remove(tmp_name.c_str());
+      return false;
+    }
+  }
+#if defined(_WIN32)
+  std::remove(file_name.c_str());
+#endif
+  if (std::rename(tmp_name.c_str(), file_name.c_str()) != 0) {
+    std::remove(tmp_name.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace amd::device
@@ -0,0 +1,129 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "top.hpp"
+#include "utils/util.hpp"
+
+namespace amd::device {
+
+//! Decision table of the buffer blits, calibrated per device. For every transfer kind, size
+//! bucket and alignment the table keeps the faster engine and the number of workgroups of
+//! the blit kernel. The table is stored in a cache file, so the calibration runs only once
+//! per device. The sizes outside of the calibrated range use the fixed heuristics.
+class BlitTuner {
+ public:
+  //! Transfer kind
+  enum Kind : uint32_t {
+    DeviceToDevice = 0,
+    HostToDevice,
+    DeviceToHost,
+    Fill,
+    KindTotal
+  };
+
+  //! Transfer engine
+  enum Engine : uint32_t {
+    Kernel = 0,  //!< Blit kernel
+    Sdma         //!< DMA engine
+  };
+
+  //! Blit decision
+  struct Decision {
+    Engine engine_;        //!< The faster engine
+    uint32_t workgroups_;  //!< Number of workgroups of the blit kernel, 0 if not calibrated
+  };
+
+  //! Timing source of the calibration
+  class Timer {
+   public:
+    virtual ~Timer() {}
+    //! Returns the time in ns of one transfer or 0 if the engine can't perform it
+    virtual uint64_t Measure(Kind kind, Engine engine, size_t size, bool aligned,
+                             uint32_t workgroups) = 0;
+  };
+
+  static constexpr uint32_t kMinSizeLog2 = 12;  //!< The first calibrated size, 4 KiB
+  static constexpr uint32_t kMaxSizeLog2 = 26;  //!< The last calibrated size, 64 MiB
+  static constexpr uint32_t kSizeBuckets = kMaxSizeLog2 - kMinSizeLog2 + 1;
+  static constexpr uint32_t kRepeats = 3;       //!< Measurements per candidate, the min wins
+  static constexpr uint32_t kAlignment = 2 * sizeof(uint64_t);  //!< Alignment of the fast path
+  static constexpr uint32_t kUnalignedOffset = 4;  //!< Offset of the unaligned transfers
+
+  //! Returns true if the transfer offset selects the aligned decisions. The calibration and
+  //! the lookups must agree on it
+  static constexpr bool IsAligned(size_t offset) { return (offset % kAlignment) == 0; }
+
+  //! The key identifies the device in the cache file and can't contain spaces
+  explicit BlitTuner(const std::string& key);
+
+  //! Returns the decision for the transfer or nullptr, if the heuristics must be used
+  const Decision* Find(Kind kind, size_t size, bool aligned) const {
+    uint32_t bucket = Bucket(size);
+    if (bucket >= kSizeBuckets) {
+      return nullptr;
+    }
+    const Decision& decision = table_[kind][bucket][aligned ? 1 : 0];
+    return (decision.workgroups_ != 0) ? &decision : nullptr;
+  }
+
+  //! Sweeps the sizes, alignments, engines and workgroup counts with the timer.
+  //! max_workgroups is the default number of workgroups, the sweep covers 1/4x - 4x of it
+  void Calibrate(Timer& timer, uint32_t max_workgroups, bool sdma);
+
+  //! Loads the table of this device from the cache file. Returns false if it isn't there or
+  //! has an entry out of the range, which Calibrate() with the same max_workgroups can pick
+  bool Load(const std::string& file_name, uint32_t max_workgroups);
+
+  //! Stores the table of this device in the cache file, keeping the other devices
+  bool Save(const std::string& file_name) const;
+
+  //! Returns true if the table has any decision
+  bool Calibrated() const;
+
+  //! Returns the cache file from DEBUG_CLR_BLIT_TUNE_FILE or the default in the home folder
+  static std::string CacheFile();
+
+  const std::string& key() const { return key_; }
+
+ private:
+  //! Returns the size bucket or kSizeBuckets if the size isn't calibrated
+  static uint32_t Bucket(size_t size) {
+    if ((size >> kMinSizeLog2) == 0 || (size >> (kMaxSizeLog2 + 1)) != 0) {
+      return kSizeBuckets;
+    }
+    return amd::log2(static_cast<uint64_t>(size)) - kMinSizeLog2;
+  }
+
+  std::string key_;  //!< Device key in the cache file
+  //! Decisions per kind, size bucket and alignment
+  std::array<std::array<std::array<Decision, 2>, kSizeBuckets>, KindTotal> table_;
+};
+
+static_assert(!BlitTuner::IsAligned(BlitTuner::kUnalignedOffset),
+              "The unaligned calibration must measure the unaligned decisions");
+
+}  // namespace amd::device
@@ -1028,20 +1028,44 @@ bool Device::IpcCreate(void* dev_ptr, size_t* mem_size, void* handle, size_t* me
 
 // ================================================================================================
 bool Device::IpcAttach(const void* handle, size_t mem_size, size_t mem_offset, unsigned int flags,
-                       void** dev_ptr) const {
+                       void** dev_ptr, bool cached) const {
+  if (!cached) {
+    *dev_ptr = ipc_importer_.Import(handle, mem_size, mem_offset, flags);
+    return (*dev_ptr != nullptr);
+  }
+  // Repeated opens of the same handle reuse the existing mapping from the cache
+  *dev_ptr = device::IpcMemCache::Instance().Open(ipc_importer_, index(), handle, mem_size,
+                                                  mem_offset, flags);
+  return (*dev_ptr != nullptr);
+}
+
+// ================================================================================================
+bool Device::IpcDetach(void* dev_ptr) const {
+  // The cache defers the unmap until the mapping is evicted
+  if (device::IpcMemCache::Instance().Close(dev_ptr)) {
+    return true;
+  }
+  DevLogPrintfError("Memory object for the ptr: 0x%x wasn't opened with IPC \n", dev_ptr);
+  return false;
+}
+
+// ================================================================================================
+void* Device::IpcImporter::Import(const void* handle, size_t size, size_t offset,
+                                  unsigned int flags) {
+  amd::Context& context = device_.context();
   amd::Memory* amd_mem_obj = nullptr;
 
   // Create an amd Memory object for the handle
-  amd_mem_obj = new (context()) amd::IpcBuffer(context(), flags, mem_offset, mem_size, handle);
+  amd_mem_obj = new (context) amd::IpcBuffer(context, flags, offset, size, handle);
   if (amd_mem_obj == nullptr) {
     LogError("failed to create a mem object!");
-    return false;
+    return nullptr;
   }
 
   if (!amd_mem_obj->create(nullptr)) {
     LogError("failed to create a svm hidden buffer!");
     amd_mem_obj->release();
-    return false;
+    return nullptr;
   }
 
   auto mem_obj_exist = amd::MemObjMap::FindMemObj(amd_mem_obj->getSvmPtr());
@@ -1055,22 +1079,15 @@ bool Device::IpcAttach(const void* handle, size_t mem_size, size_t mem_offset, u
     amd_mem_obj->retain();
   }
 
-  *dev_ptr = amd_mem_obj->getSvmPtr();
-
-  return true;
+  return amd_mem_obj->getSvmPtr();
 }
 
 // ================================================================================================
-bool Device::IpcDetach(void* dev_ptr) const {
+void Device::IpcImporter::Release(void* dev_ptr) {
   amd::Memory* amd_mem_obj = amd::MemObjMap::FindMemObj(dev_ptr);
-  if (amd_mem_obj == nullptr) {
-    DevLogPrintfError("Memory object for the ptr: 0x%x cannot be null \n", dev_ptr);
-    return false;
-  }
-
-  if (!amd_mem_obj->ipcShared()) {
+  if ((amd_mem_obj == nullptr) || !amd_mem_obj->ipcShared()) {
     DevLogPrintfError("Memory object for the ptr: 0x%x is not ipcShared \n", dev_ptr);
-    return false;
+    return;
   }
 
   // Get the original pointer from the amd::Memory object
@@ -1086,8 +1103,12 @@ bool Device::IpcDetach(void* dev_ptr) const {
   if (amd_mem_obj->release() == 0) {
     amd::MemObjMap::RemoveMemObj(orig_dev_ptr);
   }
+}
 
-  return true;
+// ================================================================================================
+bool Device::IpcImporter::IsMapped(void* dev_ptr) const {
+  amd::Memory* amd_mem_obj = amd::MemObjMap::FindMemObj(dev_ptr);
+  return (amd_mem_obj != nullptr) && amd_mem_obj->ipcShared();
 }
 
 }  // namespace amd
@@ -38,6 +38,7 @@
 #include "hsailctx.hpp"
 #endif
 #include "devsignal.hpp"
+#include "devipccache.hpp"
 
 #if defined(__clang__)
 #if __has_feature(address_sanitizer)
@@ -1314,6 +1315,12 @@ class VirtualDevice : public amd::HeapObject {
 
   virtual address allocKernelArguments(size_t size, size_t alignment) { return nullptr; }
 
+  //! Starts a batch of submissions, which can share a single doorbell update
+  virtual void beginSubmitBatch() {}
+
+  //! Ends the batch of submissions and notifies the device about all of them
+  virtual void endSubmitBatch() {}
+
   //! Get the blit manager object
   device::BlitManager& blitMgr() const { return *blitMgr_; }
 
@@ -1335,6 +1342,30 @@ class VirtualDevice : public amd::HeapObject {
                                  const std::string& kernelName,
                                  amd::AccumulateCommand* vcmd = nullptr) = 0;
 
+  //! Advances the queue timeline with a marker after all submitted work.
+  //! Returns the timeline value of the marker or 0 if the queue doesn't have a timeline
+  virtual uint64_t AdvanceTimeline() { return 0; }
+
+  //! Returns true if the queue retired the provided timeline value
+  virtual bool IsTimelineComplete(uint64_t value) { return true; }
+
+  //! Waits on the host until the queue retires the provided timeline value
+  virtual void WaitTimeline(uint64_t value) {}
+
+  //! Returns true if the queue should check the load of its HW queue
+  virtual bool IsRebalanceDue() const { return false; }
+
+  //! Moves the queue to a lighter HW queue. Must be called with the execution lock held,
+  //! after all submitted work is done
+  virtual void RebalanceQueue() {}
+
+  //! Releases the HW queue of an idle queue, which is kept for a later reuse. Must be called
+  //! with the execution lock held, after all submitted work is done
+  virtual void ParkQueue() {}
+
+  //! Acquires a HW queue for a parked queue, returns false on failure
+  virtual bool UnparkQueue() { return true; }
+
   //! Returns the number of outstanding HSA async handlers
   std::atomic<uint64_t>& QueuedAsyncHandlers() const { return queued_async_handlers_; }
 
@@ -2053,11 +2084,22 @@ class Device : public RuntimeObject {
 
   bool IpcCreate(void* dev_ptr, size_t* mem_size, void* handle, size_t* mem_offset) const;
 
+  //! Opens an IPC handle. The cached mapping must be closed with IpcDetach(), an uncached one
+  //! is owned by the caller and released with its memory object
   bool IpcAttach(const void* handle, size_t mem_size, size_t mem_offset, unsigned int flags,
-                 void** dev_ptr) const;
+                 void** dev_ptr, bool cached = true) const;
 
   bool IpcDetach(void* dev_ptr) const;
 
+  //! Returns IPC memory cache statistics
+  device::IpcMemCache::Stats IpcCacheStats() const {
+    return device::IpcMemCache::Instance().GetStats();
+  }
+
+  //! Removes the cached IPC mappings of the device. Must be called before the device memory
+  //! is purged on reset or the device is destroyed
+  void IpcCachePurge() const { device::IpcMemCache::Instance().Purge(ipc_importer_); }
+
   //! Return context
   amd::Context& context() const { return *context_; }
 
@@ -2170,6 +2212,19 @@ class Device : public RuntimeObject {
   amd::Monitor activeQueuesLock_ {}; //!< Guards access to the activeQueues set
   std::unordered_set<amd::CommandQueue*> activeQueues; //!< The set of active queues
  private:
+  //! Imports IPC handles on the device for the process wide IPC memory cache
+  class IpcImporter : public device::IpcMemCache::Backend {
+   public:
+    explicit IpcImporter(const Device& device) : device_(device) {}
+    void* Import(const void* handle, size_t size, size_t offset, unsigned int flags) override;
+    void Release(void* ptr) override;
+    bool IsMapped(void* ptr) const override;
+
+   private:
+    const Device& device_;
+  };
+  mutable IpcImporter ipc_importer_{*this};  //!< IPC importer of the device
+
   const Isa *isa_;                //!< Device isa
   bool IsTypeMatching(cl_device_type type, bool offlineDevices);
 
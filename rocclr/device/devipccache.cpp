@@ -0,0 +1,172 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#include "top.hpp"
+#include "utils/debug.hpp"
+#include "utils/flags.hpp"
+#include "device/devipccache.hpp"
+
+namespace amd::device {
+
+// ================================================================================================
+IpcMemCache& IpcMemCache::Instance() {
+  // The cache is never destroyed, since the device runtime can be gone at the static destruction
+  static IpcMemCache* cache = new IpcMemCache(DEBUG_CLR_IPC_MEM_CACHE_SIZE);
+  return *cache;
+}
+
+// ================================================================================================
+void* IpcMemCache::Open(Backend& backend, uint32_t device_id, const void* handle, size_t size,
+                        size_t offset, unsigned int flags) {
+  Key key;
+  key.device_id_ = device_id;
+  key.offset_ = offset;
+  memcpy(key.handle_.data(), handle, kHandleSize);
+
+  ScopedLock lock(lock_);
+  auto it = keys_.find(key);
+  if ((it != keys_.end()) && !entries_[it->second].backend_->IsMapped(it->second)) {
+    // The memory was freed behind the cache, so the handle must be imported again
+    ClPrint(LOG_INFO, LOG_MEM, "IPC cache stale entry: %p", it->second);
+    stats_.stale_++;
+    Drop(it->second);
+    it = keys_.end();
+  }
+  if (it != keys_.end()) {
+    Entry& entry = entries_[it->second];
+    if (entry.idle_) {
+      idle_.erase(entry.lru_);
+      entry.idle_ = false;
+    }
+    entry.ref_count_++;
+    stats_.hits_++;
+    ClPrint(LOG_INFO, LOG_MEM, "IPC cache hit: %p, refs: %u, hits: %llu", it->second,
+            entry.ref_count_, static_cast<unsigned long long>(stats_.hits_));
+    return it->second;
+  }
+
+  stats_.misses_++;
+  void* ptr = backend.Import(handle, size, offset, flags);
+  if (ptr == nullptr) {
+    return nullptr;
+  }
+  // The same allocation can be exported with a different handle, then the mapping is shared
+  auto entry_it = entries_.find(ptr);
+  if (entry_it == entries_.end()) {
+    entry_it = entries_.emplace(ptr, Entry{}).first;
+    entry_it->second.backend_ = &backend;
+  } else {
+    backend.Release(ptr);
+    if (entry_it->second.idle_) {
+      idle_.erase(entry_it->second.lru_);
+      entry_it->second.idle_ = false;
+    }
+  }
+  entry_it->second.ref_count_++;
+  entry_it->second.keys_.push_back(key);
+  keys_[key] = ptr;
+  ClPrint(LOG_INFO, LOG_MEM, "IPC cache miss: %p, size: %zu, misses: %llu", ptr, size,
+          static_cast<unsigned long long>(stats_.misses_));
+  return ptr;
+}
+
+// ================================================================================================
+bool IpcMemCache::Close(void* ptr) {
+  ScopedLock lock(lock_);
+  auto it = entries_.find(ptr);
+  if ((it == entries_.end()) || (it->second.ref_count_ == 0)) {
+    return false;
+  }
+  if (--it->second.ref_count_ == 0) {
+    if (max_idle_ == 0) {
+      Evict(ptr);
+    } else {
+      idle_.push_front(ptr);
+      it->second.lru_ = idle_.begin();
+      it->second.idle_ = true;
+      // Unmap the least recently used entries above the bound
+      while (idle_.size() > max_idle_) {
+        Evict(idle_.back());
+        stats_.evictions_++;
+      }
+    }
+  }
+  return true;
+}
+
+// ================================================================================================
+void IpcMemCache::Flush() {
+  ScopedLock lock(lock_);
+  while (!idle_.empty()) {
+    Evict(idle_.back());
+  }
+}
+
+// ================================================================================================
+void IpcMemCache::Purge(const Backend& backend) {
+  ScopedLock lock(lock_);
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    void* ptr = it->first;
+    bool idle = it->second.idle_;
+    if (it->second.backend_ != &backend) {
+      ++it;
+      continue;
+    }
+    ++it;
+    if (idle) {
+      Evict(ptr);
+    } else {
+      Drop(ptr);
+    }
+  }
+}
+
+// ================================================================================================
+IpcMemCache::Stats IpcMemCache::GetStats() const {
+  ScopedLock lock(lock_);
+  Stats stats = stats_;
+  stats.idle_ = idle_.size();
+  stats.active_ = entries_.size() - idle_.size();
+  return stats;
+}
+
+// ================================================================================================
+void IpcMemCache::Evict(void* ptr) {
+  auto it = entries_.find(ptr);
+  assert(it != entries_.end() && "Evicted pointer must be in the cache");
+  Backend* backend = it->second.backend_;
+  Drop(ptr);
+  backend->Release(ptr);
+}
+
+// ================================================================================================
+void IpcMemCache::Drop(void* ptr) {
+  auto it = entries_.find(ptr);
+  assert(it != entries_.end() && "Dropped pointer must be in the cache");
+  if (it->second.idle_) {
+    idle_.erase(it->second.lru_);
+  }
+  for (const auto& key : it->second.keys_) {
+    keys_.erase(key);
+  }
+  entries_.erase(it);
+}
+
+}  // namespace amd::device
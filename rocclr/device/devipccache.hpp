@@ -0,0 +1,130 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "top.hpp"
+#include "thread/monitor.hpp"
+
+namespace amd::device {
+
+//! Process wide, reference counted cache of the imported IPC memory handles.
+//! Repeated opens of the same handle return the existing mapping. The last close keeps
+//! the mapping in a LRU list of idle entries, bounded by the cache size, and the real
+//! unmap is deferred until the entry is evicted.
+class IpcMemCache {
+ public:
+  static constexpr size_t kHandleSize = 32;  //!< Size of the IPC handle in bytes
+
+  //! Importer of the IPC handles. The device implements it for the real mappings,
+  //! a test can provide a fake exporter.
+  class Backend {
+   public:
+    virtual ~Backend() {}
+    //! Imports and maps the handle, returns the mapped pointer or nullptr on failure
+    virtual void* Import(const void* handle, size_t size, size_t offset, unsigned int flags) = 0;
+    //! Unmaps the pointer returned from Import()
+    virtual void Release(void* ptr) = 0;
+    //! Returns false if the mapping was freed outside of the cache, i.e. by a device reset
+    virtual bool IsMapped(void* ptr) const { return true; }
+  };
+
+  //! Cache statistics
+  struct Stats {
+    uint64_t hits_ = 0;       //!< Opens served from the cache
+    uint64_t misses_ = 0;     //!< Opens, which required a new import
+    uint64_t evictions_ = 0;  //!< Idle entries unmapped due to the cache bound
+    uint64_t stale_ = 0;      //!< Cached mappings, which were freed outside of the cache
+    size_t active_ = 0;       //!< Mappings with open references
+    size_t idle_ = 0;         //!< Closed mappings kept for reuse
+  };
+
+  explicit IpcMemCache(size_t max_idle) : max_idle_(max_idle) {}
+
+  ~IpcMemCache() { Flush(); }
+
+  //! Returns the process wide cache instance
+  static IpcMemCache& Instance();
+
+  //! Opens the handle on the device. Returns the mapped pointer or nullptr on failure
+  void* Open(Backend& backend, uint32_t device_id, const void* handle, size_t size,
+             size_t offset, unsigned int flags);
+
+  //! Closes the mapping. Returns false if the pointer doesn't belong to the cache
+  bool Close(void* ptr);
+
+  //! Unmaps all idle entries
+  void Flush();
+
+  //! Removes all mappings of the backend before its device is reset or destroyed. The idle
+  //! mappings are unmapped, the open ones are dropped and left to the device cleanup
+  void Purge(const Backend& backend);
+
+  //! Returns the current statistics
+  Stats GetStats() const;
+
+ private:
+  //! Cache key: importing device, handle bytes and offset
+  struct Key {
+    uint32_t device_id_;
+    size_t offset_;
+    std::array<char, kHandleSize> handle_;
+    bool operator<(const Key& rhs) const {
+      if (device_id_ != rhs.device_id_) {
+        return device_id_ < rhs.device_id_;
+      }
+      if (offset_ != rhs.offset_) {
+        return offset_ < rhs.offset_;
+      }
+      return memcmp(handle_.data(), rhs.handle_.data(), kHandleSize) < 0;
+    }
+  };
+
+  //! Single mapping. A few keys may resolve into the same mapped pointer
+  struct Entry {
+    Backend* backend_;                      //!< Importer, which owns the mapping
+    uint32_t ref_count_ = 0;                //!< Number of open references
+    std::vector<Key> keys_;                 //!< Keys, which resolve into this mapping
+    bool idle_ = false;                     //!< The mapping is in the idle list
+    std::list<void*>::iterator lru_;        //!< Position in the idle list
+  };
+
+  //! Unmaps the entry and removes it from the cache
+  void Evict(void* ptr);
+
+  //! Removes the entry from the cache without the unmap
+  void Drop(void* ptr);
+
+  const size_t max_idle_;                     //!< Maximum number of idle entries
+  mutable Monitor lock_{};                    //!< Guards the cache state
+  std::map<Key, void*> keys_;                 //!< Handle to mapped pointer index
+  std::unordered_map<void*, Entry> entries_;  //!< All mappings
+  std::list<void*> idle_;                     //!< Idle mappings, the most recent first
+  Stats stats_;                               //!< Hit/miss statistics
+};
+
+}  // namespace amd::device
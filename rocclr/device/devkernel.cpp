@@ -679,6 +679,26 @@ bool Kernel::createSignature(
 // ================================================================================================
 Kernel::~Kernel() { delete signature_; }
 
+// The materialization is rare, so a single lock serializes it for all kernels
+amd::Monitor Kernel::materializeLock_(true);
+
+// ================================================================================================
+bool Kernel::materialize() const {
+  if (!isLazy()) {
+    return true;
+  }
+  amd::ScopedLock sl(materializeLock_);
+  if (lazy_.load(std::memory_order_relaxed)) {
+    if (!const_cast<Kernel*>(this)->materializeMetadata()) {
+      LogPrintfError("Failed to build the metadata of kernel %s", name().c_str());
+      return false;
+    }
+    ClPrint(amd::LOG_INFO, amd::LOG_KERN, "Kernel %s metadata is materialized", name().c_str());
+    lazy_.store(false, std::memory_order_release);
+  }
+  return true;
+}
+
 // ================================================================================================
 #if defined(WITH_COMPILER_LIB)
 std::string Kernel::openclMangledName(const std::string& name) {
@@ -1153,6 +1173,29 @@ bool Kernel::GetAttrCodePropMetadata() {
   return true;
 }
 
+// ================================================================================================
+bool Kernel::GetKindMetadata() {
+  // Code object V2 has no init/fini kernels
+  if (codeObjectVer() == 2) {
+    return true;
+  }
+  amd_comgr_metadata_node_t kernelMetaNode;
+  if (!prog().getKernelMetadata(name(), &kernelMetaNode)) {
+    DevLogPrintfError("Cannot get program kernel metadata for %s \n", name().c_str());
+    return false;
+  }
+  amd_comgr_metadata_node_t kindMeta;
+  if (amd::Comgr::metadata_lookup(kernelMetaNode, ".kind", &kindMeta) ==
+      AMD_COMGR_STATUS_SUCCESS) {
+    std::string kind;
+    if (getMetaBuf(kindMeta, &kind) == AMD_COMGR_STATUS_SUCCESS) {
+      SetKernelKind(kind);
+    }
+    amd::Comgr::destroy_metadata(kindMeta);
+  }
+  return true;
+}
+
 bool Kernel::SetAvailableSgprVgpr() {
   std::string buf;
 
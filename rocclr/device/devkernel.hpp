@@ -249,6 +249,15 @@ class Kernel : public amd::HeapObject {
   //! Returns the kernel signature
   const amd::KernelSignature& signature() const { return *signature_; }
 
+  //! Returns TRUE if the kernel is a stub, which didn't build its metadata yet
+  bool isLazy() const { return lazy_.load(std::memory_order_acquire); }
+
+  //! Builds the metadata of a stub kernel on the first use. Safe to call from any thread
+  bool materialize() const;
+
+  //! Returns the lock, which serializes the materialization of all kernels
+  static amd::Monitor& materializeLock() { return materializeLock_; }
+
   //! Returns the kernel name
   const std::string& name() const { return name_; }
 
@@ -366,6 +375,9 @@ class Kernel : public amd::HeapObject {
   //! Retrieve kernel attribute and code properties metadata
   bool GetAttrCodePropMetadata();
 
+  //! Retrieve only the kernel kind metadata, which a stub kernel needs for init/fini
+  bool GetKindMetadata();
+
   //! Retrieve the available SGPRs and VGPRs
   bool SetAvailableSgprVgpr();
 
@@ -391,6 +403,12 @@ class Kernel : public amd::HeapObject {
   //! Returns program associated with this kernel
   const Program& prog() const { return prog_; }
 
+  //! Marks the kernel as a stub, which builds the metadata in materialize()
+  void setLazy() { lazy_.store(true, std::memory_order_relaxed); }
+
+  //! Builds the metadata of the stub kernel, called once under the materialization lock
+  virtual bool materializeMetadata() { return true; }
+
   const amd::Device& dev_;          //!< GPU device object
   std::string name_;                //!< kernel name
   const Program& prog_;             //!< Reference to the parent program
@@ -407,6 +425,7 @@ class Kernel : public amd::HeapObject {
   uint32_t kernargSegmentByteSize_ = 0;   //!< Size of kernel argument buffer
   uint32_t kernargSegmentAlignment_ = 0;
   bool kernelHasDynamicCallStack_ = 0;
+  mutable std::atomic<bool> lazy_ = false;  //!< The metadata is built on the first use
 
   union Flags {
     struct {
@@ -437,6 +456,8 @@ class Kernel : public amd::HeapObject {
   };
 
   KernelKind kind_{Normal};  //!< Kernel kind, is normal unless specified otherwise
+
+  static amd::Monitor materializeLock_;  //!< Materialization lock of the stub kernels
 };
 
 #if defined(USE_COMGR_LIBRARY)
@@ -2748,22 +2748,22 @@ bool Program::FindGlobalVarSize(void* binary, size_t binSize) {
 
     auto numpHdrs = elfIn.getSegmentNum();
     for (unsigned int i = 0; i < numpHdrs; ++i) {
-      amd::ELFIO::segment* seg = nullptr;
+      const amd::ElfView::Segment* seg = nullptr;
       if (!elfIn.getSegment(i, seg)) {
         continue;
       }
 
       // Accumulate the size of R & !X loadable segments
-      if (seg->get_type() == PT_LOAD && !(seg->get_flags() & PF_X)) {
-        if (seg->get_flags() & PF_R) {
-          progvarsTotalSize += seg->get_memory_size();
+      if (seg->type_ == PT_LOAD && !(seg->flags_ & PF_X)) {
+        if (seg->flags_ & PF_R) {
+          progvarsTotalSize += seg->memory_size_;
         }
-        if (seg->get_flags() & PF_W) {
-          progvarsWriteSize += seg->get_memory_size();
+        if (seg->flags_ & PF_W) {
+          progvarsWriteSize += seg->memory_size_;
         }
       }
-      else if (seg->get_type() == PT_DYNAMIC) {
-        dynamicSize += seg->get_memory_size();
+      else if (seg->type_ == PT_DYNAMIC) {
+        dynamicSize += seg->memory_size_;
       }
     }
 
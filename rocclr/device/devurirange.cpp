@@ -0,0 +1,147 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#include "device/devurirange.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace amd::device {
+
+// ================================================================================================
+void UriRangeTable::Insert(Range&& range) {
+  auto it = std::upper_bound(ranges_.begin(), ranges_.end(), range.start_,
+                             [](uint64_t start, const Range& r) { return start < r.start_; });
+  ids_[range.id_] = {range.start_, range.end_};
+  ranges_.insert(it, std::move(range));
+}
+
+// ================================================================================================
+bool UriRangeTable::Remove(uint64_t id) {
+  if (ids_.erase(id) == 0) {
+    return false;
+  }
+  auto it = std::remove_if(ranges_.begin(), ranges_.end(),
+                           [id](const Range& r) { return r.id_ == id; });
+  ranges_.erase(it, ranges_.end());
+  return true;
+}
+
+// ================================================================================================
+bool UriRangeTable::Contains(uint64_t id, uint64_t start, uint64_t end) const {
+  auto it = ids_.find(id);
+  return (it != ids_.end()) && (it->second.first == start) && (it->second.second == end);
+}
+
+// ================================================================================================
+void UriRangeTable::Retain(const std::vector<uint64_t>& live_ids) {
+  for (auto it = ids_.begin(); it != ids_.end();) {
+    if (std::binary_search(live_ids.begin(), live_ids.end(), it->first)) {
+      ++it;
+    } else {
+      it = ids_.erase(it);
+    }
+  }
+  ranges_.erase(std::remove_if(ranges_.begin(), ranges_.end(),
+                               [&live_ids](const Range& r) {
+                                 return !std::binary_search(live_ids.begin(), live_ids.end(),
+                                                            r.id_);
+                               }),
+                ranges_.end());
+}
+
+// ================================================================================================
+const UriRangeTable::Range* UriRangeTable::Find(uint64_t pc) const {
+  // The last range, which starts at or below the PC
+  auto it = std::upper_bound(ranges_.begin(), ranges_.end(), pc,
+                             [](uint64_t addr, const Range& r) { return addr < r.start_; });
+  if (it == ranges_.begin()) {
+    return nullptr;
+  }
+  --it;
+  return (pc <= it->end_) ? &(*it) : nullptr;
+}
+
+// ================================================================================================
+static int HexValue(char c) {
+  if ((c >= '0') && (c <= '9')) {
+    return c - '0';
+  }
+  if ((c >= 'a') && (c <= 'f')) {
+    return c - 'a' + 10;
+  }
+  if ((c >= 'A') && (c <= 'F')) {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+// ================================================================================================
+// Encoding of uniform-resource-identifier(URI) is detailed in
+// https://llvm.org/docs/AMDGPUUsage.html#loaded-code-object-path-uniform-resource-identifier-uri
+bool DecodeUri(const std::string& uri, DecodedUri* decoded) {
+  *decoded = DecodedUri{};
+  auto scheme_end = uri.find("://");
+  if (scheme_end == std::string::npos) {
+    return false;
+  }
+  auto path_begin = scheme_end + 3;
+  auto fragment = uri.find('#', path_begin);
+  auto path_end = (fragment == std::string::npos) ? uri.size() : fragment;
+
+  // The range specifier is optional: #offset=<number>&size=<number>
+  if (fragment != std::string::npos) {
+    size_t pos = fragment + 1;
+    while (pos < uri.size()) {
+      auto end = uri.find('&', pos);
+      if (end == std::string::npos) {
+        end = uri.size();
+      }
+      std::string param = uri.substr(pos, end - pos);
+      if (param.compare(0, 7, "offset=") == 0) {
+        decoded->offset_ = strtoull(param.c_str() + 7, nullptr, 0);
+      } else if (param.compare(0, 5, "size=") == 0) {
+        decoded->size_ = strtoull(param.c_str() + 5, nullptr, 0);
+      }
+      pos = end + 1;
+    }
+  }
+
+  if (uri.compare(0, scheme_end, "file") == 0) {
+    // Decode the percent encoded characters of the file path
+    decoded->path_.reserve(path_end - path_begin);
+    for (size_t i = path_begin; i < path_end; ++i) {
+      if (uri[i] != '%') {
+        decoded->path_ += uri[i];
+        continue;
+      }
+      int high = (i + 2 < path_end) ? HexValue(uri[i + 1]) : -1;
+      int low = (i + 2 < path_end) ? HexValue(uri[i + 2]) : -1;
+      if ((high < 0) || (low < 0)) {
+        return false;
+      }
+      decoded->path_ += static_cast<char>((high << 4) | low);
+      i += 2;
+    }
+  }
+  return true;
+}
+
+}  // namespace amd::device
@@ -0,0 +1,92 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace amd::device {
+
+//! Address ranges of the loaded code objects, sorted by the start address for the binary
+//! search of a device PC. The table is updated per code object on load and unload,
+//! so a symbolizer doesn't rebuild it for every lookup.
+class UriRangeTable {
+ public:
+  //! Address range of a loaded code object
+  struct Range {
+    uint64_t start_;     //!< First address
+    uint64_t end_;       //!< Last address, inclusive
+    int64_t elf_delta_;  //!< Difference between the load and the ELF addresses
+    uint64_t id_;        //!< Loaded code object handle
+    std::string uri_;    //!< Code object URI
+  };
+
+  //! Adds the range and keeps the table sorted
+  void Insert(Range&& range);
+
+  //! Removes the ranges of the code object. Returns false if it wasn't in the table
+  bool Remove(uint64_t id);
+
+  //! Returns true if the code object is in the table with the same address range. A handle of
+  //! a destroyed executable can be reused by a new code object, which must replace the range
+  bool Contains(uint64_t id, uint64_t start, uint64_t end) const;
+
+  //! Removes the code objects, which aren't in the sorted list of live handles
+  void Retain(const std::vector<uint64_t>& live_ids);
+
+  //! Returns the range, which contains the PC, or nullptr
+  const Range* Find(uint64_t pc) const;
+
+  void Clear() {
+    ranges_.clear();
+    ids_.clear();
+  }
+  size_t size() const { return ranges_.size(); }
+  const Range& operator[](size_t index) const { return ranges_[index]; }
+
+  //! Marks the loaded code objects as changed. Called on every executable load and unload
+  static void CodeObjectsChanged() { generation_.fetch_add(1, std::memory_order_release); }
+
+  //! Returns the generation of the loaded code objects
+  static uint32_t Generation() { return generation_.load(std::memory_order_acquire); }
+
+ private:
+  std::vector<Range> ranges_;                          //!< Ranges sorted by the start address
+  //! First and last addresses of the code objects in the table
+  std::unordered_map<uint64_t, std::pair<uint64_t, uint64_t>> ids_;
+  static inline std::atomic<uint32_t> generation_{0};  //!< Bumped on load and unload
+};
+
+//! Code object URI, decoded per the AMDGPU loaded code object URI syntax
+struct DecodedUri {
+  std::string path_;     //!< Decoded file path for a file:// URI, empty otherwise
+  uint64_t offset_ = 0;  //!< Offset of the code object from the range specifier
+  uint64_t size_ = 0;    //!< Size of the code object from the range specifier, 0 if absent
+};
+
+//! Decodes the URI. Returns false for a malformed URI
+bool DecodeUri(const std::string& uri, DecodedUri* decoded);
+
+}  // namespace amd::device
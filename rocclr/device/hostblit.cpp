@@ -0,0 +1,334 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+
+#include "top.hpp"
+#include "os/os.hpp"
+#include "utils/flags.hpp"
+#include "device/hostblit.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define HOST_BLIT_SSE2 1
+#endif
+
+namespace amd::device {
+
+namespace {
+
+constexpr size_t kVectorSize = 16;        //!< Size of a SIMD register
+constexpr size_t kFillChunkSize = 4 * Ki;  //!< Size of the expanded fill pattern
+
+//! Orders the non-temporal stores of the current thread before the completion
+inline void StoreFence() {
+#if HOST_BLIT_SSE2
+  _mm_sfence();
+#endif
+}
+
+// ================================================================================================
+void CopyRow(address dst, const_address src, size_t size, bool nonTemporal) {
+#if HOST_BLIT_SSE2
+  if (nonTemporal && (size >= 4 * kVectorSize)) {
+    // Align the destination, the streaming stores require 16 bytes alignment
+    size_t head = (kVectorSize - (reinterpret_cast<uintptr_t>(dst) & (kVectorSize - 1))) &
+        (kVectorSize - 1);
+    std::memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    size -= head;
+    for (; size >= 4 * kVectorSize; size -= 4 * kVectorSize) {
+      __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+      __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + kVectorSize));
+      __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * kVectorSize));
+      __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3 * kVectorSize));
+      _mm_stream_si128(reinterpret_cast<__m128i*>(dst), v0);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(dst + kVectorSize), v1);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 2 * kVectorSize), v2);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 3 * kVectorSize), v3);
+      dst += 4 * kVectorSize;
+      src += 4 * kVectorSize;
+    }
+  }
+#endif
+  std::memcpy(dst, src, size);
+}
+
+//! Fill pattern, expanded for the row fills. The rows always start at an element boundary
+class FillSource {
+ public:
+  FillSource(const void* element, size_t elementSize) {
+    // The pattern repeats every lcm(elementSize, kVectorSize) bytes, so a few registers hold it
+    period_ = elementSize;
+    while ((period_ % kVectorSize) != 0) {
+      period_ += elementSize;
+    }
+    broadcast_ = (period_ <= kMaxPeriod);
+    // Repeat the element over the whole chunk, which is a multiple of the element size
+    chunkSize_ = std::max<size_t>(kFillChunkSize / elementSize, 1) * elementSize;
+    chunk_.resize(std::max(chunkSize_, kVectorSize + kMaxPeriod));
+    for (size_t offset = 0; offset < chunk_.size(); offset += elementSize) {
+      std::memcpy(&chunk_[offset], element, std::min(elementSize, chunk_.size() - offset));
+    }
+  }
+
+  // ==============================================================================================
+  void FillRow(address dst, size_t size, bool nonTemporal) const {
+#if HOST_BLIT_SSE2
+    if (broadcast_ && (size >= period_ + kVectorSize)) {
+      // Load the registers with the pattern phase of the first aligned address
+      size_t head = (kVectorSize - (reinterpret_cast<uintptr_t>(dst) & (kVectorSize - 1))) &
+          (kVectorSize - 1);
+      std::memcpy(dst, chunk_.data(), head);
+      const size_t count = period_ / kVectorSize;
+      __m128i v[kMaxPeriod / kVectorSize];
+      for (size_t i = 0; i < count; ++i) {
+        v[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chunk_.data() + head +
+                                                                 i * kVectorSize));
+      }
+      dst += head;
+      size -= head;
+      if (count == 1) {
+        if (nonTemporal) {
+          for (; size >= kVectorSize; size -= kVectorSize, dst += kVectorSize) {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst), v[0]);
+          }
+        } else {
+          for (; size >= kVectorSize; size -= kVectorSize, dst += kVectorSize) {
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst), v[0]);
+          }
+        }
+      } else {
+        for (; size >= period_; size -= period_) {
+          for (size_t i = 0; i < count; ++i, dst += kVectorSize) {
+            if (nonTemporal) {
+              _mm_stream_si128(reinterpret_cast<__m128i*>(dst), v[i]);
+            } else {
+              _mm_store_si128(reinterpret_cast<__m128i*>(dst), v[i]);
+            }
+          }
+        }
+      }
+      // The tail continues the pattern from the phase of the aligned part
+      std::memcpy(dst, chunk_.data() + head, size);
+      return;
+    }
+#endif
+    while (size > 0) {
+      size_t copy = std::min(size, chunkSize_);
+      CopyRow(dst, chunk_.data(), copy, nonTemporal);
+      dst += copy;
+      size -= copy;
+    }
+  }
+
+ private:
+  //! The longest pattern period, which is kept in the registers
+  static constexpr size_t kMaxPeriod = HostBlit::kMaxElementSize * kVectorSize;
+
+  size_t period_;               //!< Pattern period, a multiple of the register size
+  size_t chunkSize_;            //!< Size of the expanded pattern
+  bool broadcast_;              //!< The pattern fits the registers
+  std::vector<uint8_t> chunk_;  //!< Expanded pattern
+};
+
+//! Collapses the rows and slices, which are contiguous in all rectangles, into one wide row
+inline void CollapseRows(size_t& rowSize, size_t& rows, size_t& slices, size_t rowPitch0,
+                         size_t slicePitch0, size_t rowPitch1, size_t slicePitch1) {
+  if ((rows > 1) && (rowPitch0 == rowSize) && (rowPitch1 == rowSize)) {
+    rowSize *= rows;
+    rows = 1;
+  }
+  if ((rows == 1) && (slices > 1) && (slicePitch0 == rowSize) && (slicePitch1 == rowSize)) {
+    rowSize *= slices;
+    slices = 1;
+  }
+}
+
+//! Reference conversion of a linear color channel to 8-bit sRGB
+uint32_t sRGBmapReference(float fc) {
+  double c = static_cast<double>(fc);
+  if (std::isnan(c)) c = 0.0;
+
+  if (c > 1.0)
+    c = 1.0;
+  else if (c < 0.0)
+    c = 0.0;
+  else if (c < 0.0031308)
+    c = 12.92 * c;
+  else
+    c = (1055.0 / 1000.0) * std::pow(c, 5.0 / 12.0) - (55.0 / 1000.0);
+
+  return static_cast<uint32_t>(c * 255.0 + 0.5);
+}
+
+}  // namespace
+
+// ================================================================================================
+template <typename RowFunc>
+void HostBlit::ForEachRow(size_t rowSize, size_t rows, size_t slices, size_t granularity,
+                          RowFunc rowFunc) {
+  const size_t lines = rows * slices;
+  size_t threads = std::min<size_t>(DEBUG_CLR_HOST_BLIT_THREADS, Os::processorCount());
+  threads = std::min(threads, (rowSize * lines) / kParallelMinSize);
+  if (threads <= 1) {
+    for (size_t slice = 0; slice < slices; ++slice) {
+      for (size_t row = 0; row < rows; ++row) {
+        rowFunc(slice, row, 0, rowSize);
+      }
+    }
+    StoreFence();
+    return;
+  }
+
+  // Split the wide rows into parts, so every worker gets a share of a collapsed transfer
+  const size_t parts = (lines < threads) ? ((threads + lines - 1) / lines) : 1;
+  size_t partSize = (rowSize + parts - 1) / parts;
+  partSize = ((partSize + granularity - 1) / granularity) * granularity;
+  const size_t pieces = lines * parts;
+  const size_t perThread = (pieces + threads - 1) / threads;
+
+  auto worker = [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i) {
+      size_t line = i / parts;
+      size_t offset = (i % parts) * partSize;
+      if (offset < rowSize) {
+        rowFunc(line / rows, line % rows, offset, std::min(partSize, rowSize - offset));
+      }
+    }
+    StoreFence();
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(threads - 1);
+  for (size_t first = perThread; first < pieces; first += perThread) {
+    size_t last = std::min(pieces, first + perThread);
+    try {
+      workers.emplace_back(worker, first, last);
+    } catch (const std::system_error&) {
+      // Out of threads, process the pieces on the calling thread
+      worker(first, last);
+    }
+  }
+  worker(0, std::min(pieces, perThread));
+  for (auto& thread : workers) {
+    thread.join();
+  }
+}
+
+// ================================================================================================
+void HostBlit::CopyRect(void* dst, size_t dstRowPitch, size_t dstSlicePitch, const void* src,
+                        size_t srcRowPitch, size_t srcSlicePitch, size_t rowSize, size_t rows,
+                        size_t slices, bool nonTemporal) {
+  if ((rowSize == 0) || (rows == 0) || (slices == 0)) {
+    return;
+  }
+  CollapseRows(rowSize, rows, slices, dstRowPitch, dstSlicePitch, srcRowPitch, srcSlicePitch);
+  nonTemporal = nonTemporal && ((rowSize * rows * slices) >= kNonTemporalMinSize);
+
+  address dstBase = reinterpret_cast<address>(dst);
+  const_address srcBase = reinterpret_cast<const_address>(src);
+  ForEachRow(rowSize, rows, slices, 64, [&](size_t slice, size_t row, size_t offset, size_t size) {
+    CopyRow(dstBase + slice * dstSlicePitch + row * dstRowPitch + offset,
+            srcBase + slice * srcSlicePitch + row * srcRowPitch + offset, size, nonTemporal);
+  });
+}
+
+// ================================================================================================
+void HostBlit::FillRect(void* dst, size_t rowPitch, size_t slicePitch, const void* element,
+                        size_t elementSize, size_t width, size_t rows, size_t slices,
+                        bool nonTemporal) {
+  assert((elementSize > 0) && (elementSize <= kMaxElementSize) && "Unsupported element size");
+  size_t rowSize = width * elementSize;
+  if ((rowSize == 0) || (rows == 0) || (slices == 0)) {
+    return;
+  }
+  CollapseRows(rowSize, rows, slices, rowPitch, slicePitch, rowPitch, slicePitch);
+  nonTemporal = nonTemporal && ((rowSize * rows * slices) >= kNonTemporalMinSize);
+
+  FillSource source(element, elementSize);
+  address base = reinterpret_cast<address>(dst);
+  // The row parts must start at an element boundary to keep the pattern phase
+  ForEachRow(rowSize, rows, slices, 64 * elementSize,
+             [&](size_t slice, size_t row, size_t offset, size_t size) {
+               source.FillRow(base + slice * slicePitch + row * rowPitch + offset, size,
+                              nonTemporal);
+             });
+}
+
+// ================================================================================================
+void HostBlit::FillPattern(void* dst, size_t size, const void* pattern, size_t patternSize,
+                           bool nonTemporal) {
+  size_t count = size / patternSize;
+  if (count == 0) {
+    return;
+  }
+  if (patternSize <= kMaxElementSize) {
+    FillRect(dst, 0, 0, pattern, patternSize, count, 1, 1, nonTemporal);
+    return;
+  }
+  FillSource source(pattern, patternSize);
+  source.FillRow(reinterpret_cast<address>(dst), count * patternSize,
+                 nonTemporal && ((count * patternSize) >= kNonTemporalMinSize));
+  StoreFence();
+}
+
+// ================================================================================================
+uint32_t HostBlit::sRGBmap(float fc) {
+  // thresholds[k] is the smallest channel value, which maps to k + 1. The function is monotonic,
+  // so the table is found with a bisection over the ordered bit patterns of the positive floats
+  static const std::vector<float> thresholds = []() {
+    std::vector<float> table(255);
+    const float one = 1.0f;
+    uint32_t oneBits;
+    std::memcpy(&oneBits, &one, sizeof(oneBits));
+    for (uint32_t k = 1; k <= 255; ++k) {
+      uint32_t lo = 0;
+      uint32_t hi = oneBits;
+      while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        float value;
+        std::memcpy(&value, &mid, sizeof(value));
+        if (sRGBmapReference(value) >= k) {
+          hi = mid;
+        } else {
+          lo = mid + 1;
+        }
+      }
+      std::memcpy(&table[k - 1], &lo, sizeof(float));
+    }
+    return table;
+  }();
+
+  if (std::isnan(fc)) {
+    return 0;
+  }
+  return static_cast<uint32_t>(std::upper_bound(thresholds.begin(), thresholds.end(), fc) -
+                               thresholds.begin());
+}
+
+}  // namespace amd::device
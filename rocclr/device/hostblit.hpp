@@ -0,0 +1,82 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+
+#pragma once
+
+#include "top.hpp"
+
+namespace amd::device {
+
+//! CPU transfer kernels of the host blit paths. A rectangle is described by its base address,
+//! the row and slice pitches in bytes and the row/slice counts. Rows, which are contiguous in
+//! both rectangles, are collapsed into a single wide copy. Large transfers into device memory
+//! use non-temporal stores and can be split across worker threads (DEBUG_CLR_HOST_BLIT_THREADS).
+class HostBlit : AllStatic {
+ public:
+  //! Minimum size of a transfer, which uses non-temporal stores
+  static constexpr size_t kNonTemporalMinSize = 1 * Mi;
+  //! Minimum size of a transfer per worker thread
+  static constexpr size_t kParallelMinSize = 4 * Mi;
+  //! Largest element size of a fill pattern
+  static constexpr size_t kMaxElementSize = 16;
+
+  //! Copies a 3D rectangle. nonTemporal allows streaming stores, when the destination
+  //! isn't read back by the CPU (device memory)
+  static void CopyRect(void* dst,             //!< Destination of the first row
+                       size_t dstRowPitch,    //!< Destination row pitch in bytes
+                       size_t dstSlicePitch,  //!< Destination slice pitch in bytes
+                       const void* src,       //!< Source of the first row
+                       size_t srcRowPitch,    //!< Source row pitch in bytes
+                       size_t srcSlicePitch,  //!< Source slice pitch in bytes
+                       size_t rowSize,        //!< Row size in bytes
+                       size_t rows,           //!< Number of rows in a slice
+                       size_t slices,         //!< Number of slices
+                       bool nonTemporal       //!< Destination isn't read by the CPU
+  );
+
+  //! Fills a 3D rectangle with the element pattern
+  static void FillRect(void* dst,            //!< Destination of the first row
+                       size_t rowPitch,      //!< Row pitch in bytes
+                       size_t slicePitch,    //!< Slice pitch in bytes
+                       const void* element,  //!< Pattern of a single element
+                       size_t elementSize,   //!< Element size in bytes, up to kMaxElementSize
+                       size_t width,         //!< Number of elements in a row
+                       size_t rows,          //!< Number of rows in a slice
+                       size_t slices,        //!< Number of slices
+                       bool nonTemporal      //!< Destination isn't read by the CPU
+  );
+
+  //! Fills a linear range with a pattern of an arbitrary size
+  static void FillPattern(void* dst, size_t size, const void* pattern, size_t patternSize,
+                          bool nonTemporal);
+
+  //! Converts a linear color channel to the 8-bit sRGB value
+  static uint32_t sRGBmap(float fc);
+
+ private:
+  //! Calls rowFunc(slice, row, offset, size) for every row, possibly on worker threads.
+  //! Wide rows can be split into parts, which start at a multiple of granularity
+  template <typename RowFunc>
+  static void ForEachRow(size_t rowSize, size_t rows, size_t slices, size_t granularity,
+                         RowFunc rowFunc);
+};
+
+}  // namespace amd::device
@@ -0,0 +1,1721 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+
+//! \file hsamock.cpp
+//! \brief Mock HSA runtime for CPU-only performance testing of the ROCm backend.
+//!
+//! The file implements the subset of the HSA API, which the ROCm backend calls. It is compiled
+//! instead of linking libhsa-runtime64, when ROCCLR_ENABLE_HSA_MOCK is ON. It simulates
+//! a CPU agent and DEBUG_CLR_MOCK_HSA_DEVICES GPU agents with memory pools, signals,
+//! AQL queues, a copy engine and the code object loader. Every AQL queue has a worker thread,
+//! which honors the packet dependencies and retires the packets in order after
+//! DEBUG_CLR_MOCK_HSA_PACKET_DELAY. Kernels are never executed, but async copies move data,
+//! so the host side of the runtime can be measured without a GPU.
+
+#include "top.hpp"
+#include "os/os.hpp"
+#include "utils/flags.hpp"
+#include "utils/debug.hpp"
+#include "utils/util.hpp"
+#include "thread/sharedwait.hpp"
+#include "elf/elfview.hpp"
+#include "elf/elfio/elf_types.hpp"
+
+#include "hsa/hsa.h"
+#include "hsa/hsa_ext_amd.h"
+#include "hsa/hsa_ext_image.h"
+#include "hsa/hsa_ven_amd_loader.h"
+#include "hsa/amd_hsa_signal.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace amd::roc::mock {
+
+namespace {
+
+constexpr uint64_t kTimestampFrequency = 1000000000;  //!< 1 GHz, a tick is a nanosecond
+constexpr size_t kPacketSize = 64;
+constexpr uint16_t kPacketTypeMask = (1 << HSA_PACKET_HEADER_WIDTH_TYPE) - 1;
+constexpr uint32_t kMaxQueueSize = 128 * Ki;
+constexpr size_t kDeviceMemorySize = 16 * Gi;
+constexpr size_t kAllocGranule = 4 * Ki;
+constexpr uint32_t kKernelCodePropertiesOffset = 56;  //!< Offset in the kernel descriptor
+constexpr uint16_t kUsesDynamicStack = 1 << 11;       //!< Kernel code property bit
+
+// ================================================================================================
+inline bool Satisfied(hsa_signal_condition_t cond, int64_t value, int64_t compare) {
+  switch (cond) {
+    case HSA_SIGNAL_CONDITION_EQ:
+      return value == compare;
+    case HSA_SIGNAL_CONDITION_NE:
+      return value != compare;
+    case HSA_SIGNAL_CONDITION_LT:
+      return value < compare;
+    default:
+      return value >= compare;
+  }
+}
+
+// ================================================================================================
+inline void* AlignedAlloc(size_t size, size_t alignment) {
+  return aligned_alloc(alignment, amd::alignUp(std::max(size, alignment), alignment));
+}
+
+//! Signal. The handle is the address of the object and the runtime reads the profiling
+//! timestamps through amd_signal_t, so it must be the first member
+struct Signal {
+  amd_signal_t amd_;
+  SharedWaitWord word_;                //!< Wakes the host waiters on every update
+  std::atomic<uint32_t> handlers_;     //!< Number of the async handlers of the signal
+
+  explicit Signal(int64_t value) {
+    memset(&amd_, 0, sizeof(amd_));
+    amd_.kind = AMD_SIGNAL_KIND_USER;
+    amd_.value = value;
+    word_.Init();
+    handlers_.store(0, std::memory_order_relaxed);
+  }
+
+  int64_t Load() const { return __atomic_load_n(&amd_.value, __ATOMIC_SEQ_CST); }
+  void Store(int64_t value) {
+    __atomic_store_n(&amd_.value, value, __ATOMIC_SEQ_CST);
+    Notify();
+  }
+  void Add(int64_t value) {
+    __atomic_fetch_add(&amd_.value, value, __ATOMIC_SEQ_CST);
+    Notify();
+  }
+  void Notify();
+
+  //! Waits until done() is true or the deadline in ns has passed
+  template <typename Done>
+  void Wait(Done done, uint64_t deadline, uint64_t spin_ns) {
+    word_.Wait([&]() { return done() || (Os::timeNanos() >= deadline); }, spin_ns);
+  }
+};
+
+inline Signal* ToSignal(hsa_signal_t signal) { return reinterpret_cast<Signal*>(signal.handle); }
+
+//! Converts a relative timeout in ticks to an absolute deadline in ns
+inline uint64_t Deadline(uint64_t timeout) {
+  const uint64_t now = Os::timeNanos();
+  return (timeout > std::numeric_limits<uint64_t>::max() - now) ?
+      std::numeric_limits<uint64_t>::max() : now + timeout;
+}
+
+//! Waits until the signal reaches 0, the completion of a dependency
+inline void WaitDependency(hsa_signal_t signal) {
+  if (signal.handle != 0) {
+    Signal* dep = ToSignal(signal);
+    dep->Wait([dep]() { return dep->Load() == 0; }, std::numeric_limits<uint64_t>::max(), 0);
+  }
+}
+
+//! Decrements the completion signal and records the execution time for profiling
+inline void Complete(hsa_signal_t signal, uint64_t start) {
+  if (signal.handle != 0) {
+    Signal* completion = ToSignal(signal);
+    completion->amd_.start_ts = start;
+    completion->amd_.end_ts = Os::timeNanos();
+    completion->Add(-1);
+  }
+}
+
+struct Agent;
+
+struct Pool {
+  Agent* owner_;
+  hsa_amd_segment_t segment_;
+  uint32_t flags_;                   //!< HSA_REGION_GLOBAL_FLAG_* of a global pool
+  size_t size_;
+  std::atomic<size_t> allocated_;    //!< Bytes allocated from the pool
+};
+
+struct Isa {
+  std::string name_;                 //!< Full ISA name with the amdgcn-amd-amdhsa-- prefix
+};
+
+struct Agent {
+  hsa_device_type_t type_;
+  uint32_t index_;                   //!< Node index, the CPU agent is 0
+  std::string name_;                 //!< Processor name without the target features
+  Isa isa_;
+  std::vector<std::unique_ptr<Pool>> pools_;
+  uint32_t hdp_flush_[2];            //!< Fake HDP flush registers
+};
+
+//! AQL queue. The handle is the address of the object, so hsa_queue_t must be the first member
+struct Queue {
+  hsa_queue_t hsa_;
+  std::atomic<uint64_t> write_index_;
+  std::atomic<uint64_t> read_index_;
+  Signal* doorbell_;
+  std::atomic<bool> exit_;
+  std::thread worker_;
+
+  void Run();
+  void Process(const uint8_t* packet, uint16_t type);
+};
+
+inline Queue* ToQueue(const hsa_queue_t* queue) {
+  return reinterpret_cast<Queue*>(const_cast<hsa_queue_t*>(queue));
+}
+
+struct CodeObjectReader {
+  const void* image_;
+  size_t size_;
+};
+
+struct Executable;
+
+struct Symbol {
+  std::string name_;
+  hsa_symbol_kind_t kind_;
+  const Agent* agent_;               //!< nullptr for a program symbol
+  uint64_t address_;                 //!< Kernel descriptor or variable address
+  uint32_t size_;
+  bool is_const_;
+  bool dynamic_callstack_;
+};
+
+struct LoadedCodeObject {
+  Executable* executable_;
+  char* base_;
+  size_t size_;
+  std::string uri_;
+};
+
+struct Executable {
+  hsa_executable_state_t state_ = HSA_EXECUTABLE_STATE_UNFROZEN;
+  std::vector<std::unique_ptr<LoadedCodeObject>> code_objects_;
+  std::vector<std::unique_ptr<Symbol>> symbols_;
+};
+
+struct Allocation {
+  size_t size_;
+  Pool* pool_;                       //!< nullptr for registered host memory
+  hsa_amd_pointer_type_t type_;
+};
+
+struct AsyncHandler {
+  Signal* signal_;
+  hsa_signal_condition_t cond_;
+  int64_t value_;
+  hsa_amd_signal_handler handler_;
+  void* arg_;
+};
+
+struct CopyJob {
+  std::vector<hsa_signal_t> deps_;
+  std::function<void()> copy_;
+  hsa_signal_t completion_;
+};
+
+//! Wakes the handler thread. A signal can be updated during or after hsa_shut_down, i.e. by the
+//! copy thread of the runtime in destruction or by the application, so the word outlives the
+//! runtime and the signals never dereference it
+SharedWaitWord handler_word;
+
+// ================================================================================================
+//! State of the mock runtime between hsa_init and the last hsa_shut_down
+class Runtime {
+ public:
+  Runtime();
+  ~Runtime();
+
+  std::vector<std::unique_ptr<Agent>> agents_;  //!< CPU agent first, then the GPU agents
+
+  std::mutex memory_lock_;
+  std::map<uintptr_t, Allocation> allocations_;  //!< Allocations by the base address
+
+  std::mutex executable_lock_;
+  std::vector<Executable*> executables_;
+
+  void AddHandler(const AsyncHandler& handler);
+  void AddCopy(CopyJob&& job);
+
+  //! Finds the allocation, which contains the address
+  std::map<uintptr_t, Allocation>::iterator FindAllocation(const void* ptr);
+
+ private:
+  void HandlerLoop();
+  bool CollectHandlers(std::vector<AsyncHandler>* ready);
+  void CopyLoop();
+
+  std::atomic<bool> exit_{false};
+
+  std::mutex handler_lock_;
+  std::vector<AsyncHandler> handlers_;  //!< Armed async handlers
+  std::thread handler_thread_;
+
+  std::mutex copy_lock_;
+  std::condition_variable copy_cv_;
+  std::deque<CopyJob> copies_;          //!< Jobs of the copy engine in submission order
+  std::thread copy_thread_;
+};
+
+std::mutex runtime_lock;
+Runtime* runtime = nullptr;
+uint32_t runtime_refs = 0;
+std::atomic<uint64_t> queue_id{0};
+
+// ================================================================================================
+void Signal::Notify() {
+  word_.Wake();
+  if (handlers_.load() != 0) {
+    handler_word.Wake();
+  }
+}
+
+// ================================================================================================
+Runtime::Runtime() {
+  handler_word.Init();
+
+  auto addPool = [](Agent* agent, hsa_amd_segment_t segment, uint32_t flags, size_t size) {
+    agent->pools_.emplace_back(new Pool{agent, segment, flags, size, {0}});
+  };
+
+  Agent* cpu = new Agent{HSA_DEVICE_TYPE_CPU, 0, "Mock CPU", {""}, {}, {0, 0}};
+  agents_.emplace_back(cpu);
+  addPool(cpu, HSA_AMD_SEGMENT_GLOBAL,
+          HSA_REGION_GLOBAL_FLAG_FINE_GRAINED | HSA_REGION_GLOBAL_FLAG_KERNARG,
+          Os::getPhysicalMemSize());
+  addPool(cpu, HSA_AMD_SEGMENT_GLOBAL, HSA_REGION_GLOBAL_FLAG_COARSE_GRAINED,
+          Os::getPhysicalMemSize());
+
+  // The processor name is the target ID without the features
+  std::string target_id = DEBUG_CLR_MOCK_HSA_ISA;
+  std::string processor = target_id.substr(0, target_id.find(':'));
+  for (uint32_t i = 0; i < std::max(DEBUG_CLR_MOCK_HSA_DEVICES, 1u); ++i) {
+    Agent* gpu = new Agent{HSA_DEVICE_TYPE_GPU, i + 1, processor,
+                           {"amdgcn-amd-amdhsa--" + target_id}, {}, {0, 0}};
+    agents_.emplace_back(gpu);
+    addPool(gpu, HSA_AMD_SEGMENT_GLOBAL, HSA_REGION_GLOBAL_FLAG_COARSE_GRAINED,
+            kDeviceMemorySize);
+    addPool(gpu, HSA_AMD_SEGMENT_GLOBAL, HSA_REGION_GLOBAL_FLAG_FINE_GRAINED,
+            kDeviceMemorySize);
+    addPool(gpu, HSA_AMD_SEGMENT_GROUP, 0, 64 * Ki);
+  }
+
+  handler_thread_ = std::thread([this]() { HandlerLoop(); });
+  copy_thread_ = std::thread([this]() { CopyLoop(); });
+}
+
+// ================================================================================================
+Runtime::~Runtime() {
+  exit_.store(true);
+  handler_word.Wake();
+  {
+    std::lock_guard<std::mutex> lock(copy_lock_);
+    copy_cv_.notify_all();
+  }
+  handler_thread_.join();
+  copy_thread_.join();
+
+  for (auto& it : allocations_) {
+    if (it.second.pool_ != nullptr) {
+      free(reinterpret_cast<void*>(it.first));
+    }
+  }
+}
+
+// ================================================================================================
+std::map<uintptr_t, Allocation>::iterator Runtime::FindAllocation(const void* ptr) {
+  uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+  auto it = allocations_.upper_bound(address);
+  if (it == allocations_.begin()) {
+    return allocations_.end();
+  }
+  --it;
+  return (address < it->first + it->second.size_) ? it : allocations_.end();
+}
+
+// ================================================================================================
+void Runtime::AddHandler(const AsyncHandler& handler) {
+  {
+    std::lock_guard<std::mutex> lock(handler_lock_);
+    handler.signal_->handlers_.fetch_add(1);
+    handlers_.push_back(handler);
+  }
+  handler_word.Wake();
+}
+
+// ================================================================================================
+bool Runtime::CollectHandlers(std::vector<AsyncHandler>* ready) {
+  std::lock_guard<std::mutex> lock(handler_lock_);
+  for (auto it = handlers_.begin(); it != handlers_.end();) {
+    if (Satisfied(it->cond_, it->signal_->Load(), it->value_)) {
+      it->signal_->handlers_.fetch_sub(1);
+      ready->push_back(*it);
+      it = handlers_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return !ready->empty();
+}
+
+// ================================================================================================
+void Runtime::HandlerLoop() {
+  std::vector<AsyncHandler> ready;
+  while (true) {
+    handler_word.Wait([&]() { return CollectHandlers(&ready) || exit_.load(); }, 0);
+    for (const auto& handler : ready) {
+      // A handler, which returns true, stays armed
+      if (handler.handler_(handler.signal_->Load(), handler.arg_)) {
+        AddHandler(handler);
+      }
+    }
+    ready.clear();
+    if (exit_.load()) {
+      return;
+    }
+  }
+}
+
+// ================================================================================================
+void Runtime::AddCopy(CopyJob&& job) {
+  std::lock_guard<std::mutex> lock(copy_lock_);
+  copies_.push_back(std::move(job));
+  copy_cv_.notify_one();
+}
+
+// ================================================================================================
+void Runtime::CopyLoop() {
+  while (true) {
+    CopyJob job;
+    {
+      std::unique_lock<std::mutex> lock(copy_lock_);
+      copy_cv_.wait(lock, [this]() { return !copies_.empty() || exit_.load(); });
+      if (copies_.empty()) {
+        return;
+      }
+      job = std::move(copies_.front());
+      copies_.pop_front();
+    }
+    for (auto dep : job.deps_) {
+      WaitDependency(dep);
+    }
+    uint64_t start = Os::timeNanos();
+    job.copy_();
+    Complete(job.completion_, start);
+  }
+}
+
+// ================================================================================================
+void Queue::Run() {
+  auto ring = reinterpret_cast<uint8_t*>(hsa_.base_address);
+  while (true) {
+    uint64_t index = read_index_.load(std::memory_order_relaxed);
+    uint8_t* packet = ring + (index % hsa_.size) * kPacketSize;
+    uint16_t* header = reinterpret_cast<uint16_t*>(packet);
+    uint16_t type = HSA_PACKET_TYPE_INVALID;
+    // The producer publishes the header with a release store and then rings the doorbell
+    doorbell_->word_.Wait([&]() {
+      type = __atomic_load_n(header, __ATOMIC_ACQUIRE) & kPacketTypeMask;
+      return (type != HSA_PACKET_TYPE_INVALID) || exit_.load();
+    }, 0);
+    if (type == HSA_PACKET_TYPE_INVALID) {
+      return;
+    }
+    Process(packet, type);
+  }
+}
+
+// ================================================================================================
+void Queue::Process(const uint8_t* packet, uint16_t type) {
+  hsa_signal_t completion = {0};
+  switch (type) {
+    case HSA_PACKET_TYPE_KERNEL_DISPATCH:
+      completion = reinterpret_cast<const hsa_kernel_dispatch_packet_t*>(packet)->completion_signal;
+      break;
+    case HSA_PACKET_TYPE_BARRIER_AND: {
+      auto barrier = reinterpret_cast<const hsa_barrier_and_packet_t*>(packet);
+      for (auto dep : barrier->dep_signal) {
+        WaitDependency(dep);
+      }
+      completion = barrier->completion_signal;
+      break;
+    }
+    case HSA_PACKET_TYPE_BARRIER_OR: {
+      auto barrier = reinterpret_cast<const hsa_barrier_or_packet_t*>(packet);
+      auto anyDone = [barrier]() {
+        bool empty = true;
+        for (auto dep : barrier->dep_signal) {
+          if (dep.handle != 0) {
+            empty = false;
+            if (ToSignal(dep)->Load() == 0) {
+              return true;
+            }
+          }
+        }
+        return empty;
+      };
+      // Poll on the first dependency with a short timeout, since any of them can complete
+      while (!anyDone()) {
+        for (auto dep : barrier->dep_signal) {
+          if (dep.handle != 0) {
+            ToSignal(dep)->Wait(anyDone, Deadline(100 * 1000), 0);
+            break;
+          }
+        }
+      }
+      completion = barrier->completion_signal;
+      break;
+    }
+    case HSA_PACKET_TYPE_VENDOR_SPECIFIC: {
+      auto vendor = reinterpret_cast<const hsa_amd_vendor_packet_header_t*>(packet);
+      if (vendor->AmdFormat == HSA_AMD_PACKET_TYPE_BARRIER_VALUE) {
+        auto barrier = reinterpret_cast<const hsa_amd_barrier_value_packet_t*>(packet);
+        if (barrier->signal.handle != 0) {
+          Signal* signal = ToSignal(barrier->signal);
+          signal->Wait([&]() {
+            return Satisfied(static_cast<hsa_signal_condition_t>(barrier->cond),
+                             signal->Load() & barrier->mask, barrier->value);
+          }, std::numeric_limits<uint64_t>::max(), 0);
+        }
+        completion = barrier->completion_signal;
+      }
+      break;
+    }
+    default:
+      break;
+  }
+
+  // Simulate the execution time on the device, the kernel itself is never executed
+  uint64_t start = Os::timeNanos();
+  if (DEBUG_CLR_MOCK_HSA_PACKET_DELAY != 0) {
+    std::this_thread::sleep_for(std::chrono::microseconds(DEBUG_CLR_MOCK_HSA_PACKET_DELAY));
+  }
+
+  // Retire the packet: release the slot and then signal the completion, as the packet processor
+  __atomic_store_n(reinterpret_cast<uint16_t*>(const_cast<uint8_t*>(packet)),
+                   static_cast<uint16_t>(HSA_PACKET_TYPE_INVALID << HSA_PACKET_HEADER_TYPE),
+                   __ATOMIC_RELAXED);
+  read_index_.fetch_add(1, std::memory_order_release);
+  Complete(completion, start);
+}
+
+// ================================================================================================
+inline Agent* ToAgent(hsa_agent_t agent) { return reinterpret_cast<Agent*>(agent.handle); }
+inline Pool* ToPool(hsa_amd_memory_pool_t pool) { return reinterpret_cast<Pool*>(pool.handle); }
+inline Executable* ToExecutable(hsa_executable_t executable) {
+  return reinterpret_cast<Executable*>(executable.handle);
+}
+
+template <typename T>
+inline hsa_status_t SetInfo(void* value, T data) {
+  memcpy(value, &data, sizeof(T));
+  return HSA_STATUS_SUCCESS;
+}
+
+inline hsa_status_t SetString(void* value, const std::string& str, size_t size) {
+  memset(value, 0, size);
+  memcpy(value, str.c_str(), std::min(str.size(), size - 1));
+  return HSA_STATUS_SUCCESS;
+}
+
+// ================================================================================================
+hsa_status_t GetCpuAgentInfo(Agent* agent, uint32_t attribute, void* value) {
+  switch (attribute) {
+    case HSA_AGENT_INFO_NAME:
+      return SetString(value, agent->name_, 64);
+    case HSA_AGENT_INFO_VENDOR_NAME:
+      return SetString(value, "AMD", 64);
+    case HSA_AGENT_INFO_DEVICE:
+      return SetInfo(value, agent->type_);
+    case HSA_AGENT_INFO_PROFILE:
+      return SetInfo(value, HSA_PROFILE_FULL);
+    case HSA_AGENT_INFO_NODE:
+      return SetInfo(value, agent->index_);
+    case HSA_AMD_AGENT_INFO_COMPUTE_UNIT_COUNT:
+      return SetInfo(value, static_cast<uint32_t>(Os::processorCount()));
+    default:
+      return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+}
+
+// ================================================================================================
+hsa_status_t GetGpuAgentInfo(Agent* agent, uint32_t attribute, void* value) {
+  switch (attribute) {
+    case HSA_AGENT_INFO_NAME:
+      return SetString(value, agent->name_, 64);
+    case HSA_AGENT_INFO_VENDOR_NAME:
+      return SetString(value, "AMD", 64);
+    case HSA_AGENT_INFO_DEVICE:
+      return SetInfo(value, agent->type_);
+    case HSA_AGENT_INFO_PROFILE:
+      return SetInfo(value, HSA_PROFILE_BASE);
+    case HSA_AGENT_INFO_NODE:
+    case HSA_AMD_AGENT_INFO_DRIVER_NODE_ID:
+      return SetInfo(value, agent->index_);
+    case HSA_AGENT_INFO_EXTENSIONS:
+      // No images, no performance counters
+      memset(value, 0, 128);
+      return HSA_STATUS_SUCCESS;
+    case HSA_AGENT_INFO_CACHE_SIZE: {
+      const uint32_t cache_size[4] = {16 * Ki, 8 * Mi, 0, 0};
+      memcpy(value, cache_size, sizeof(cache_size));
+      return HSA_STATUS_SUCCESS;
+    }
+    case HSA_AGENT_INFO_WORKGROUP_MAX_SIZE:
+      return SetInfo(value, 1024u);
+    case HSA_AGENT_INFO_WORKGROUP_MAX_DIM: {
+      const uint16_t dim[3] = {1024, 1024, 1024};
+      memcpy(value, dim, sizeof(dim));
+      return HSA_STATUS_SUCCESS;
+    }
+    case HSA_AGENT_INFO_GRID_MAX_SIZE:
+      return SetInfo(value, std::numeric_limits<uint32_t>::max());
+    case HSA_AGENT_INFO_WAVEFRONT_SIZE:
+      return SetInfo(value, 64u);
+    case HSA_AGENT_INFO_QUEUES_MAX:
+      return SetInfo(value, 128u);
+    case HSA_AGENT_INFO_QUEUE_MIN_SIZE:
+      return SetInfo(value, 64u);
+    case HSA_AGENT_INFO_QUEUE_MAX_SIZE:
+      return SetInfo(value, kMaxQueueSize);
+    case HSA_AGENT_INFO_VERSION_MAJOR:
+      return SetInfo(value, static_cast<uint16_t>(1));
+    case HSA_AGENT_INFO_VERSION_MINOR:
+      return SetInfo(value, static_cast<uint16_t>(1));
+    case HSA_AMD_AGENT_INFO_CHIP_ID:
+      return SetInfo(value, 0x7400u + agent->index_);
+    case HSA_AMD_AGENT_INFO_PRODUCT_NAME:
+      return SetString(value, "AMD Mock GPU", 64);
+    case HSA_AMD_AGENT_INFO_UUID: {
+      char uuid[21];
+      snprintf(uuid, sizeof(uuid), "GPU-%016llx", 0x6d6f636b00000000ull + agent->index_);
+      return SetString(value, uuid, sizeof(uuid));
+    }
+    case HSA_AMD_AGENT_INFO_BDFID:
+      return SetInfo(value, agent->index_ << 8);
+    case HSA_AMD_AGENT_INFO_DOMAIN:
+    case HSA_AMD_AGENT_INFO_ASIC_REVISION:
+      return SetInfo(value, 0u);
+    case HSA_AMD_AGENT_INFO_COMPUTE_UNIT_COUNT:
+    case HSA_AMD_AGENT_INFO_COOPERATIVE_COMPUTE_UNIT_COUNT:
+      return SetInfo(value, 104u);
+    case HSA_AMD_AGENT_INFO_COOPERATIVE_QUEUES:
+      return SetInfo(value, true);
+    case HSA_AMD_AGENT_INFO_MAX_WAVES_PER_CU:
+      return SetInfo(value, 32u);
+    case HSA_AMD_AGENT_INFO_NUM_SIMDS_PER_CU:
+      return SetInfo(value, 4u);
+    case HSA_AMD_AGENT_INFO_CACHELINE_SIZE:
+      return SetInfo(value, 128u);
+    case HSA_AMD_AGENT_INFO_MAX_CLOCK_FREQUENCY:
+      return SetInfo(value, 1700u);
+    case HSA_AMD_AGENT_INFO_MEMORY_MAX_FREQUENCY:
+      return SetInfo(value, 1600u);
+    case HSA_AMD_AGENT_INFO_TIMESTAMP_FREQUENCY:
+      return SetInfo(value, kTimestampFrequency);
+    case HSA_AMD_AGENT_INFO_MEMORY_WIDTH:
+      return SetInfo(value, 4096u);
+    case HSA_AMD_AGENT_INFO_MEMORY_PROPERTIES:
+      memset(value, 0, 8);
+      return HSA_STATUS_SUCCESS;
+    case HSA_AMD_AGENT_INFO_MEMORY_AVAIL: {
+      Pool* pool = agent->pools_[0].get();
+      return SetInfo(value, static_cast<uint64_t>(pool->size_ - pool->allocated_.load()));
+    }
+    case HSA_AMD_AGENT_INFO_SVM_DIRECT_HOST_ACCESS:
+      return SetInfo(value, false);
+    case HSA_AMD_AGENT_INFO_NUM_SDMA_ENG:
+      return SetInfo(value, 2u);
+    case HSA_AMD_AGENT_INFO_HDP_FLUSH: {
+      hsa_amd_hdp_flush_t hdp = {&agent->hdp_flush_[0], &agent->hdp_flush_[1]};
+      return SetInfo(value, hdp);
+    }
+    default:
+      return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+}
+
+// ================================================================================================
+hsa_status_t LoadCodeObject(Executable* executable, Agent* agent, const CodeObjectReader* reader,
+                            hsa_loaded_code_object_t* loaded_code_object) {
+  ElfView elf;
+  if (!elf.Init(reader->image_, reader->size_)) {
+    return HSA_STATUS_ERROR_INVALID_CODE_OBJECT;
+  }
+
+  uint64_t load_size = 0;
+  for (size_t i = 0; i < elf.SegmentNum(); ++i) {
+    const ElfView::Segment* segment = elf.GetSegment(i);
+    if (segment->type_ == PT_LOAD) {
+      if ((segment->offset_ > elf.size()) ||
+          (segment->file_size_ > std::min(segment->memory_size_, elf.size() - segment->offset_))) {
+        return HSA_STATUS_ERROR_INVALID_CODE_OBJECT;
+      }
+      load_size = std::max(load_size, segment->vaddr_ + segment->memory_size_);
+    }
+  }
+
+  std::unique_ptr<LoadedCodeObject> code_object(new LoadedCodeObject);
+  code_object->executable_ = executable;
+  code_object->size_ = amd::alignUp(std::max(load_size, uint64_t{1}), kAllocGranule);
+  code_object->base_ = reinterpret_cast<char*>(AlignedAlloc(code_object->size_, kAllocGranule));
+  if (code_object->base_ == nullptr) {
+    return HSA_STATUS_ERROR_OUT_OF_RESOURCES;
+  }
+  memset(code_object->base_, 0, code_object->size_);
+  for (size_t i = 0; i < elf.SegmentNum(); ++i) {
+    const ElfView::Segment* segment = elf.GetSegment(i);
+    if (segment->type_ == PT_LOAD) {
+      memcpy(code_object->base_ + segment->vaddr_, elf.image() + segment->offset_,
+             segment->file_size_);
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(runtime->memory_lock_);
+    runtime->allocations_[reinterpret_cast<uintptr_t>(code_object->base_)] =
+        {code_object->size_, agent->pools_[0].get(), HSA_EXT_POINTER_TYPE_HSA};
+  }
+  code_object->uri_ = "memory://" + std::to_string(getpid()) + "#offset=" +
+      std::to_string(reinterpret_cast<uintptr_t>(reader->image_)) +
+      "&size=" + std::to_string(reader->size_);
+
+  // The dynamic symbols of a code object are the kernel descriptors and the global variables
+  uint32_t symtab = 0;
+  for (uint32_t i = 0; i < elf.SectionNum(); ++i) {
+    if (elf.GetSection(i)->type_ == SHT_DYNSYM) {
+      symtab = i;
+      break;
+    } else if (elf.GetSection(i)->type_ == SHT_SYMTAB) {
+      symtab = i;
+    }
+  }
+  constexpr char kKernelSuffix[] = ".kd";
+  constexpr size_t kKernelSuffixSize = sizeof(kKernelSuffix) - 1;
+  for (size_t i = 1; i < elf.SymbolNum(symtab); ++i) {
+    ElfView::Symbol sym;
+    if (!elf.GetSymbol(symtab, i, &sym) || (sym.bind_ == STB_LOCAL) ||
+        (sym.type_ != STT_OBJECT) || (sym.section_index_ == SHN_UNDEF) ||
+        (sym.value_ + sym.size_ > load_size)) {
+      continue;
+    }
+    std::unique_ptr<Symbol> symbol(new Symbol);
+    symbol->name_ = sym.name_;
+    symbol->agent_ = agent;
+    symbol->address_ = reinterpret_cast<uint64_t>(code_object->base_) + sym.value_;
+    symbol->size_ = static_cast<uint32_t>(sym.size_);
+    const size_t length = symbol->name_.size();
+    if ((length > kKernelSuffixSize) && (symbol->name_.compare(
+        length - kKernelSuffixSize, kKernelSuffixSize, kKernelSuffix) == 0)) {
+      uint16_t properties = 0;
+      if (sym.value_ + kKernelCodePropertiesOffset + sizeof(properties) <= load_size) {
+        memcpy(&properties, code_object->base_ + sym.value_ + kKernelCodePropertiesOffset,
+               sizeof(properties));
+      }
+      symbol->kind_ = HSA_SYMBOL_KIND_KERNEL;
+      symbol->is_const_ = true;
+      symbol->dynamic_callstack_ = (properties & kUsesDynamicStack) != 0;
+    } else {
+      const ElfView::Section* section = elf.GetSection(sym.section_index_);
+      symbol->kind_ = HSA_SYMBOL_KIND_VARIABLE;
+      symbol->is_const_ = (section == nullptr) || ((section->flags_ & SHF_WRITE) == 0);
+      symbol->dynamic_callstack_ = false;
+    }
+    executable->symbols_.push_back(std::move(symbol));
+  }
+
+  if (loaded_code_object != nullptr) {
+    loaded_code_object->handle = reinterpret_cast<uint64_t>(code_object.get());
+  }
+  executable->code_objects_.push_back(std::move(code_object));
+  return HSA_STATUS_SUCCESS;
+}
+
+// ================================================================================================
+hsa_status_t LoaderQueryHostAddress(const void* device_address, const void** host_address) {
+  // All device memory of the mock runtime is host memory
+  *host_address = device_address;
+  return HSA_STATUS_SUCCESS;
+}
+
+// ================================================================================================
+hsa_status_t LoaderIterateExecutables(
+    hsa_status_t (*callback)(hsa_executable_t executable, void* data), void* data) {
+  std::vector<Executable*> executables;
+  {
+    std::lock_guard<std::mutex> lock(runtime->executable_lock_);
+    executables = runtime->executables_;
+  }
+  for (auto executable : executables) {
+    hsa_status_t status = callback({reinterpret_cast<uint64_t>(executable)}, data);
+    if (status != HSA_STATUS_SUCCESS) {
+      return status;
+    }
+  }
+  return HSA_STATUS_SUCCESS;
+}
+
+// ================================================================================================
+hsa_status_t LoaderIterateLoadedCodeObjects(
+    hsa_executable_t executable,
+    hsa_status_t (*callback)(hsa_executable_t executable,
+                             hsa_loaded_code_object_t loaded_code_object, void* data),
+    void* data) {
+  for (const auto& code_object : ToExecutable(executable)->code_objects_) {
+    hsa_status_t status =
+        callback(executable, {reinterpret_cast<uint64_t>(code_object.get())}, data);
+    if (status != HSA_STATUS_SUCCESS) {
+      return status;
+    }
+  }
+  return HSA_STATUS_SUCCESS;
+}
+
+// ================================================================================================
+hsa_status_t LoaderLoadedCodeObjectGetInfo(hsa_loaded_code_object_t loaded_code_object,
+                                           hsa_ven_amd_loader_loaded_code_object_info_t attribute,
+                                           void* value) {
+  auto code_object = reinterpret_cast<const LoadedCodeObject*>(loaded_code_object.handle);
+  switch (attribute) {
+    case HSA_VEN_AMD_LOADER_LOADED_CODE_OBJECT_INFO_LOAD_BASE:
+      return SetInfo(value, reinterpret_cast<uint64_t>(code_object->base_));
+    case HSA_VEN_AMD_LOADER_LOADED_CODE_OBJECT_INFO_LOAD_SIZE:
+      return SetInfo(value, static_cast<uint64_t>(code_object->size_));
+    case HSA_VEN_AMD_LOADER_LOADED_CODE_OBJECT_INFO_LOAD_DELTA:
+      return SetInfo(value, reinterpret_cast<int64_t>(code_object->base_));
+    case HSA_VEN_AMD_LOADER_LOADED_CODE_OBJECT_INFO_URI_LENGTH:
+      return SetInfo(value, static_cast<uint32_t>(code_object->uri_.size()));
+    case HSA_VEN_AMD_LOADER_LOADED_CODE_OBJECT_INFO_URI:
+      memcpy(value, code_object->uri_.data(), code_object->uri_.size());
+      return HSA_STATUS_SUCCESS;
+    default:
+      return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+}
+
+}  // namespace
+}  // namespace amd::roc::mock
+
+using namespace amd::roc::mock;
+
+extern "C" {
+
+// ================================================================================================
+// Runtime and system
+// ================================================================================================
+hsa_status_t hsa_init() {
+  std::lock_guard<std::mutex> lock(runtime_lock);
+  if (runtime_refs++ == 0) {
+    runtime = new Runtime();
+  }
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_shut_down() {
+  std::lock_guard<std::mutex> lock(runtime_lock);
+  if (runtime_refs == 0) {
+    return HSA_STATUS_ERROR_NOT_INITIALIZED;
+  }
+  if (--runtime_refs == 0) {
+    delete runtime;
+    runtime = nullptr;
+  }
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_status_string(hsa_status_t status, const char** status_string) {
+  switch (status) {
+    case HSA_STATUS_SUCCESS:
+      *status_string = "HSA_STATUS_SUCCESS: The function has been executed successfully.";
+      break;
+    case HSA_STATUS_ERROR_INVALID_ARGUMENT:
+      *status_string = "HSA_STATUS_ERROR_INVALID_ARGUMENT: One of the arguments is invalid.";
+      break;
+    case HSA_STATUS_ERROR_OUT_OF_RESOURCES:
+      *status_string = "HSA_STATUS_ERROR_OUT_OF_RESOURCES: The runtime is out of resources.";
+      break;
+    default:
+      *status_string = "HSA_STATUS_ERROR: The operation isn't supported by the mock runtime.";
+      break;
+  }
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_system_get_info(hsa_system_info_t attribute, void* value) {
+  switch (static_cast<uint32_t>(attribute)) {
+    case HSA_SYSTEM_INFO_VERSION_MAJOR:
+    case HSA_SYSTEM_INFO_VERSION_MINOR:
+      return SetInfo(value, static_cast<uint16_t>(1));
+    case HSA_SYSTEM_INFO_TIMESTAMP:
+      return SetInfo(value, amd::Os::timeNanos());
+    case HSA_SYSTEM_INFO_TIMESTAMP_FREQUENCY:
+      return SetInfo(value, kTimestampFrequency);
+    case HSA_SYSTEM_INFO_ENDIANNESS:
+      return SetInfo(value, HSA_ENDIANNESS_LITTLE);
+    case HSA_SYSTEM_INFO_MACHINE_MODEL:
+      return SetInfo(value, HSA_MACHINE_MODEL_LARGE);
+    case HSA_AMD_SYSTEM_INFO_SVM_SUPPORTED:
+    case HSA_AMD_SYSTEM_INFO_SVM_ACCESSIBLE_BY_DEFAULT:
+    case HSA_AMD_SYSTEM_INFO_VIRTUAL_MEM_API_SUPPORTED:
+      // SVM and the virtual memory API aren't simulated
+      return SetInfo(value, false);
+    default:
+      return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+}
+
+hsa_status_t hsa_system_extension_supported(uint16_t extension, uint16_t version_major,
+                                            uint16_t version_minor, bool* result) {
+  *result = (extension == HSA_EXTENSION_AMD_LOADER) && (version_major == 1);
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_system_get_major_extension_table(uint16_t extension, uint16_t version_major,
+                                                  size_t table_length, void* table) {
+  if ((extension != HSA_EXTENSION_AMD_LOADER) || (version_major != 1) || (table == nullptr)) {
+    return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+  // The older versions of the table are the prefixes of the latest one
+  hsa_ven_amd_loader_1_03_pfn_t loader = {};
+  loader.hsa_ven_amd_loader_query_host_address = LoaderQueryHostAddress;
+  loader.hsa_ven_amd_loader_executable_iterate_loaded_code_objects =
+      LoaderIterateLoadedCodeObjects;
+  loader.hsa_ven_amd_loader_loaded_code_object_get_info = LoaderLoadedCodeObjectGetInfo;
+  loader.hsa_ven_amd_loader_iterate_executables = LoaderIterateExecutables;
+  memset(table, 0, table_length);
+  memcpy(table, &loader, std::min(table_length, sizeof(loader)));
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_amd_enable_logging(uint8_t* flags, void* file) { return HSA_STATUS_SUCCESS; }
+
+// ================================================================================================
+// Agents
+// ================================================================================================
+hsa_status_t hsa_iterate_agents(hsa_status_t (*callback)(hsa_agent_t agent, void* data),
+                                void* data) {
+  for (const auto& agent : runtime->agents_) {
+    hsa_status_t status = callback({reinterpret_cast<uint64_t>(agent.get())}, data);
+    if (status == HSA_STATUS_INFO_BREAK) {
+      break;
+    } else if (status != HSA_STATUS_SUCCESS) {
+      return status;
+    }
+  }
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_agent_get_info(hsa_agent_t agent, hsa_agent_info_t attribute, void* value) {
+  Agent* mock = ToAgent(agent);
+  if ((mock == nullptr) || (value == nullptr)) {
+    return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+  return (mock->type_ == HSA_DEVICE_TYPE_GPU) ? GetGpuAgentInfo(mock, attribute, value)
+                                              : GetCpuAgentInfo(mock, attribute, value);
+}
+
+hsa_status_t hsa_agent_extension_supported(uint16_t extension, hsa_agent_t agent,
+                                           uint16_t version_major, uint16_t version_minor,
+                                           bool* result) {
+  *result = false;
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_agent_iterate_isas(hsa_agent_t agent,
+                                    hsa_status_t (*callback)(hsa_isa_t isa, void* data),
+                                    void* data) {
+  Agent* mock = ToAgent(agent);
+  if (mock->type_ != HSA_DEVICE_TYPE_GPU) {
+    return HSA_STATUS_SUCCESS;
+  }
+  hsa_status_t status = callback({reinterpret_cast<uint64_t>(&mock->isa_)}, data);
+  return (status == HSA_STATUS_INFO_BREAK) ? HSA_STATUS_SUCCESS : status;
+}
+
+hsa_status_t hsa_isa_get_info_alt(hsa_isa_t isa, hsa_isa_info_t attribute, void* value) {
+  const Isa* mock = reinterpret_cast<const Isa*>(isa.handle);
+  switch (attribute) {
+    case HSA_ISA_INFO_NAME_LENGTH:
+      return SetInfo(value, static_cast<uint32_t>(mock->name_.size() + 1));
+    case HSA_ISA_INFO_NAME:
+      memcpy(value, mock->name_.c_str(), mock->name_.size() + 1);
+      return HSA_STATUS_SUCCESS;
+    default:
+      return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+}
+
+hsa_status_t hsa_amd_coherency_set_type(hsa_agent_t agent, hsa_amd_coherency_type_t type) {
+  return HSA_STATUS_SUCCESS;
+}
+
+// ================================================================================================
+// Signals
+// ================================================================================================
+hsa_status_t hsa_amd_signal_create(hsa_signal_value_t initial_value, uint32_t num_consumers,
+                                   const hsa_agent_t* consumers, uint64_t attributes,
+                                   hsa_signal_t* signal) {
+  if (signal == nullptr) {
+    return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+  signal->handle = reinterpret_cast<uint64_t>(new Signal(initial_value));
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_signal_create(hsa_signal_value_t initial_value, uint32_t num_consumers,
+                               const hsa_agent_t* consumers, hsa_signal_t* signal) {
+  return hsa_amd_signal_create(initial_value, num_consumers, consumers, 0, signal);
+}
+
+hsa_status_t hsa_signal_destroy(hsa_signal_t signal) {
+  if (signal.handle == 0) {
+    return HSA_STATUS_ERROR_INVALID_SIGNAL;
+  }
+  delete ToSignal(signal);
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_signal_value_t hsa_signal_load_relaxed(hsa_signal_t signal) {
+  return ToSignal(signal)->Load();
+}
+
+hsa_signal_value_t hsa_signal_load_scacquire(hsa_signal_t signal) {
+  return ToSignal(signal)->Load();
+}
+
+void hsa_signal_store_relaxed(hsa_signal_t signal, hsa_signal_value_t value) {
+  ToSignal(signal)->Store(value);
+}
+
+void hsa_signal_store_screlease(hsa_signal_t signal, hsa_signal_value_t value) {
+  ToSignal(signal)->Store(value);
+}
+
+void hsa_signal_silent_store_relaxed(hsa_signal_t signal, hsa_signal_value_t value) {
+  // A silent store doesn't wake the waiters
+  __atomic_store_n(&ToSignal(signal)->amd_.value, value, __ATOMIC_RELAXED);
+}
+
+void hsa_signal_add_relaxed(hsa_signal_t signal, hsa_signal_value_t value) {
+  ToSignal(signal)->Add(value);
+}
+
+void hsa_signal_subtract_relaxed(hsa_signal_t signal, hsa_signal_value_t value) {
+  ToSignal(signal)->Add(-value);
+}
+
+hsa_signal_value_t hsa_signal_wait_scacquire(hsa_signal_t signal,
+                                             hsa_signal_condition_t condition,
+                                             hsa_signal_value_t compare_value,
+                                             uint64_t timeout_hint,
+                                             hsa_wait_state_t wait_state_hint) {
+  Signal* mock = ToSignal(signal);
+  int64_t value = mock->Load();
+  // An active wait spins up to the timeout, but not longer than a cross process waiter
+  const uint64_t spin_ns = (wait_state_hint == HSA_WAIT_STATE_ACTIVE) ?
+      std::min(timeout_hint, static_cast<uint64_t>(DEBUG_CLR_SHARED_WAIT_SPIN) * 1000) : 0;
+  mock->Wait([&]() {
+    value = mock->Load();
+    return Satisfied(condition, value, compare_value);
+  }, Deadline(timeout_hint), spin_ns);
+  return value;
+}
+
+hsa_status_t hsa_amd_signal_value_pointer(hsa_signal_t signal,
+                                          volatile hsa_signal_value_t** value_ptr) {
+  *value_ptr = &ToSignal(signal)->amd_.value;
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_amd_signal_async_handler(hsa_signal_t signal, hsa_signal_condition_t cond,
+                                          hsa_signal_value_t value,
+                                          hsa_amd_signal_handler handler, void* arg) {
+  if ((signal.handle == 0) || (handler == nullptr)) {
+    return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+  runtime->AddHandler({ToSignal(signal), cond, value, handler, arg});
+  return HSA_STATUS_SUCCESS;
+}
+
+// ================================================================================================
+// Queues
+// ================================================================================================
+hsa_status_t hsa_queue_create(hsa_agent_t agent, uint32_t size, hsa_queue_type32_t type,
+                              void (*callback)(hsa_status_t status, hsa_queue_t* source,
+                                               void* data),
+                              void* data, uint32_t private_segment_size,
+                              uint32_t group_segment_size, hsa_queue_t** queue) {
+  if ((ToAgent(agent)->type_ != HSA_DEVICE_TYPE_GPU) || (queue == nullptr) ||
+      (size == 0) || !amd::isPowerOfTwo(size) || (size > kMaxQueueSize)) {
+    return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+  Queue* mock = new Queue;
+  void* ring = AlignedAlloc(size * kPacketSize, kAllocGranule);
+  if (ring == nullptr) {
+    delete mock;
+    return HSA_STATUS_ERROR_OUT_OF_RESOURCES;
+  }
+  // All packets start invalid, so the worker can't process a slot before it's published
+  for (uint32_t i = 0; i < size; ++i) {
+    auto header = reinterpret_cast<uint16_t*>(reinterpret_cast<uint8_t*>(ring) + i * kPacketSize);
+    *header = HSA_PACKET_TYPE_INVALID << HSA_PACKET_HEADER_TYPE;
+  }
+  mock->doorbell_ = new Signal(0);
+  memset(&mock->hsa_, 0, sizeof(mock->hsa_));
+  mock->hsa_.type = type;
+  mock->hsa_.features = HSA_QUEUE_FEATURE_KERNEL_DISPATCH | HSA_QUEUE_FEATURE_AGENT_DISPATCH;
+  mock->hsa_.base_address = ring;
+  mock->hsa_.doorbell_signal.handle = reinterpret_cast<uint64_t>(mock->doorbell_);
+  mock->hsa_.size = size;
+  mock->hsa_.id = queue_id++;
+  mock->write_index_.store(0);
+  mock->read_index_.store(0);
+  mock->exit_.store(false);
+  mock->worker_ = std::thread([mock]() { mock->Run(); });
+  *queue = &mock->hsa_;
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_queue_destroy(hsa_queue_t* queue) {
+  if (queue == nullptr) {
+    return HSA_STATUS_ERROR_INVALID_QUEUE;
+  }
+  Queue* mock = ToQueue(queue);
+  mock->exit_.store(true);
+  mock->doorbell_->Notify();
+  mock->worker_.join();
+  free(mock->hsa_.base_address);
+  delete mock->doorbell_;
+  delete mock;
+  return HSA_STATUS_SUCCESS;
+}
+
+uint64_t hsa_queue_load_read_index_relaxed(const hsa_queue_t* queue) {
+  return ToQueue(queue)->read_index_.load(std::memory_order_relaxed);
+}
+
+uint64_t hsa_queue_load_read_index_scacquire(const hsa_queue_t* queue) {
+  return ToQueue(queue)->read_index_.load(std::memory_order_acquire);
+}
+
+uint64_t hsa_queue_load_write_index_relaxed(const hsa_queue_t* queue) {
+  return ToQueue(queue)->write_index_.load(std::memory_order_relaxed);
+}
+
+uint64_t hsa_queue_add_write_index_screlease(const hsa_queue_t* queue, uint64_t value) {
+  return ToQueue(queue)->write_index_.fetch_add(value, std::memory_order_release);
+}
+
+hsa_status_t hsa_amd_queue_cu_set_mask(const hsa_queue_t* queue, uint32_t num_cu_mask_count,
+                                       const uint32_t* cu_mask) {
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_amd_queue_set_priority(hsa_queue_t* queue, hsa_amd_queue_priority_t priority) {
+  return HSA_STATUS_SUCCESS;
+}
+
+// ================================================================================================
+// Profiling
+// ================================================================================================
+hsa_status_t hsa_amd_profiling_set_profiler_enabled(hsa_queue_t* queue, int enable) {
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_amd_profiling_async_copy_enable(bool enable) { return HSA_STATUS_SUCCESS; }
+
+hsa_status_t hsa_amd_profiling_get_dispatch_time(hsa_agent_t agent, hsa_signal_t signal,
+                                                 hsa_amd_profiling_dispatch_time_t* time) {
+  time->start = ToSignal(signal)->amd_.start_ts;
+  time->end = ToSignal(signal)->amd_.end_ts;
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_amd_profiling_get_async_copy_time(hsa_signal_t signal,
+                                                   hsa_amd_profiling_async_copy_time_t* time) {
+  time->start = ToSignal(signal)->amd_.start_ts;
+  time->end = ToSignal(signal)->amd_.end_ts;
+  return HSA_STATUS_SUCCESS;
+}
+
+// ================================================================================================
+// Memory
+// ================================================================================================
+hsa_status_t hsa_amd_agent_iterate_memory_pools(
+    hsa_agent_t agent, hsa_status_t (*callback)(hsa_amd_memory_pool_t memory_pool, void* data),
+    void* data) {
+  for (const auto& pool : ToAgent(agent)->pools_) {
+    hsa_status_t status = callback({reinterpret_cast<uint64_t>(pool.get())}, data);
+    if (status == HSA_STATUS_INFO_BREAK) {
+      break;
+    } else if (status != HSA_STATUS_SUCCESS) {
+      return status;
+    }
+  }
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_amd_memory_pool_get_info(hsa_amd_memory_pool_t memory_pool,
+                                          hsa_amd_memory_pool_info_t attribute, void* value) {
+  Pool* pool = ToPool(memory_pool);
+  const bool global = (pool->segment_ == HSA_AMD_SEGMENT_GLOBAL);
+  switch (attribute) {
+    case HSA_AMD_MEMORY_POOL_INFO_SEGMENT:
+      return SetInfo(value, pool->segment_);
+    case HSA_AMD_MEMORY_POOL_INFO_GLOBAL_FLAGS:
+      return SetInfo(value, pool->flags_);
+    case HSA_AMD_MEMORY_POOL_INFO_SIZE:
+      return SetInfo(value, pool->size_);
+    case HSA_AMD_MEMORY_POOL_INFO_RUNTIME_ALLOC_ALLOWED:
+      return SetInfo(value, global);
+    case HSA_AMD_MEMORY_POOL_INFO_RUNTIME_ALLOC_GRANULE:
+    case HSA_AMD_MEMORY_POOL_INFO_RUNTIME_ALLOC_ALIGNMENT:
+      return SetInfo(value, global ? kAllocGranule : size_t{0});
+    case HSA_AMD_MEMORY_POOL_INFO_ACCESSIBLE_BY_ALL:
+      return SetInfo(value, global);
+    default:
+      return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+}
+
+hsa_status_t hsa_amd_agent_memory_pool_get_info(hsa_agent_t agent,
+                                                hsa_amd_memory_pool_t memory_pool,
+                                                hsa_amd_agent_memory_pool_info_t attribute,
+                                                void* value) {
+  Agent* mock = ToAgent(agent);
+  Pool* pool = ToPool(memory_pool);
+  switch (attribute) {
+    case HSA_AMD_AGENT_MEMORY_POOL_INFO_ACCESS:
+      // The device memory is host memory, so it's always accessible like a large BAR
+      if (pool->segment_ != HSA_AMD_SEGMENT_GLOBAL) {
+        return SetInfo(value, (mock == pool->owner_) ? HSA_AMD_MEMORY_POOL_ACCESS_ALLOWED_BY_DEFAULT
+                                                     : HSA_AMD_MEMORY_POOL_ACCESS_NEVER_ALLOWED);
+      }
+      return SetInfo(value, ((mock == pool->owner_) ||
+                             (pool->owner_->type_ == HSA_DEVICE_TYPE_CPU)) ?
+                     HSA_AMD_MEMORY_POOL_ACCESS_ALLOWED_BY_DEFAULT :
+                     HSA_AMD_MEMORY_POOL_ACCESS_DISALLOWED_BY_DEFAULT);
+    case HSA_AMD_AGENT_MEMORY_POOL_INFO_NUM_LINK_HOPS:
+      return SetInfo(value, (mock == pool->owner_) ? 0u : 1u);
+    case HSA_AMD_AGENT_MEMORY_POOL_INFO_LINK_INFO: {
+      hsa_amd_memory_pool_link_info_t link = {};
+      link.link_type = HSA_AMD_LINK_INFO_TYPE_PCIE;
+      link.numa_distance = (mock == pool->owner_) ? 0 : 20;
+      return SetInfo(value, link);
+    }
+    default:
+      return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+}
+
+hsa_status_t hsa_amd_memory_pool_allocate(hsa_amd_memory_pool_t memory_pool, size_t size,
+                                          uint32_t flags, void** ptr) {
+  Pool* pool = ToPool(memory_pool);
+  if ((size == 0) || (ptr == nullptr) || (pool->segment_ != HSA_AMD_SEGMENT_GLOBAL)) {
+    return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+  size = amd::alignUp(size, kAllocGranule);
+  if (pool->allocated_.fetch_add(size) + size > pool->size_) {
+    pool->allocated_.fetch_sub(size);
+    return HSA_STATUS_ERROR_OUT_OF_RESOURCES;
+  }
+  *ptr = AlignedAlloc(size, kAllocGranule);
+  if (*ptr == nullptr) {
+    pool->allocated_.fetch_sub(size);
+    return HSA_STATUS_ERROR_OUT_OF_RESOURCES;
+  }
+  std::lock_guard<std::mutex> lock(runtime->memory_lock_);
+  runtime->allocations_[reinterpret_cast<uintptr_t>(*ptr)] = {size, pool, HSA_EXT_POINTER_TYPE_HSA};
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_amd_memory_pool_free(void* ptr) {
+  std::lock_guard<std::mutex> lock(runtime->memory_lock_);
+  auto it = runtime->allocations_.find(reinterpret_cast<uintptr_t>(ptr));
+  if ((it == runtime->allocations_.end()) || (it->second.pool_ == nullptr)) {
+    return HSA_STATUS_ERROR_INVALID_ALLOCATION;
+  }
+  it->second.pool_->allocated_.fetch_sub(it->second.size_);
+  runtime->allocations_.erase(it);
+  free(ptr);
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_amd_agents_allow_access(uint32_t num_agents, const hsa_agent_t* agents,
+                                         const uint32_t* flags, const void* ptr) {
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_amd_memory_lock_to_pool(void* host_ptr, size_t size, hsa_agent_t* agents,
+                                         int num_agent, hsa_amd_memory_pool_t pool,
+                                         uint32_t flags, void** agent_ptr) {
+  if ((host_ptr == nullptr) || (size == 0) || (agent_ptr == nullptr)) {
+    return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+  std::lock_guard<std::mutex> lock(runtime->memory_lock_);
+  runtime->allocations_[reinterpret_cast<uintptr_t>(host_ptr)] =
+      {size, nullptr, HSA_EXT_POINTER_TYPE_LOCKED};
+  *agent_ptr = host_ptr;
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_amd_memory_unlock(void* host_ptr) {
+  std::lock_guard<std::mutex> lock(runtime->memory_lock_);
+  auto it = runtime->allocations_.find(reinterpret_cast<uintptr_t>(host_ptr));
+  if ((it != runtime->allocations_.end()) && (it->second.pool_ == nullptr)) {
+    runtime->allocations_.erase(it);
+  }
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_memory_register(void* ptr, size_t size) { return HSA_STATUS_SUCCESS; }
+
+hsa_status_t hsa_memory_deregister(void* ptr, size_t size) { return HSA_STATUS_SUCCESS; }
+
+hsa_status_t hsa_memory_copy(void* dst, const void* src, size_t size) {
+  memcpy(dst, src, size);
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_amd_pointer_info(const void* ptr, hsa_amd_pointer_info_t* info,
+                                  void* (*alloc)(size_t), uint32_t* num_agents_accessible,
+                                  hsa_agent_t** accessible) {
+  if (info == nullptr) {
+    return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+  info->type = HSA_EXT_POINTER_TYPE_UNKNOWN;
+  {
+    std::lock_guard<std::mutex> lock(runtime->memory_lock_);
+    auto it = runtime->FindAllocation(ptr);
+    if (it != runtime->allocations_.end()) {
+      info->type = it->second.type_;
+      info->agentBaseAddress = reinterpret_cast<void*>(it->first);
+      info->hostBaseAddress = info->agentBaseAddress;
+      info->sizeInBytes = it->second.size_;
+      info->userData = nullptr;
+      Agent* owner = (it->second.pool_ != nullptr) ? it->second.pool_->owner_
+                                                   : runtime->agents_[0].get();
+      info->agentOwner.handle = reinterpret_cast<uint64_t>(owner);
+    }
+  }
+  if ((num_agents_accessible != nullptr) && (accessible != nullptr) && (alloc != nullptr)) {
+    // All memory is accessible by all agents
+    *num_agents_accessible = 0;
+    *accessible = nullptr;
+    if (info->type != HSA_EXT_POINTER_TYPE_UNKNOWN) {
+      *accessible =
+          reinterpret_cast<hsa_agent_t*>(alloc(sizeof(hsa_agent_t) * runtime->agents_.size()));
+      for (const auto& agent : runtime->agents_) {
+        (*accessible)[(*num_agents_accessible)++].handle =
+            reinterpret_cast<uint64_t>(agent.get());
+      }
+    }
+  }
+  return HSA_STATUS_SUCCESS;
+}
+
+// ================================================================================================
+// Copy engine
+// ================================================================================================
+hsa_status_t hsa_amd_memory_async_copy(void* dst, hsa_agent_t dst_agent, const void* src,
+                                       hsa_agent_t src_agent, size_t size,
+                                       uint32_t num_dep_signals, const hsa_signal_t* dep_signals,
+                                       hsa_signal_t completion_signal) {
+  if ((dst == nullptr) || (src == nullptr) ||
+      ((num_dep_signals != 0) && (dep_signals == nullptr))) {
+    return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+  CopyJob job;
+  job.deps_.assign(dep_signals, dep_signals + num_dep_signals);
+  job.copy_ = [dst, src, size]() { memmove(dst, src, size); };
+  job.completion_ = completion_signal;
+  runtime->AddCopy(std::move(job));
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_amd_memory_async_copy_on_engine(void* dst, hsa_agent_t dst_agent,
+                                                 const void* src, hsa_agent_t src_agent,
+                                                 size_t size, uint32_t num_dep_signals,
+                                                 const hsa_signal_t* dep_signals,
+                                                 hsa_signal_t completion_signal,
+                                                 hsa_amd_sdma_engine_id_t engine_id,
+                                                 bool force_copy_on_sdma) {
+  return hsa_amd_memory_async_copy(dst, dst_agent, src, src_agent, size, num_dep_signals,
+                                   dep_signals, completion_signal);
+}
+
+hsa_status_t hsa_amd_memory_async_copy_rect(const hsa_pitched_ptr_t* dst,
+                                            const hsa_dim3_t* dst_offset,
+                                            const hsa_pitched_ptr_t* src,
+                                            const hsa_dim3_t* src_offset, const hsa_dim3_t* range,
+                                            hsa_agent_t copy_agent, hsa_amd_copy_direction_t dir,
+                                            uint32_t num_dep_signals,
+                                            const hsa_signal_t* dep_signals,
+                                            hsa_signal_t completion_signal) {
+  if ((dst == nullptr) || (src == nullptr) || (range == nullptr) ||
+      ((num_dep_signals != 0) && (dep_signals == nullptr))) {
+    return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+  CopyJob job;
+  job.deps_.assign(dep_signals, dep_signals + num_dep_signals);
+  job.copy_ = [dst = *dst, dst_offset = *dst_offset, src = *src, src_offset = *src_offset,
+               range = *range]() {
+    // The offset and the range are in bytes for x, in rows for y and in slices for z
+    for (uint32_t z = 0; z < range.z; ++z) {
+      for (uint32_t y = 0; y < range.y; ++y) {
+        memcpy(reinterpret_cast<char*>(dst.base) + (dst_offset.z + z) * dst.slice +
+                   (dst_offset.y + y) * dst.pitch + dst_offset.x,
+               reinterpret_cast<const char*>(src.base) + (src_offset.z + z) * src.slice +
+                   (src_offset.y + y) * src.pitch + src_offset.x,
+               range.x);
+      }
+    }
+  };
+  job.completion_ = completion_signal;
+  runtime->AddCopy(std::move(job));
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_amd_memory_copy_engine_status(hsa_agent_t dst_agent, hsa_agent_t src_agent,
+                                               uint32_t* engine_ids_mask) {
+  *engine_ids_mask = HSA_AMD_SDMA_ENGINE_0 | HSA_AMD_SDMA_ENGINE_1;
+  return HSA_STATUS_SUCCESS;
+}
+
+// ================================================================================================
+// Code objects
+// ================================================================================================
+hsa_status_t hsa_code_object_reader_create_from_memory(
+    const void* code_object, size_t size, hsa_code_object_reader_t* code_object_reader) {
+  if ((code_object == nullptr) || (size == 0) || (code_object_reader == nullptr)) {
+    return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+  code_object_reader->handle =
+      reinterpret_cast<uint64_t>(new CodeObjectReader{code_object, size});
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_code_object_reader_destroy(hsa_code_object_reader_t code_object_reader) {
+  delete reinterpret_cast<CodeObjectReader*>(code_object_reader.handle);
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_executable_create_alt(
+    hsa_profile_t profile, hsa_default_float_rounding_mode_t default_float_rounding_mode,
+    const char* options, hsa_executable_t* executable) {
+  Executable* mock = new Executable;
+  {
+    std::lock_guard<std::mutex> lock(runtime->executable_lock_);
+    runtime->executables_.push_back(mock);
+  }
+  executable->handle = reinterpret_cast<uint64_t>(mock);
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_executable_destroy(hsa_executable_t executable) {
+  Executable* mock = ToExecutable(executable);
+  {
+    std::lock_guard<std::mutex> lock(runtime->executable_lock_);
+    auto& executables = runtime->executables_;
+    executables.erase(std::remove(executables.begin(), executables.end(), mock),
+                      executables.end());
+  }
+  {
+    std::lock_guard<std::mutex> lock(runtime->memory_lock_);
+    for (const auto& code_object : mock->code_objects_) {
+      runtime->allocations_.erase(reinterpret_cast<uintptr_t>(code_object->base_));
+      free(code_object->base_);
+    }
+  }
+  delete mock;
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_executable_load_agent_code_object(hsa_executable_t executable, hsa_agent_t agent,
+                                                   hsa_code_object_reader_t code_object_reader,
+                                                   const char* options,
+                                                   hsa_loaded_code_object_t* loaded_code_object) {
+  Executable* mock = ToExecutable(executable);
+  if ((mock->state_ == HSA_EXECUTABLE_STATE_FROZEN) || (code_object_reader.handle == 0)) {
+    return HSA_STATUS_ERROR_FROZEN_EXECUTABLE;
+  }
+  return LoadCodeObject(mock, ToAgent(agent),
+                        reinterpret_cast<const CodeObjectReader*>(code_object_reader.handle),
+                        loaded_code_object);
+}
+
+hsa_status_t hsa_executable_freeze(hsa_executable_t executable, const char* options) {
+  ToExecutable(executable)->state_ = HSA_EXECUTABLE_STATE_FROZEN;
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_executable_get_info(hsa_executable_t executable,
+                                     hsa_executable_info_t attribute, void* value) {
+  switch (attribute) {
+    case HSA_EXECUTABLE_INFO_PROFILE:
+      return SetInfo(value, HSA_PROFILE_FULL);
+    case HSA_EXECUTABLE_INFO_STATE:
+      return SetInfo(value, ToExecutable(executable)->state_);
+    default:
+      return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+}
+
+hsa_status_t hsa_executable_agent_global_variable_define(hsa_executable_t executable,
+                                                         hsa_agent_t agent,
+                                                         const char* variable_name,
+                                                         void* address) {
+  Executable* mock = ToExecutable(executable);
+  if (mock->state_ == HSA_EXECUTABLE_STATE_FROZEN) {
+    return HSA_STATUS_ERROR_FROZEN_EXECUTABLE;
+  }
+  std::unique_ptr<Symbol> symbol(new Symbol);
+  symbol->name_ = variable_name;
+  symbol->kind_ = HSA_SYMBOL_KIND_VARIABLE;
+  symbol->agent_ = ToAgent(agent);
+  symbol->address_ = reinterpret_cast<uint64_t>(address);
+  symbol->size_ = 0;
+  symbol->is_const_ = false;
+  symbol->dynamic_callstack_ = false;
+  mock->symbols_.push_back(std::move(symbol));
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_executable_get_symbol_by_name(hsa_executable_t executable,
+                                               const char* symbol_name, const hsa_agent_t* agent,
+                                               hsa_executable_symbol_t* symbol) {
+  for (const auto& mock : ToExecutable(executable)->symbols_) {
+    if ((mock->name_ == symbol_name) &&
+        ((agent == nullptr) || (mock->agent_ == ToAgent(*agent)))) {
+      symbol->handle = reinterpret_cast<uint64_t>(mock.get());
+      return HSA_STATUS_SUCCESS;
+    }
+  }
+  return HSA_STATUS_ERROR_INVALID_SYMBOL_NAME;
+}
+
+hsa_status_t hsa_executable_iterate_symbols(
+    hsa_executable_t executable,
+    hsa_status_t (*callback)(hsa_executable_t exec, hsa_executable_symbol_t symbol, void* data),
+    void* data) {
+  for (const auto& mock : ToExecutable(executable)->symbols_) {
+    hsa_status_t status = callback(executable, {reinterpret_cast<uint64_t>(mock.get())}, data);
+    if (status != HSA_STATUS_SUCCESS) {
+      return status;
+    }
+  }
+  return HSA_STATUS_SUCCESS;
+}
+
+hsa_status_t hsa_executable_symbol_get_info(hsa_executable_symbol_t executable_symbol,
+                                            hsa_executable_symbol_info_t attribute,
+                                            void* value) {
+  const Symbol* symbol = reinterpret_cast<const Symbol*>(executable_symbol.handle);
+  switch (attribute) {
+    case HSA_EXECUTABLE_SYMBOL_INFO_TYPE:
+      return SetInfo(value, symbol->kind_);
+    case HSA_EXECUTABLE_SYMBOL_INFO_NAME_LENGTH:
+      return SetInfo(value, static_cast<uint32_t>(symbol->name_.size()));
+    case HSA_EXECUTABLE_SYMBOL_INFO_NAME:
+      memcpy(value, symbol->name_.data(), symbol->name_.size());
+      return HSA_STATUS_SUCCESS;
+    case HSA_EXECUTABLE_SYMBOL_INFO_AGENT:
+      return SetInfo(value, hsa_agent_t{reinterpret_cast<uint64_t>(symbol->agent_)});
+    case HSA_EXECUTABLE_SYMBOL_INFO_KERNEL_OBJECT:
+      return SetInfo(value, symbol->address_);
+    case HSA_EXECUTABLE_SYMBOL_INFO_KERNEL_DYNAMIC_CALLSTACK:
+      return SetInfo(value, symbol->dynamic_callstack_);
+    case HSA_EXECUTABLE_SYMBOL_INFO_VARIABLE_ADDRESS:
+      return SetInfo(value, symbol->address_);
+    case HSA_EXECUTABLE_SYMBOL_INFO_VARIABLE_SIZE:
+      return SetInfo(value, symbol->size_);
+    case HSA_EXECUTABLE_SYMBOL_INFO_VARIABLE_IS_CONST:
+      return SetInfo(value, symbol->is_const_);
+    default:
+      return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+  }
+}
+
+// ================================================================================================
+// Not simulated: images, samplers, IPC, interop, SVM and the virtual memory API.
+// The agents report no image support and the system reports no SVM and virtual memory support,
+// so the runtime doesn't call most of them.
+// ================================================================================================
+hsa_status_t hsa_amd_image_create(hsa_agent_t agent,
+                                  const hsa_ext_image_descriptor_t* image_descriptor,
+                                  const hsa_amd_image_descriptor_t* image_layout,
+                                  const void* image_data, hsa_access_permission_t access_permission,
+                                  hsa_ext_image_t* image) {
+  return HSA_STATUS_ERROR_INVALID_AGENT;
+}
+
+hsa_status_t hsa_ext_image_create(hsa_agent_t agent,
+                                  const hsa_ext_image_descriptor_t* image_descriptor,
+                                  const void* image_data, hsa_access_permission_t access_permission,
+                                  hsa_ext_image_t* image) {
+  return HSA_STATUS_ERROR_INVALID_AGENT;
+}
+
+hsa_status_t hsa_ext_image_create_with_layout(
+    hsa_agent_t agent, const hsa_ext_image_descriptor_t* image_descriptor,
+    const void* image_data, hsa_access_permission_t access_permission,
+    hsa_ext_image_data_layout_t image_data_layout, size_t image_data_row_pitch,
+    size_t image_data_slice_pitch, hsa_ext_image_t* image) {
+  return HSA_STATUS_ERROR_INVALID_AGENT;
+}
+
+hsa_status_t hsa_ext_image_data_get_info(hsa_agent_t agent,
+                                         const hsa_ext_image_descriptor_t* image_descriptor,
+                                         hsa_access_permission_t access_permission,
+                                         hsa_ext_image_data_info_t* image_data_info) {
+  return HSA_STATUS_ERROR_INVALID_AGENT;
+}
+
+hsa_status_t hsa_ext_image_destroy(hsa_agent_t agent, hsa_ext_image_t image) {
+  return HSA_STATUS_ERROR_INVALID_AGENT;
+}
+
+hsa_status_t hsa_ext_image_export(hsa_agent_t agent, hsa_ext_image_t src_image, void* dst_memory,
+                                  size_t dst_row_pitch, size_t dst_slice_pitch,
+                                  const hsa_ext_image_region_t* image_region) {
+  return HSA_STATUS_ERROR_INVALID_AGENT;
+}
+
+hsa_status_t hsa_ext_image_import(hsa_agent_t agent, const void* src_memory, size_t src_row_pitch,
+                                  size_t src_slice_pitch, hsa_ext_image_t dst_image,
+                                  const hsa_ext_image_region_t* image_region) {
+  return HSA_STATUS_ERROR_INVALID_AGENT;
+}
+
+hsa_status_t hsa_ext_sampler_create_v2(hsa_agent_t agent,
+                                       const hsa_ext_sampler_descriptor_v2_t* sampler_descriptor,
+                                       hsa_ext_sampler_t* sampler) {
+  return HSA_STATUS_ERROR_INVALID_AGENT;
+}
+
+hsa_status_t hsa_ext_sampler_destroy(hsa_agent_t agent, hsa_ext_sampler_t sampler) {
+  return HSA_STATUS_ERROR_INVALID_AGENT;
+}
+
+hsa_status_t hsa_amd_ipc_memory_create(void* ptr, size_t len, hsa_amd_ipc_memory_t* handle) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_ipc_memory_attach(const hsa_amd_ipc_memory_t* handle, size_t len,
+                                       uint32_t num_agents, const hsa_agent_t* mapping_agents,
+                                       void** mapped_ptr) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_ipc_memory_detach(void* mapped_ptr) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_interop_map_buffer(uint32_t num_agents, hsa_agent_t* agents,
+                                        int interop_handle, uint32_t flags, size_t* size,
+                                        void** ptr, size_t* metadata_size,
+                                        const void** metadata) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_interop_unmap_buffer(void* ptr) { return HSA_STATUS_ERROR_INVALID_ARGUMENT; }
+
+hsa_status_t hsa_amd_svm_attributes_set(void* ptr, size_t size,
+                                        hsa_amd_svm_attribute_pair_t* attribute_list,
+                                        size_t attribute_count) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_svm_attributes_get(void* ptr, size_t size,
+                                        hsa_amd_svm_attribute_pair_t* attribute_list,
+                                        size_t attribute_count) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_svm_prefetch_async(void* ptr, size_t size, hsa_agent_t agent,
+                                        uint32_t num_dep_signals, const hsa_signal_t* dep_signals,
+                                        hsa_signal_t completion_signal) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_vmem_address_reserve(void** va, size_t size, uint64_t address,
+                                          uint64_t flags) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_vmem_address_free(void* va, size_t size) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_vmem_handle_create(hsa_amd_memory_pool_t pool, size_t size,
+                                        hsa_amd_memory_type_t type, uint64_t flags,
+                                        hsa_amd_vmem_alloc_handle_t* memory_handle) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_vmem_handle_release(hsa_amd_vmem_alloc_handle_t memory_handle) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_vmem_map(void* va, size_t size, size_t in_offset,
+                              hsa_amd_vmem_alloc_handle_t memory_handle, uint64_t flags) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_vmem_unmap(void* va, size_t size) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_vmem_set_access(void* va, size_t size,
+                                     const hsa_amd_memory_access_desc_t* desc,
+                                     size_t desc_cnt) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_vmem_get_access(void* va, hsa_access_permission_t* perms,
+                                     hsa_agent_t agent_handle) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_vmem_export_shareable_handle(int* dmabuf_fd,
+                                                  hsa_amd_vmem_alloc_handle_t handle,
+                                                  uint64_t flags) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+hsa_status_t hsa_amd_vmem_import_shareable_handle(int dmabuf_fd,
+                                                  hsa_amd_vmem_alloc_handle_t* handle) {
+  return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+}
+
+}  // extern "C"
@@ -592,15 +592,27 @@ bool DmaBlitManager::hsaCopyStaged(const_address hostSrc, address hostDst, size_
   size_t totalSize = size;
   size_t stagedCopyOffset = 0;
   bool status = true;
-  Memory* xferBuf = nullptr;
   address stagingBuffer = 0;
   size_t maxStagedXferSize = dev().settings().stagedXferSize_;
+  VirtualGPU::StagingRing& readStaging = gpu().ReadStaging();
+
+  // D2H chunk in flight on GPU. CPU copies it to the unpinned buffer while GPU fills the next one
+  ProfilingSignal* pendingSignal = nullptr;
+  address pendingBuffer = nullptr;
+  size_t pendingOffset = 0;
+  size_t pendingSize = 0;
+  auto drainPending = [&]() {
+    bool result = readStaging.Wait(pendingSignal);
+    pendingSignal->release();
+    pendingSignal = nullptr;
+    if (result) {
+      memcpy(hostDst + pendingOffset, pendingBuffer, pendingSize);
+    }
+    return result;
+  };
 
   if (!hostToDev) {
-    // Get static staging buffer as we need to wait until copy on GPU completes to copy
-    // it back to the unpinned buffer
-    xferBuf = &dev().xferRead().acquire();
-    stagingBuffer = xferBuf->getDeviceMemory();
+    readStaging.Begin();
   }
 
   // Allocate requested size of memory
@@ -629,15 +641,31 @@ bool DmaBlitManager::hsaCopyStaged(const_address hostSrc, address hostDst, size_
       dstAgent = dev().getCpuAgent();
       srcAgent = dev().getBackendDevice();
 
+      // The ring has a buffer for the pending chunk and the current one, the chunk before the
+      // pending one was already drained
+      stagingBuffer = readStaging.Acquire();
+      if (stagingBuffer == nullptr) {
+        status = false;
+        break;
+      }
       const_address src = static_cast<const_address>(hostSrc) + stagedCopyOffset;
       ClPrint(amd::LOG_DEBUG, amd::LOG_COPY, "HSA Async Copy staged D2H");
       status = rocrCopyBuffer(stagingBuffer, dstAgent, src, srcAgent, size, copyMetadata);
-      if (status) {
-        gpu().Barriers().WaitCurrent();
-        memcpy(hostDst + stagedCopyOffset, stagingBuffer, size);
-      } else {
+      if (!status) {
         break;
       }
+      ProfilingSignal* signal = gpu().Barriers().GetLastSignal();
+      // Keep the signal from the reuse until CPU drains the chunk
+      signal->retain();
+      if ((pendingSignal != nullptr) && !drainPending()) {
+        signal->release();
+        status = false;
+        break;
+      }
+      pendingSignal = signal;
+      pendingBuffer = stagingBuffer;
+      pendingOffset = stagedCopyOffset;
+      pendingSize = size;
     }
 
     totalSize -= size;
@@ -645,7 +673,11 @@ bool DmaBlitManager::hsaCopyStaged(const_address hostSrc, address hostDst, size_
   }
 
   if (!hostToDev) {
-    dev().xferRead().release(gpu(), *xferBuf);
+    // Drain the last chunk, even after a failure the buffer must be idle before the reuse
+    if ((pendingSignal != nullptr) && !drainPending()) {
+      status = false;
+    }
+    readStaging.End(stagedCopyOffset);
   }
 
   if (!status) {
@@ -1665,11 +1697,13 @@ bool KernelBlitManager::readBuffer(device::Memory& srcMemory, void* dstHost,
         size_t copySize = 0;
         size_t stagedCopyOffset = 0;
         size_t maxStagedXferSize = dev().settings().stagedXferSize_;
-        Memory& xferBuf = dev().xferRead().acquire();
-        address xferBufAddr = xferBuf.getDeviceMemory();
+        VirtualGPU::StagingRing& readStaging = gpu().ReadStaging();
+        readStaging.Begin();
+        address xferBufAddr = readStaging.Acquire();
+        result = (xferBufAddr != nullptr);
 
         constexpr bool kAttachSignal = true;
-        while (totalSize > 0) {
+        while (result && (totalSize > 0)) {
           copySize = std::min(totalSize, maxStagedXferSize);
           srcAddr += stagedCopyOffset;
           ClPrint(amd::LOG_DEBUG, amd::LOG_COPY, "Blit staging D2H copy stg buf=%p, src=%p, "
@@ -1685,7 +1719,7 @@ bool KernelBlitManager::readBuffer(device::Memory& srcMemory, void* dstHost,
             break;
           }
           // Wait on current signal of previous blit copy
-          gpu().Barriers().WaitCurrent();
+          readStaging.Wait(gpu().Barriers().GetLastSignal());
           ClPrint(amd::LOG_DEBUG, amd::LOG_COPY, "memcpy host dst=%p, stg buf=%p, size=%zu",
                   (void*)(dstAddr + stagedCopyOffset), xferBufAddr, copySize);
           memcpy(dstAddr + stagedCopyOffset, xferBufAddr, copySize);
@@ -1693,7 +1727,7 @@ bool KernelBlitManager::readBuffer(device::Memory& srcMemory, void* dstHost,
           stagedCopyOffset += copySize;
         }
 
-        dev().xferRead().release(gpu(), xferBuf);
+        readStaging.End(stagedCopyOffset);
       }
     }
   }
@@ -1955,66 +1989,84 @@ bool KernelBlitManager::fillBuffer1D(device::Memory& memory, const void* pattern
     synchronize();
     return result;
   } else {
-    // Pack the fill buffer info, that handles unaligned memories.
-    std::vector<FillBufferInfo> packed_vector{};
-    FillBufferInfo::PackInfo(memory, size[0], origin[0], pattern, patternSize, packed_vector);
-
-    size_t overall_offset = origin[0];
-    for (auto& packed_obj: packed_vector) {
-      constexpr uint32_t kFillType = FillBufferAligned;
-      uint32_t kpattern_size = (packed_obj.pattern_expanded_) ?
-                                HostBlitManager::FillBufferInfo::kExtendedSize : patternSize;
-      size_t kfill_size = packed_obj.fill_size_ / kpattern_size;
-      size_t koffset = overall_offset;
-      overall_offset += packed_obj.fill_size_;
-
-      size_t globalWorkOffset[3] = {0, 0, 0};
-      uint32_t alignment = (kpattern_size & 0xf) == 0 ? 2 * sizeof(uint64_t) :
-                           (kpattern_size & 0x7) == 0 ? sizeof(uint64_t) :
-                           (kpattern_size & 0x3) == 0 ? sizeof(uint32_t) :
-                           (kpattern_size & 0x1) == 0 ? sizeof(uint16_t) : sizeof(uint8_t);
-      // Program kernels arguments for the fill operation
-      cl_mem mem = as_cl<amd::Memory>(memory.owner());
-      setArgument(kernels_[kFillType], 0, sizeof(cl_mem), &mem, koffset);
-      const size_t localWorkSize = 256;
-      size_t globalWorkSize =
-          std::min(dev().settings().limit_blit_wg_ * localWorkSize, kfill_size);
-      globalWorkSize = amd::alignUp(globalWorkSize, localWorkSize);
-
-      auto constBuf = gpu().allocKernArg(kCBSize, kCBAlignment);
-
-      // If pattern has been expanded, use the expanded pattern, otherwise use the default pattern.
-      if (packed_obj.pattern_expanded_) {
-        memcpy(constBuf, &packed_obj.expanded_pattern_, kpattern_size);
-      } else {
-        memcpy(constBuf, pattern, kpattern_size);
+    // The calibrated table picks the workgroups for the device memory fills
+    uint32_t blitWg = dev().settings().limit_blit_wg_;
+    const device::BlitTuner* tuner = dev().blitTuner();
+    if (tuner != nullptr) {
+      const device::BlitTuner::Decision* decision =
+          tuner->Find(device::BlitTuner::Fill, size[0], device::BlitTuner::IsAligned(origin[0]));
+      if (decision != nullptr) {
+        blitWg = decision->workgroups_;
       }
-      constexpr bool kDirectVa = true;
-      setArgument(kernels_[kFillType], 1, sizeof(cl_mem), constBuf, 0, nullptr, kDirectVa);
+    }
+    result = shaderFillBuffer(memory, pattern, patternSize, origin, size, blitWg);
+  }
 
-      // Adjust the pattern size in the copy type size
-      kpattern_size /= alignment;
-      setArgument(kernels_[kFillType], 2, sizeof(uint32_t), &kpattern_size);
-      setArgument(kernels_[kFillType], 3, sizeof(alignment), &alignment);
+  synchronize();
 
-      // Calculate max id
-      kfill_size = memory.virtualAddress() + koffset + kfill_size * kpattern_size * alignment;
-      setArgument(kernels_[kFillType], 4, sizeof(kfill_size), &kfill_size);
-      uint32_t next_chunk = globalWorkSize * kpattern_size;
-      setArgument(kernels_[kFillType], 5, sizeof(uint32_t), &next_chunk);
+  return result;
+}
+
+// ================================================================================================
+bool KernelBlitManager::shaderFillBuffer(device::Memory& memory, const void* pattern,
+                                         size_t patternSize, const amd::Coord3D& origin,
+                                         const amd::Coord3D& size, uint32_t blitWg) const {
+  bool result = false;
+  // Pack the fill buffer info, that handles unaligned memories.
+  std::vector<FillBufferInfo> packed_vector{};
+  FillBufferInfo::PackInfo(memory, size[0], origin[0], pattern, patternSize, packed_vector);
+
+  size_t overall_offset = origin[0];
+  for (auto& packed_obj: packed_vector) {
+    constexpr uint32_t kFillType = FillBufferAligned;
+    uint32_t kpattern_size = (packed_obj.pattern_expanded_) ?
+                              HostBlitManager::FillBufferInfo::kExtendedSize : patternSize;
+    size_t kfill_size = packed_obj.fill_size_ / kpattern_size;
+    size_t koffset = overall_offset;
+    overall_offset += packed_obj.fill_size_;
+
+    size_t globalWorkOffset[3] = {0, 0, 0};
+    uint32_t alignment = (kpattern_size & 0xf) == 0 ? 2 * sizeof(uint64_t) :
+                         (kpattern_size & 0x7) == 0 ? sizeof(uint64_t) :
+                         (kpattern_size & 0x3) == 0 ? sizeof(uint32_t) :
+                         (kpattern_size & 0x1) == 0 ? sizeof(uint16_t) : sizeof(uint8_t);
+    // Program kernels arguments for the fill operation
+    cl_mem mem = as_cl<amd::Memory>(memory.owner());
+    setArgument(kernels_[kFillType], 0, sizeof(cl_mem), &mem, koffset);
+    const size_t localWorkSize = 256;
+    size_t globalWorkSize = std::min(blitWg * localWorkSize, kfill_size);
+    globalWorkSize = amd::alignUp(globalWorkSize, localWorkSize);
 
-      // Create ND range object for the kernel's execution
-      amd::NDRangeContainer ndrange(1, globalWorkOffset, &globalWorkSize, &localWorkSize);
+    auto constBuf = gpu().allocKernArg(kCBSize, kCBAlignment);
 
-      // Execute the blit
-      address parameters = captureArguments(kernels_[kFillType]);
-      result = gpu().submitKernelInternal(ndrange, *kernels_[kFillType], parameters, nullptr);
-      releaseArguments(parameters);
+    // If pattern has been expanded, use the expanded pattern, otherwise use the default pattern.
+    if (packed_obj.pattern_expanded_) {
+      memcpy(constBuf, &packed_obj.expanded_pattern_, kpattern_size);
+    } else {
+      memcpy(constBuf, pattern, kpattern_size);
     }
-  }
+    constexpr bool kDirectVa = true;
+    setArgument(kernels_[kFillType], 1, sizeof(cl_mem), constBuf, 0, nullptr, kDirectVa);
 
-  synchronize();
+    // Adjust the pattern size in the copy type size
+    kpattern_size /= alignment;
+    setArgument(kernels_[kFillType], 2, sizeof(uint32_t), &kpattern_size);
+    setArgument(kernels_[kFillType], 3, sizeof(alignment), &alignment);
+
+    // Calculate max id
+    kfill_size = memory.virtualAddress() + koffset + kfill_size * kpattern_size * alignment;
+    setArgument(kernels_[kFillType], 4, sizeof(kfill_size), &kfill_size);
+    uint32_t next_chunk = globalWorkSize * kpattern_size;
+    setArgument(kernels_[kFillType], 5, sizeof(uint32_t), &next_chunk);
 
+    // Create ND range object for the kernel's execution
+    amd::NDRangeContainer ndrange(1, globalWorkOffset, &globalWorkSize, &localWorkSize);
+
+    // Execute the blit
+    address parameters = captureArguments(kernels_[kFillType]);
+    result = gpu().submitKernelInternal(ndrange, *kernels_[kFillType], parameters, nullptr);
+    releaseArguments(parameters);
+  }
   return result;
 }
 
@@ -2211,6 +2263,24 @@ bool KernelBlitManager::copyBuffer(device::Memory& srcMemory, device::Memory& ds
                           (copyMetadata.copyEnginePreference_ ==
                            amd::CopyMetadata::CopyEnginePreference::BLIT));
 
+  // The calibrated decision table overrides the heuristics, unless the path is forced
+  const device::BlitTuner* tuner = dev().blitTuner();
+  bool srcHost = srcMemory.isHostMemDirectAccess();
+  bool dstHost = dstMemory.isHostMemDirectAccess();
+  if ((tuner != nullptr) && !p2p && !ipcShared && !setup_.disableHwlCopyBuffer_ &&
+      (&gpuMem(srcMemory).dev() == &gpuMem(dstMemory).dev()) && !(srcHost && dstHost) &&
+      (copyMetadata.copyEnginePreference_ == amd::CopyMetadata::CopyEnginePreference::NONE)) {
+    auto kind = srcHost ? device::BlitTuner::HostToDevice :
+                dstHost ? device::BlitTuner::DeviceToHost : device::BlitTuner::DeviceToDevice;
+    bool aligned = device::BlitTuner::IsAligned(srcOrigin[0]) &&
+                   device::BlitTuner::IsAligned(dstOrigin[0]);
+    const device::BlitTuner::Decision* decision = tuner->Find(kind, sizeIn[0], aligned);
+    if (decision != nullptr) {
+      useShaderCopyPath = (decision->engine_ == device::BlitTuner::Kernel);
+      blitWg = decision->workgroups_;
+    }
+  }
+
   if (!useShaderCopyPath) {
     if (amd::IS_HIP) {
       // Update the command type for ROC profiler
@@ -2246,6 +2316,86 @@ bool KernelBlitManager::copyBuffer(device::Memory& srcMemory, device::Memory& ds
   return result;
 }
 
+// ================================================================================================
+//! Times the blits of the calibration on the device memory and the pinned system memory
+class KernelBlitManager::TuneTimer : public device::BlitTuner::Timer {
+ public:
+  TuneTimer(const KernelBlitManager& blit, device::Memory& devSrc, device::Memory& devDst,
+            device::Memory& host)
+    : blit_(blit), devSrc_(devSrc), devDst_(devDst), host_(host) {}
+
+  virtual uint64_t Measure(device::BlitTuner::Kind kind, device::BlitTuner::Engine engine,
+                           size_t size, bool aligned, uint32_t workgroups) {
+    device::Memory& src = (kind == device::BlitTuner::HostToDevice) ? host_ : devSrc_;
+    device::Memory& dst = (kind == device::BlitTuner::DeviceToHost) ? host_ : devDst_;
+    amd::Coord3D origin(aligned ? 0 : device::BlitTuner::kUnalignedOffset);
+    amd::Coord3D copySize(size);
+
+    uint64_t start = amd::Os::timeNanos();
+    bool result = false;
+    if (kind == device::BlitTuner::Fill) {
+      uint32_t pattern = 0;
+      result = blit_.shaderFillBuffer(dst, &pattern, sizeof(pattern), origin, copySize,
+                                      workgroups);
+    } else if (engine == device::BlitTuner::Sdma) {
+      result = blit_.DmaBlitManager::copyBuffer(src, dst, origin, origin, copySize);
+    } else {
+      if (kind == device::BlitTuner::HostToDevice) {
+        blit_.gpu().addSystemScope();
+      }
+      result = blit_.shaderCopyBuffer(reinterpret_cast<address>(dst.virtualAddress()),
+                                      reinterpret_cast<address>(src.virtualAddress()),
+                                      origin, origin, copySize, false, workgroups,
+                                      amd::CopyMetadata());
+    }
+    // Wait for the transfer, so the time covers the whole blit
+    blit_.gpu().releaseGpuMemoryFence();
+    return result ? std::max<uint64_t>(amd::Os::timeNanos() - start, 1) : 0;
+  }
+
+ private:
+  const KernelBlitManager& blit_;
+  device::Memory& devSrc_;
+  device::Memory& devDst_;
+  device::Memory& host_;
+};
+
+// ================================================================================================
+bool KernelBlitManager::calibrate(device::BlitTuner& tuner) const {
+  constexpr size_t kBufferSize =
+      (size_t{1} << device::BlitTuner::kMaxSizeLog2) + device::BlitTuner::kUnalignedOffset;
+  constexpr cl_mem_flags kFlags[] = {CL_MEM_READ_WRITE, CL_MEM_READ_WRITE, CL_MEM_ALLOC_HOST_PTR};
+  amd::Buffer* buffers[3] = {};
+  device::Memory* memory[3] = {};
+
+  bool result = true;
+  for (uint i = 0; i < 3; ++i) {
+    buffers[i] = new (dev().context()) amd::Buffer(dev().context(), kFlags[i], kBufferSize);
+    if ((buffers[i] == nullptr) || !buffers[i]->create(nullptr)) {
+      result = false;
+      break;
+    }
+    memory[i] = dev().getRocMemory(buffers[i]);
+    if (memory[i] == nullptr) {
+      result = false;
+      break;
+    }
+  }
+
+  if (result) {
+    amd::ScopedLock k(lockXferOps_);
+    TuneTimer timer(*this, *memory[0], *memory[1], *memory[2]);
+    tuner.Calibrate(timer, dev().info().maxComputeUnits_, !setup_.disableHwlCopyBuffer_);
+  }
+
+  for (auto buffer : buffers) {
+    if (buffer != nullptr) {
+      buffer->release();
+    }
+  }
+  return result && tuner.Calibrated();
+}
+
 // ================================================================================================
 bool KernelBlitManager::fillImage(device::Memory& memory, const void* pattern,
                                   const amd::Coord3D& origin, const amd::Coord3D& size,
@@ -2681,6 +2831,7 @@ bool KernelBlitManager::runScheduler(uint64_t vqVM, amd::Memory* schedulerParam,
   }
   releaseArguments(parameters);
 
+  gpu().flushDoorbell();
   if (!WaitForSignal(schedulerSignal)) {
     LogWarning("Failed schedulerSignal wait");
     return false;
@@ -25,6 +25,7 @@
 #include "platform/commandqueue.hpp"
 #include "device/device.hpp"
 #include "device/blit.hpp"
+#include "device/blittuner.hpp"
 #include "device/rocm/rocdefs.hpp"
 #include "device/rocm/rocsched.hpp"
 
@@ -505,6 +506,9 @@ class KernelBlitManager : public DmaBlitManager {
 
   virtual amd::Monitor* lockXfer() const { return &lockXferOps_; }
 
+  //! Fills the blit decision table of the device with the measured transfers
+  bool calibrate(device::BlitTuner& tuner) const;
+
   virtual bool initHeap(device::Memory* heap_to_initialize,
                         device::Memory* initial_blocks,
                         uint heap_size,
@@ -567,6 +571,13 @@ class KernelBlitManager : public DmaBlitManager {
     return (dev().info().imageSupport_) ? BlitTotal : BlitLinearTotal;
   }
 
+  class TuneTimer;
+
+  //! Fills a buffer using the blit kernel with the number of workgroups
+  bool shaderFillBuffer(device::Memory& memory, const void* pattern, size_t patternSize,
+                        const amd::Coord3D& origin, const amd::Coord3D& size,
+                        uint32_t blitWg) const;
+
   //! Copies a buffer using the shader path
   bool shaderCopyBuffer(address dst, address src,
                         const amd::Coord3D& dstOrigin, const amd::Coord3D& srcOrigin,
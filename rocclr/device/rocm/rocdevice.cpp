@@ -54,6 +54,7 @@
 #include <fstream>
 #include <iostream>
 #include <iomanip>
+#include <sstream>
 #include <memory>
 #ifdef ROCCLR_SUPPORT_NUMA_POLICY
 #include <numa.h>
@@ -180,7 +181,6 @@ Device::Device(hsa_agent_t bkendDevice)
     , gpuvm_segment_max_alloc_(0)
     , alloc_granularity_(0)
     , xferQueue_(nullptr)
-    , xferRead_(nullptr)
     , freeMem_(0)
     , vgpusAccess_(true) /* Virtual GPU List Ops Lock */
     , hsa_exclusive_gpu_access_(false)
@@ -271,6 +271,9 @@ Device::~Device() {
       glb_ctx_ = nullptr;
   }
 
+  // The final load of the shared queues shows how evenly the streams were spread
+  printQueueLoad();
+
   for (auto& it : queuePool_) {
     for (auto qIter = it.begin(); qIter != it.end(); ) {
       hsa_queue_t* queue = qIter->first;
@@ -289,12 +292,11 @@ Device::~Device() {
   }
   queuePool_.clear();
 
-  // Destroy temporary buffers for read/write
-  delete xferRead_;
-
   // Destroy transfer queue
   delete xferQueue_;
 
+  delete blitTuner_;
+
   delete blitProgram_;
 
   if (context_ != nullptr) {
@@ -391,76 +393,6 @@ hsa_status_t Device::loaderQueryHostAddress(const void* device, const void** hos
       : HSA_STATUS_ERROR;
 }
 
-Device::XferBuffers::~XferBuffers() {
-  // Destroy temporary buffer for reads
-  for (const auto& buf : freeBuffers_) {
-    delete buf;
-  }
-  freeBuffers_.clear();
-}
-
-bool Device::XferBuffers::create() {
-  Memory* xferBuf = nullptr;
-  bool result = false;
-
-  // Create a buffer object
-  xferBuf = new Buffer(dev(), bufSize_);
-
-  // Try to allocate memory for the transfer buffer
-  if ((nullptr == xferBuf) || !xferBuf->create()) {
-    delete xferBuf;
-    xferBuf = nullptr;
-    LogError("Couldn't allocate a transfer buffer!");
-  } else {
-    result = true;
-    freeBuffers_.push_back(xferBuf);
-  }
-
-  return result;
-}
-
-Memory& Device::XferBuffers::acquire() {
-  Memory* xferBuf = nullptr;
-  size_t listSize;
-
-  // Lock the operations with the staged buffer list
-  amd::ScopedLock l(lock_);
-  listSize = freeBuffers_.size();
-
-  // If the list is empty, then attempt to allocate a staged buffer
-  if (listSize == 0) {
-    // Allocate memory
-    xferBuf = new Buffer(dev(), bufSize_);
-
-    // Allocate memory for the transfer buffer
-    if ((nullptr == xferBuf) || !xferBuf->create()) {
-      delete xferBuf;
-      xferBuf = nullptr;
-      LogError("Couldn't allocate a transfer buffer!");
-    } else {
-      ++acquiredCnt_;
-    }
-  }
-
-  if (xferBuf == nullptr) {
-    xferBuf = *(freeBuffers_.begin());
-    freeBuffers_.erase(freeBuffers_.begin());
-    ++acquiredCnt_;
-  }
-
-  return *xferBuf;
-}
-
-void Device::XferBuffers::release(VirtualGPU& gpu, Memory& buffer) {
-  // Make sure buffer isn't busy on the current VirtualGPU, because
-  // the next aquire can come from different queue
-  //    buffer.wait(gpu);
-  // Lock the operations with the staged buffer list
-  amd::ScopedLock l(lock_);
-  freeBuffers_.push_back(&buffer);
-  --acquiredCnt_;
-}
-
 // ================================================================================================
 bool Device::init() {
   ClPrint(amd::LOG_INFO, amd::LOG_INIT, "Initializing HSA stack.");
@@ -631,6 +563,13 @@ bool Device::init() {
         return false;
       }
     }
+
+    // The calibration runs blits, so it waits until all devices are set up
+    if (DEBUG_CLR_BLIT_TUNE != 0) {
+      for (auto device : devices) {
+        static_cast<Device*>(device)->setupBlitTuner();
+      }
+    }
   }
 
   return true;
@@ -817,17 +756,6 @@ bool Device::create() {
   // Use just 1 entry by default for the map cache
   mapCache_->push_back(nullptr);
 
-  if (settings().stagedXferSize_ != 0) {
-    // Initialize staged read buffers
-    if (settings().stagedXferRead_) {
-      xferRead_ = new XferBuffers(*this, amd::alignUp(settings().stagedXferSize_, 4 * Ki));
-      if ((xferRead_ == nullptr) || !xferRead_->create()) {
-        LogError("Couldn't allocate transfer buffer objects for write");
-        return false;
-      }
-    }
-  }
-
   // Create signal for HMM prefetch operation on device
   if (HSA_STATUS_SUCCESS != hsa_signal_create(kInitSignalValueOne, 0, nullptr, &prefetch_signal_)) {
     return false;
@@ -2903,6 +2831,32 @@ VirtualGPU* Device::xferQueue() const {
   return xferQueue_;
 }
 
+// ================================================================================================
+void Device::setupBlitTuner() {
+  // The key changes with the chip, the ISA features and the number of enabled CUs
+  std::stringstream key;
+  key << isa().targetId() << ':' << std::hex << pciDeviceId_ << std::dec << ':'
+      << info().maxComputeUnits_;
+  auto tuner = std::make_unique<device::BlitTuner>(key.str());
+
+  std::string file = device::BlitTuner::CacheFile();
+  if (!tuner->Load(file, info().maxComputeUnits_)) {
+    VirtualGPU* queue = (DEBUG_CLR_BLIT_TUNE >= 2) ? xferQueue() : nullptr;
+    if ((queue == nullptr) ||
+        !static_cast<const KernelBlitManager&>(queue->blitMgr()).calibrate(*tuner)) {
+      ClPrint(amd::LOG_INFO, amd::LOG_INIT, "No blit decision table for %s in %s",
+              tuner->key().c_str(), file.c_str());
+      return;
+    }
+    if (!tuner->Save(file)) {
+      LogPrintfWarning("Unable to save the blit decision table in %s", file.c_str());
+    }
+  }
+  ClPrint(amd::LOG_INFO, amd::LOG_INIT, "Blit decision table for %s from %s",
+          tuner->key().c_str(), file.c_str());
+  blitTuner_ = tuner.release();
+}
+
 // ================================================================================================
 bool Device::SetClockMode(const cl_set_device_clock_mode_input_amd setClockModeInput,
   cl_set_device_clock_mode_output_amd* pSetClockModeOutput) {
@@ -2941,6 +2895,28 @@ void Device::getHwEventTime(const amd::Event& event, uint64_t* start, uint64_t*
   }
 }
 
+// ================================================================================================
+double Device::sampleQueueLoad(hsa_queue_t* queue, QueueInfo& info) const {
+  // Samples closer than this keep the previous rate, since the rate of a short interval is noise
+  constexpr uint64_t kMinSampleIntervalNs = 100 * 1000;
+  uint64_t write = hsa_queue_load_write_index_relaxed(queue);
+  uint64_t read = hsa_queue_load_read_index_relaxed(queue);
+  uint64_t now = amd::Os::timeNanos();
+  if (info.sampleTime_ == 0) {
+    info.sampleIndex_ = write;
+    info.sampleTime_ = now;
+  } else if ((now - info.sampleTime_) >= kMinSampleIntervalNs) {
+    double rate =
+        static_cast<double>(write - info.sampleIndex_) * 1e6 / (now - info.sampleTime_);
+    // Exponential smoothing, so a single burst doesn't dominate the choice
+    info.submitRate_ = (info.submitRate_ + rate) / 2;
+    info.sampleIndex_ = write;
+    info.sampleTime_ = now;
+  }
+  uint64_t outstanding = (write > read) ? (write - read) : 0;
+  return static_cast<double>(outstanding) + info.submitRate_;
+}
+
 // ================================================================================================
 hsa_queue_t* Device::getQueueFromPool(const uint qIndex) {
   // Check if queue with refCount 0 is available to use
@@ -2955,15 +2931,22 @@ hsa_queue_t* Device::getQueueFromPool(const uint qIndex) {
     }
   } else {
     if (qIndex < QueuePriority::Total && queuePool_[qIndex].size() > 0) {
-      // Search through all available queues for the lowest counter.
+      // Search through all available queues for the lowest measured load and the lowest
+      // counter on a tie, so a new stream doesn't land behind a busy stream.
       // Note: the map is sorted in the allocation order for possible round-robin selection
-      typedef decltype(queuePool_)::value_type::const_reference PoolRef;
-      auto lowest = std::min_element(
-          queuePool_[qIndex].begin(), queuePool_[qIndex].end(),
-          [](PoolRef A, PoolRef B) { return A.second.refCount < B.second.refCount; });
+      auto lowest = queuePool_[qIndex].end();
+      double lowest_load = 0;
+      for (auto it = queuePool_[qIndex].begin(); it != queuePool_[qIndex].end(); ++it) {
+        double load = sampleQueueLoad(it->first, it->second);
+        if ((lowest == queuePool_[qIndex].end()) || (load < lowest_load) ||
+            ((load == lowest_load) && (it->second.refCount < lowest->second.refCount))) {
+          lowest = it;
+          lowest_load = load;
+        }
+      }
       lowest->second.refCount++;
-      ClPrint(amd::LOG_INFO, amd::LOG_QUEUE, "Selected queue refCount: %p (%d)",
-              lowest->first->base_address, lowest->second.refCount);
+      ClPrint(amd::LOG_INFO, amd::LOG_QUEUE, "Selected queue refCount: %p (%d), load %.1f",
+              lowest->first->base_address, lowest->second.refCount, lowest_load);
       return lowest->first;
     }
   }
@@ -3189,6 +3172,89 @@ void Device::releaseQueue(hsa_queue_t* queue, const std::vector<uint32_t>& cuMas
 
 }
 
+// ================================================================================================
+hsa_queue_t* Device::rebalanceQueue(hsa_queue_t* queue, amd::CommandQueue::Priority priority) {
+  // Device wide operations may hold the lock and wait for the queues, so don't block on it.
+  // The next drain point will try again
+  if (!vgpusAccess().tryLock()) {
+    return nullptr;
+  }
+  uint qIndex = QueuePriority::Normal;
+  if (priority == amd::CommandQueue::Priority::Low) {
+    qIndex = QueuePriority::Low;
+  } else if (priority == amd::CommandQueue::Priority::High) {
+    qIndex = QueuePriority::High;
+  }
+  auto& pool = queuePool_[qIndex];
+  hsa_queue_t* result = nullptr;
+  auto current = pool.find(queue);
+  // Only a shared queue can serialize the work of different streams
+  if ((current != pool.end()) && (current->second.refCount > 1)) {
+    double current_load = sampleQueueLoad(current->first, current->second);
+    auto lightest = pool.end();
+    double lightest_load = 0;
+    for (auto it = pool.begin(); it != pool.end(); ++it) {
+      if (it == current) {
+        continue;
+      }
+      double load = sampleQueueLoad(it->first, it->second);
+      if ((lightest == pool.end()) || (load < lightest_load)) {
+        lightest = it;
+        lightest_load = load;
+      }
+    }
+    // Move only for a clear win and never to a queue with more users, so streams don't bounce
+    // between queues with a similar load
+    if ((lightest != pool.end()) && (lightest->second.refCount <= current->second.refCount) &&
+        ((lightest_load * 2 + 1) < current_load)) {
+      current->second.refCount--;
+      lightest->second.refCount++;
+      result = lightest->first;
+      ClPrint(amd::LOG_INFO, amd::LOG_QUEUE,
+              "Moved a drained stream from HWq=%p (%d users, load %.1f) to HWq=%p "
+              "(%d users, load %.1f)", current->first->base_address, current->second.refCount,
+              current_load, lightest->first->base_address, lightest->second.refCount,
+              lightest_load);
+    }
+  }
+  vgpusAccess().unlock();
+  return result;
+}
+
+// ================================================================================================
+void Device::refreshQueueLoad(hsa_queue_t* queue) {
+  // The submission path must not wait for the queue pool
+  if (!vgpusAccess().tryLock()) {
+    return;
+  }
+  for (auto& pool : queuePool_) {
+    auto it = pool.find(queue);
+    if (it != pool.end()) {
+      sampleQueueLoad(it->first, it->second);
+      break;
+    }
+  }
+  vgpusAccess().unlock();
+}
+
+// ================================================================================================
+void Device::printQueueLoad() {
+  amd::ScopedLock lock(vgpusAccess());
+  for (uint qIndex = 0; qIndex < QueuePriority::Total; ++qIndex) {
+    for (auto& it : queuePool_[qIndex]) {
+      uint64_t write = hsa_queue_load_write_index_relaxed(it.first);
+      uint64_t read = hsa_queue_load_read_index_relaxed(it.first);
+      double load = sampleQueueLoad(it.first, it.second);
+      ClPrint(amd::LOG_INFO, amd::LOG_QUEUE,
+              "HWq=%p priority %u: %d users, %llu packets, %llu outstanding, %.1f packets/ms, "
+              "load %.1f", it.first->base_address, qIndex, it.second.refCount,
+              static_cast<unsigned long long>(write),
+              static_cast<unsigned long long>((write > read) ? (write - read) : 0),
+              it.second.submitRate_, load);
+    }
+  }
+}
+
 void* Device::getOrCreateHostcallBuffer(hsa_queue_t* queue, bool coop_queue,
                                         const std::vector<uint32_t>& cuMask) {
   decltype(queuePool_)::value_type::iterator qIter;
@@ -3528,6 +3594,8 @@ void Device::AddKernel(Kernel& gpuKernel) const {
 
 // ================================================================================================
 void Device::RemoveKernel(Kernel& gpuKernel) const {
+  // A new kernel can reuse the address, so invalidate the caches of kernel pointers
+  kernel_generation_.fetch_add(1, std::memory_order_release);
   if (gpuKernel.KernelCodeHandle() != 0) {
     amd::ScopedLock lock(vgpusAccess());
     auto it = kernel_map_.find(gpuKernel.KernelCodeHandle());
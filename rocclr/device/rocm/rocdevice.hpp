@@ -33,6 +33,7 @@
 #include "thread/thread.hpp"
 #include "thread/monitor.hpp"
 #include "utils/versions.hpp"
+#include "device/blittuner.hpp"
 
 #include "device/rocm/rocsettings.hpp"
 #include "device/rocm/rocvirtual.hpp"
@@ -329,47 +330,11 @@ struct AgentInfo {
 //! A HSA device ordinal (physical HSA device)
 class Device : public NullDevice {
  public:
-  //! Transfer buffers
-  class XferBuffers : public amd::HeapObject {
-   public:
-    static const size_t MaxXferBufListSize = 8;
-
-    //! Default constructor
-    XferBuffers(const Device& device, size_t bufSize)
-        : bufSize_(bufSize), acquiredCnt_(0), gpuDevice_(device) {}
-
-    //! Default destructor
-    ~XferBuffers();
-
-    //! Creates the xfer buffers object
-    bool create();
-
-    //! Acquires an instance of the transfer buffers
-    Memory& acquire();
-
-    //! Releases transfer buffer
-    void release(VirtualGPU& gpu,  //!< Virual GPU object used with the buffer
-                 Memory& buffer    //!< Transfer buffer for release
-                 );
-
-    //! Returns the buffer's size for transfer
-    size_t bufSize() const { return bufSize_; }
-
-   private:
-    //! Disable copy constructor
-    XferBuffers(const XferBuffers&);
-
-    //! Disable assignment operator
-    XferBuffers& operator=(const XferBuffers&);
-
-    //! Get device object
-    const Device& dev() const { return gpuDevice_; }
-
-    size_t bufSize_;                  //!< Staged buffer size
-    std::list<Memory*> freeBuffers_;  //!< The list of free buffers
-    std::atomic_uint acquiredCnt_;   //!< The total number of acquired buffers
-    amd::Monitor lock_;               //!< Stgaed buffer acquire/release lock
-    const Device& gpuDevice_;         //!< GPU device object
+  //! Staged read statistics, accumulated over all queues of the device
+  struct StagingStats {
+    std::atomic<uint64_t> bytes_{0};    //!< Bytes copied through the staging buffers
+    std::atomic<uint64_t> wait_ns_{0};  //!< Time CPU waited for the staging copies on GPU
+    std::atomic<uint64_t> allocs_{0};   //!< Number of the staging buffer allocations
   };
 
   //! Initialise the whole HSA device subsystem (CAL init, device enumeration, etc).
@@ -517,8 +482,8 @@ class Device : public NullDevice {
   //! Adds a map target to the cache
   bool addMapTarget(amd::Memory* memory) const;
 
-  //! Returns transfer buffer object
-  XferBuffers& xferRead() const { return *xferRead_; }
+  //! Returns staged read statistics
+  StagingStats& stagingStats() const { return stagingStats_; }
 
   //! Returns a ROC memory object from AMD memory object
   roc::Memory* getRocMemory(amd::Memory* mem  //!< Pointer to AMD memory object
@@ -527,6 +492,12 @@ class Device : public NullDevice {
   //! Create internal blit program
   bool createBlitProgram();
 
+  //! Returns the calibrated blit decision table or nullptr for the fixed heuristics
+  const device::BlitTuner* blitTuner() const { return blitTuner_; }
+
+  //! Loads the blit decision table from the cache or calibrates it, see DEBUG_CLR_BLIT_TUNE
+  void setupBlitTuner();
+
   // P2P agents avaialble for this device
   const std::vector<hsa_agent_t>& p2pAgents() const { return p2p_agents_; }
 
@@ -562,6 +533,16 @@ class Device : public NullDevice {
   //! Release HSA queue
   void releaseQueue(hsa_queue_t*, const std::vector<uint32_t>& cuMask = {}, bool coop_queue = false);
 
+  //! Moves a drained user of the shared HSA queue to a less loaded queue with the same priority.
+  //! Returns the new queue or nullptr if the queue stays
+  hsa_queue_t* rebalanceQueue(hsa_queue_t* queue, amd::CommandQueue::Priority priority);
+
+  //! Updates the load sample of the HSA queue. Skips the sample if the pool is busy
+  void refreshQueueLoad(hsa_queue_t* queue);
+
+  //! Prints the load of all shared HSA queues
+  void printQueueLoad();
+
   //! For the given HSA queue, return an existing hostcall buffer or create a
   //! new one. queuePool_ keeps a mapping from HSA queue to hostcall buffer.
   void* getOrCreateHostcallBuffer(hsa_queue_t* queue, bool coop_queue = false,
@@ -604,6 +585,8 @@ class Device : public NullDevice {
   void AddKernel(Kernel& gpuKernel) const;
   //! Removes a kernel from the kernel map
   void RemoveKernel(Kernel& gpuKernel) const;
+  //! Returns the number of the destroyed kernels. Caches of kernel pointers compare it
+  uint64_t KernelGeneration() const { return kernel_generation_.load(std::memory_order_acquire); }
 
  private:
   bool create();
@@ -647,8 +630,9 @@ class Device : public NullDevice {
   size_t alloc_granularity_;
   static constexpr bool offlineDevice_ = false;
   VirtualGPU* xferQueue_;  //!< Transfer queue, created on demand
+  device::BlitTuner* blitTuner_ = nullptr;  //!< Calibrated blit decisions
 
-  XferBuffers* xferRead_;   //!< Transfer buffers read
+  mutable StagingStats stagingStats_;  //!< Staged read statistics
   std::atomic<size_t> freeMem_;   //!< Total of free memory available
   mutable amd::Monitor vgpusAccess_;     //!< Lock to serialise virtual gpu list access
   bool hsa_exclusive_gpu_access_;  //!< TRUE if current device was moved into exclusive GPU access mode
@@ -657,6 +641,9 @@ class Device : public NullDevice {
   struct QueueInfo {
     int refCount;           //! Reference counter. Shows how many time the queue was shared
     void* hostcallBuffer_;  //! Host call buffer for the HSA queue
+    uint64_t sampleIndex_;  //! Write index at the last load sample
+    uint64_t sampleTime_;   //! Time of the last load sample in ns
+    double submitRate_;     //! Smoothed submission rate in packets per ms
   };
 
   struct QueueCompare {
@@ -668,9 +655,12 @@ class Device : public NullDevice {
   //! a vector for keeping Pool of HSA queues with low, normal and high priorities for recycling
   std::vector<std::map<hsa_queue_t*, QueueInfo, QueueCompare>> queuePool_;
 
-  //! returns a hsa queue from queuePool with least refCount and updates the refCount as well
+  //! returns a hsa queue from queuePool with the lowest load and updates the refCount as well
   hsa_queue_t* getQueueFromPool(const uint qIndex);
 
+  //! Returns the load of the HSA queue: outstanding packets and packets expected in the next ms
+  double sampleQueueLoad(hsa_queue_t* queue, QueueInfo& info) const;
+
   void* coopHostcallBuffer_;
   //! returns value for corresponding LinkAttrbutes in a vector given Memory pool.
   virtual bool findLinkInfo(const hsa_amd_memory_pool_t& pool,
@@ -686,6 +676,7 @@ class Device : public NullDevice {
 
   //! Code object to kernel info map (used in the crash dump analysis)
   mutable std::map<uint64_t, Kernel&> kernel_map_;
+  mutable std::atomic<uint64_t> kernel_generation_{0};  //!< Number of the destroyed kernels
 
  public:
   std::atomic<uint> numOfVgpus_;  //!< Virtual gpu unique index
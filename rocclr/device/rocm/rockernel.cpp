@@ -32,6 +32,25 @@ bool Kernel::init() {
   return GetAttrCodePropMetadata();
 }
 
+bool Kernel::initLazy() {
+  setLazy();
+  // The init/fini kernels run at the load time, so the kind can't wait for the first use
+  return GetKindMetadata();
+}
+
+bool Kernel::materializeMetadata() {
+  // The program sets the uniform work group size option for the old code objects
+  bool uniformWorkGroupSize = getUniformWorkGroupSize();
+  if (!init()) {
+    return false;
+  }
+  if (codeObjectVer() < 5) {
+    setUniformWorkGroupSize(uniformWorkGroupSize);
+  }
+  // A stub, used before the code object load, finishes the setup in setKernels()
+  return !program()->isExecutableFrozen() || postLoad();
+}
+
 bool Kernel::postLoad() {
   // Set the kernel symbol name and size/alignment based on the kernel metadata
   // NOTE: kernel name is used to get the kernel code handle in V2,
@@ -141,28 +160,6 @@ bool Kernel::postLoad() {
   }
   assert(wavefront_size > 0);
 
-  size_t const_size_bytes = 0;
-  hsa_executable_iterate_symbols(
-      program()->hsaExecutable(),
-      [](hsa_executable_t executable, hsa_executable_symbol_t symbol,
-         void *const_size_bytes) -> hsa_status_t {
-        bool variable_is_const = false;
-        hsa_status_t hsaStat = hsa_executable_symbol_get_info(
-            symbol, HSA_EXECUTABLE_SYMBOL_INFO_VARIABLE_IS_CONST, &variable_is_const);
-
-        if (hsaStat == HSA_STATUS_SUCCESS && variable_is_const) {
-          uint32_t variable_size = 0;
-          if (hsa_executable_symbol_get_info(
-                  symbol, HSA_EXECUTABLE_SYMBOL_INFO_VARIABLE_SIZE,
-                  &variable_size) == HSA_STATUS_SUCCESS) {
-            *(static_cast<size_t *>(const_size_bytes)) += variable_size;
-          }
-        }
-
-        return HSA_STATUS_SUCCESS;
-      },
-      &const_size_bytes);
-
   workGroupInfo_.privateMemSize_ = workitemPrivateSegmentByteSize_;
   workGroupInfo_.localMemSize_ = workgroupGroupSegmentByteSize_;
   workGroupInfo_.usedLDSSize_ = workgroupGroupSegmentByteSize_;
@@ -170,7 +167,7 @@ bool Kernel::postLoad() {
   workGroupInfo_.usedStackSize_ = kernelHasDynamicCallStack_;
   workGroupInfo_.wavefrontPerSIMD_ = program()->rocDevice().info().maxWorkItemSizes_[0] / wavefront_size;
   workGroupInfo_.wavefrontSize_ = wavefront_size;
-  workGroupInfo_.constMemSize_ = const_size_bytes;
+  workGroupInfo_.constMemSize_ = program()->constVariablesSize();
   workGroupInfo_.maxDynamicSharedSizeBytes_ = static_cast<int>(workGroupInfo_.availableLDSSize_ -
                                                                workGroupInfo_.localMemSize_);
   if (workGroupInfo_.size_ == 0) {
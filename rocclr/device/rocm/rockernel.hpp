@@ -45,6 +45,9 @@ class Kernel : public device::Kernel {
   //! Initializes the metadata required for this kernel
   virtual bool init() final;
 
+  //! Creates the kernel as a stub, which builds the metadata on the first use
+  bool initLazy();
+
   //! Setup after code object loading
   bool postLoad();
 
@@ -58,6 +61,10 @@ class Kernel : public device::Kernel {
     return demangled_name_;
   }
 
+ protected:
+  //! Builds the metadata of the stub and binds it to the code object, if it's loaded
+  virtual bool materializeMetadata();
+
  private:
   void initDemangledName() {
     if (demangled_name_.empty()) {
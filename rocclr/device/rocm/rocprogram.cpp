@@ -24,6 +24,7 @@
 
 #include "utils/options.hpp"
 #include "rockernel.hpp"
+#include "device/devurirange.hpp"
 
 #include "hsa/amd_hsa_kernel_code.h"
 
@@ -49,6 +50,7 @@ Program::~Program() {
   // Destroy the executable.
   if (hsaExecutable_.handle != 0) {
     hsa_executable_destroy(hsaExecutable_);
+    device::UriRangeTable::CodeObjectsChanged();
   }
   if (hsaCodeObjectReader_.handle != 0) {
     hsa_code_object_reader_destroy(hsaCodeObjectReader_);
@@ -268,10 +270,13 @@ bool LightningProgram::createKernels(void* binary, size_t binSize, bool useUnifo
     return false;
   }
 
+  // A large code object has thousands of kernels and an application uses a few of them,
+  // so the kernels may start as stubs. The runtime always uses the internal kernels
+  const bool lazy = DEBUG_CLR_LAZY_KERNELS && !internalKernel;
   for (const auto &kernelMeta : kernelMetadataMap_) {
     const std::string kernelName = kernelMeta.first;
     Kernel* aKernel = new roc::Kernel(kernelName, this);
-    if (!aKernel->init()) {
+    if (!(lazy ? aKernel->initLazy() : aKernel->init())) {
       return false;
     }
     if (codeObjectVer() < 5) {
@@ -332,10 +337,36 @@ bool LightningProgram::setKernels(void* binary, size_t binSize,
     buildLog_ += "\n";
     return false;
   }
-
+  device::UriRangeTable::CodeObjectsChanged();
+
+  // Sum the constant variables once for all kernels of the executable
+  hsa_executable_iterate_symbols(
+      hsaExecutable_,
+      [](hsa_executable_t executable, hsa_executable_symbol_t symbol,
+         void *const_size_bytes) -> hsa_status_t {
+        bool variable_is_const = false;
+        hsa_status_t hsaStat = hsa_executable_symbol_get_info(
+            symbol, HSA_EXECUTABLE_SYMBOL_INFO_VARIABLE_IS_CONST, &variable_is_const);
+
+        if (hsaStat == HSA_STATUS_SUCCESS && variable_is_const) {
+          uint32_t variable_size = 0;
+          if (hsa_executable_symbol_get_info(
+                  symbol, HSA_EXECUTABLE_SYMBOL_INFO_VARIABLE_SIZE,
+                  &variable_size) == HSA_STATUS_SUCCESS) {
+            *(static_cast<size_t *>(const_size_bytes)) += variable_size;
+          }
+        }
+
+        return HSA_STATUS_SUCCESS;
+      },
+      &constVariablesSize_);
+
+  // The stub kernels finish the setup when they are materialized
+  amd::ScopedLock sl(device::Kernel::materializeLock());
+  executableFrozen_ = true;
   for (auto& kit : kernels()) {
     Kernel* kernel = static_cast<Kernel*>(kit.second);
-    if (!kernel->postLoad()) {
+    if (!kernel->isLazy() && !kernel->postLoad()) {
       return false;
     }
   }
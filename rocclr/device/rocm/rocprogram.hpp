@@ -61,6 +61,12 @@ class Program : public device::Program {
     return hsaExecutable_;
   }
 
+  //! Returns TRUE if the executable is frozen and the kernels can bind to the code object
+  bool isExecutableFrozen() const { return executableFrozen_; }
+
+  //! Returns the total size of the constant variables in the executable
+  size_t constVariablesSize() const { return constVariablesSize_; }
+
   virtual bool createGlobalVarObj(amd::Memory** amd_mem_obj, void** device_pptr,
                                   size_t* bytes, const char* global_name) const;
 
@@ -84,6 +90,8 @@ protected:
   /* HSA executable */
   hsa_executable_t hsaExecutable_;               //!< Handle to HSA executable
   hsa_code_object_reader_t hsaCodeObjectReader_; //!< Handle to HSA code reader
+  bool executableFrozen_ = false;                //!< The kernels can bind to the code object
+  size_t constVariablesSize_ = 0;                //!< Size of the constant variables
 };
 
 class HSAILProgram : public roc::Program {
@@ -21,12 +21,46 @@
 #if defined(__clang__)
 #if __has_feature(address_sanitizer)
 #include "rocurilocator.hpp"
-#include <sstream>
+#include <algorithm>
 
 namespace amd::roc {
-hsa_status_t UriLocator::createUriRangeTable() {
-  auto execCb = [] (hsa_executable_t exec,
-    void *data) -> hsa_status_t {
+UriLocator::~UriLocator() {
+  for (auto& it : uriCache_) {
+    if (amd::Os::isValidFileDesc(it.second.fd_)) {
+      amd::Os::CloseFileHandle(it.second.fd_);
+    }
+  }
+}
+
+bool UriLocator::init() {
+  uint32_t generation = device::UriRangeTable::Generation();
+  if (!init_) {
+    hsa_status_t result = hsa_system_get_major_extension_table(HSA_EXTENSION_AMD_LOADER, 1,
+        sizeof(fn_table_), &fn_table_);
+    if (result != HSA_STATUS_SUCCESS)
+      return false;
+  } else if (generation == generation_) {
+    return true;
+  }
+  // Read the generation before the update, so a concurrent load triggers another update
+  if (updateUriRangeTable() != HSA_STATUS_SUCCESS) {
+    rangeTab_.Clear();
+    init_ = false;
+    return false;
+  }
+  generation_ = generation;
+  init_ = true;
+  return true;
+}
+
+hsa_status_t UriLocator::updateUriRangeTable() {
+  struct Args {
+    hsa_ven_amd_loader_1_03_pfn_t* fnTab;
+    device::UriRangeTable* rangeTab;
+    std::vector<uint64_t> liveIds;
+  } args{&fn_table_, &rangeTab_, {}};
+
+  auto execCb = [] (hsa_executable_t exec, void *data) -> hsa_status_t {
     int execState = 0;
     hsa_status_t status;
     status = hsa_executable_get_info(exec, HSA_EXECUTABLE_INFO_STATE, &execState);
@@ -41,12 +75,10 @@ hsa_status_t UriLocator::createUriRangeTable() {
        uint64_t loadBAddr = 0, loadSize = 0;
        uint32_t uriLen = 0;
        int64_t delta = 0;
-       uint64_t *argsCb = static_cast<uint64_t *>(data);
-       hsa_ven_amd_loader_1_03_pfn_t *fnTab =
-         reinterpret_cast<hsa_ven_amd_loader_1_03_pfn_t*> (argsCb[0]);
-       std::vector<UriRange> *rangeTab =
-         reinterpret_cast<std::vector<UriRange>*> (argsCb[1]);
+       Args* argsCb = static_cast<Args*>(data);
+       hsa_ven_amd_loader_1_03_pfn_t* fnTab = argsCb->fnTab;
 
+       argsCb->liveIds.push_back(lcobj.handle);
        if (!fnTab->hsa_ven_amd_loader_loaded_code_object_get_info)
          return HSA_STATUS_ERROR;
 
@@ -59,6 +91,14 @@ hsa_status_t UriLocator::createUriRangeTable() {
          HSA_VEN_AMD_LOADER_LOADED_CODE_OBJECT_INFO_LOAD_SIZE, (void*) &loadSize);
        if (result != HSA_STATUS_SUCCESS)
          return result;
+       if (loadSize == 0)
+         return HSA_STATUS_SUCCESS;
+
+       // Code objects are immutable after the freeze, so only the new ones are queried.
+       // A reused handle with a different range belongs to a new code object
+       if (argsCb->rangeTab->Contains(lcobj.handle, loadBAddr, loadBAddr + loadSize - 1))
+         return HSA_STATUS_SUCCESS;
+       argsCb->rangeTab->Remove(lcobj.handle);
 
        result = fnTab->hsa_ven_amd_loader_loaded_code_object_get_info(lcobj,
          HSA_VEN_AMD_LOADER_LOADED_CODE_OBJECT_INFO_URI_LENGTH, (void*) &uriLen);
@@ -70,112 +110,78 @@ hsa_status_t UriLocator::createUriRangeTable() {
        if (result != HSA_STATUS_SUCCESS)
          return result;
 
-       char *uri = new char[uriLen+1];
-       uri[uriLen] = '\0';
+       std::string uri(uriLen, '\0');
        result = fnTab->hsa_ven_amd_loader_loaded_code_object_get_info(lcobj,
-         HSA_VEN_AMD_LOADER_LOADED_CODE_OBJECT_INFO_URI, (void*) uri);
+         HSA_VEN_AMD_LOADER_LOADED_CODE_OBJECT_INFO_URI, (void*) uri.data());
        if (result != HSA_STATUS_SUCCESS)
          return result;
-       rangeTab->push_back(UriRange{loadBAddr, loadBAddr+loadSize-1,
-          delta, std::string{uri,uriLen+1}});
-       delete[] uri;
+       argsCb->rangeTab->Insert(device::UriRangeTable::Range{loadBAddr,
+          loadBAddr + loadSize - 1, delta, lcobj.handle, std::move(uri)});
        return HSA_STATUS_SUCCESS;
    };
 
-   uint64_t *args = static_cast<uint64_t *>(data);
-   hsa_ven_amd_loader_1_03_pfn_t *fnExtTab =
-     reinterpret_cast<hsa_ven_amd_loader_1_03_pfn_t*> (args[0]);
-   return fnExtTab->hsa_ven_amd_loader_executable_iterate_loaded_code_objects(exec,
+   Args* args = static_cast<Args*>(data);
+   return args->fnTab->hsa_ven_amd_loader_executable_iterate_loaded_code_objects(exec,
          loadedCodeObjectCb, data);
   };
 
-  if (!fn_table_.hsa_ven_amd_loader_iterate_executables)
+  if (!fn_table_.hsa_ven_amd_loader_iterate_executables ||
+      !fn_table_.hsa_ven_amd_loader_executable_iterate_loaded_code_objects)
     return HSA_STATUS_ERROR;
 
-  uint64_t callbackArgs[2] = {(uint64_t)& fn_table_, (uint64_t) &rangeTab_};
-  return fn_table_.hsa_ven_amd_loader_iterate_executables(execCb, (void*) callbackArgs);
+  hsa_status_t result = fn_table_.hsa_ven_amd_loader_iterate_executables(execCb, &args);
+  if (result != HSA_STATUS_SUCCESS)
+    return result;
+  // Drop the code objects of the destroyed executables
+  std::sort(args.liveIds.begin(), args.liveIds.end());
+  rangeTab_.Retain(args.liveIds);
+  return HSA_STATUS_SUCCESS;
 }
 
-// Encoding of uniform-resource-identifier(URI) is detailed in
-// https://llvm.org/docs/AMDGPUUsage.html#loaded-code-object-path-uniform-resource-identifier-uri
 std::pair<uint64_t, uint64_t> UriLocator::decodeUriAndGetFd(UriInfo& uri,
     amd::Os::FileDesc* uri_fd) {
-  std::ostringstream ss;
-  char cur;
-  uint64_t offset = 0, size = 0;
   if (uri.uriPath.size() == 0)
     return {0,0};
-  auto pos = uri.uriPath.find("//");
-  if (pos == std::string::npos) {
-    uri.uriPath="";
-    return {0,0};
-  }
-  auto rspos = uri.uriPath.find('#');
-  if (rspos != std::string::npos) {
-   //parse range specifier
-   std::string offprefix = "offset=", sizeprefix = "size=";
-   auto sbeg = uri.uriPath.find('&',rspos);
-   auto offbeg = rspos + offprefix.size()+1;
-   std::string offstr = uri.uriPath.substr(offbeg, sbeg - offbeg);
-   auto sizebeg = sbeg + sizeprefix.size()+1;
-   std::string sizestr = uri.uriPath.substr(sizebeg, uri.uriPath.size()-sizebeg);
-   offset = std::stoull(offstr, nullptr, 0);
-   size   = std::stoull(sizestr, nullptr, 0);
-   rspos -= 1;
-  }
-  else {
-   rspos = uri.uriPath.size()-1;
-  }
-  if (uri.uriPath.substr(0, pos) == "file:") {
-    pos += 2;
-    // decode filepath
-    for (auto i = pos; i <= rspos;) {
-      cur = uri.uriPath[i];
-      if (isalnum(cur) || cur == '/' || cur == '-' || cur == '_' || cur == '.' || cur == '~') {
-        ss << cur;
-        i++;
-      } else {
-        // characters prefix with '%' char
-        char tbits = uri.uriPath[i + 1], lbits = uri.uriPath[i + 2];
-        uint8_t t = (tbits < 58) ? (tbits - 48) : ((tbits - 65) + 10);
-        uint8_t l = (lbits < 58) ? (lbits - 48) : ((lbits - 65) + 10);
-        ss << (char)(((0b00000000 | t) << 4) | l);
-        i += 3;
-      }
+
+  amd::ScopedLock lock(lock_);
+  auto it = uriCache_.find(uri.uriPath);
+  if (it == uriCache_.end()) {
+    UriFile file{{}, amd::Os::FDescInit(), 0};
+    if (!device::DecodeUri(uri.uriPath, &file.decoded_)) {
+      uri.uriPath = "";
+      return {0,0};
     }
-    uri.uriPath = ss.str();
-    size_t fd_size;
-    (void)amd::Os::GetFileHandle(uri.uriPath.c_str(), uri_fd, &fd_size);
+    // The file stays open for the following reports and is closed with the locator
+    if (!file.decoded_.path_.empty()) {
+      (void)amd::Os::GetFileHandle(file.decoded_.path_.c_str(), &file.fd_, &file.file_size_);
+    }
+    it = uriCache_.emplace(uri.uriPath, std::move(file)).first;
+  }
+
+  const UriFile& file = it->second;
+  uint64_t size = file.decoded_.size_;
+  if (!file.decoded_.path_.empty()) {
+    uri.uriPath = file.decoded_.path_;
+    *uri_fd = file.fd_;
     // As per URI locator syntax, range_specifier is optional
     // if range_specifier is absent return total size of the file
     // and set offset to begin at 0.
-    if (size == 0) size = fd_size;
+    if (size == 0) size = file.file_size_;
   }
-  return {offset, size};
+  return {file.decoded_.offset_, size};
 }
 
 UriLocator::UriInfo UriLocator::lookUpUri(uint64_t device_pc) {
   UriInfo errorstate{"", 0};
 
-  if (!init_) {
-    hsa_status_t result;
-    result = hsa_system_get_major_extension_table(HSA_EXTENSION_AMD_LOADER, 1,
-        sizeof(fn_table_), &fn_table_);
-    if (result != HSA_STATUS_SUCCESS)
-      return errorstate;
-    result = createUriRangeTable();
-    if (result != HSA_STATUS_SUCCESS) {
-      rangeTab_.clear();
-      return errorstate;
-    }
-    init_ = true;
-  }
-
-  for(auto& seg : rangeTab_)
-    if (seg.startAddr_ <= device_pc && device_pc <= seg.endAddr_)
-     return UriInfo{seg.Uri_.c_str(), seg.elfDelta_};
+  amd::ScopedLock lock(lock_);
+  if (!init())
+    return errorstate;
 
-  return errorstate;
+  const device::UriRangeTable::Range* range = rangeTab_.Find(device_pc);
+  if (range == nullptr)
+    return errorstate;
+  return UriInfo{range->uri_, range->elf_delta_};
 }
 } //namespace amd::roc
 #endif
@@ -22,23 +22,34 @@
 #if defined(__clang__)
 #if __has_feature(address_sanitizer)
 #include "device/devurilocator.hpp"
+#include "device/devurirange.hpp"
+#include "thread/monitor.hpp"
 #include "hsa/hsa_ven_amd_loader.h"
 
+#include <string>
+#include <unordered_map>
 #include <vector>
 namespace amd::roc {
 class UriLocator : public device::UriLocator {
-  bool init_ = false;
-  struct UriRange {
-    uint64_t startAddr_, endAddr_;
-    int64_t elfDelta_;
-    std::string  Uri_;
+  //! Decoded URI and its opened file, which are reused by the following reports
+  struct UriFile {
+    device::DecodedUri decoded_;
+    amd::Os::FileDesc fd_;
+    size_t file_size_;
   };
-  std::vector<UriRange> rangeTab_;
+
+  bool init_ = false;
+  uint32_t generation_ = 0;             //!< Generation of the code objects in the table
+  device::UriRangeTable rangeTab_;
+  std::unordered_map<std::string, UriFile> uriCache_;
   hsa_ven_amd_loader_1_03_pfn_t fn_table_;
+  amd::Monitor lock_{};
 
-  hsa_status_t createUriRangeTable();
+  bool init();
+  //! Adds the new code objects to the table and removes the unloaded ones
+  hsa_status_t updateUriRangeTable();
   public:
-   virtual ~UriLocator() {}
+   virtual ~UriLocator();
    virtual UriInfo lookUpUri(uint64_t device_pc) override;
    virtual std::pair<uint64_t, uint64_t> decodeUriAndGetFd(UriInfo& uri_path,
      amd::Os::FileDesc* uri_fd) override;
@@ -610,6 +610,8 @@ std::vector<hsa_signal_t>& VirtualGPU::HwQueueTracker::WaitingSignal(HwQueueEngi
 
 // ================================================================================================
 bool VirtualGPU::HwQueueTracker::CpuWaitForSignal(ProfilingSignal* signal) {
+  // The packets of a submission batch may still wait for the doorbell
+  const_cast<VirtualGPU&>(gpu_).flushDoorbell();
   // Wait for the current signal
   if (signal->ts_ != nullptr) {
     // Update timestamp values if requested
@@ -1008,6 +1010,7 @@ bool VirtualGPU::dispatchGenericAqlPacket(
 
   // Make sure the slot is free for usage
   while ((index - hsa_queue_load_read_index_scacquire(gpu_queue_)) >= sw_queue_size) {
+    flushDoorbell();
     amd::Os::yield();
   }
 
@@ -1053,7 +1056,8 @@ bool VirtualGPU::dispatchGenericAqlPacket(
           reinterpret_cast<hsa_kernel_dispatch_packet_t*>(packet)->reserved2, read,
           index);
 
-  hsa_signal_store_screlease(gpu_queue_->doorbell_signal, index);
+  ringDoorbell(index);
+  SampleQueueLoad();
 
   // Mark the flag indicating if a dispatch is outstanding.
   // We are not waiting after every dispatch.
@@ -1201,13 +1205,15 @@ void VirtualGPU::dispatchBarrierPacket(uint16_t packetHeader, bool skipSignal,
     fence_dirty_ = false;
   }
 
-  while ((index - hsa_queue_load_read_index_scacquire(gpu_queue_)) >= queueMask);
+  while ((index - hsa_queue_load_read_index_scacquire(gpu_queue_)) >= queueMask) {
+    flushDoorbell();
+  }
   hsa_barrier_and_packet_t* aql_loc =
     &(reinterpret_cast<hsa_barrier_and_packet_t*>(gpu_queue_->base_address))[index & queueMask];
   *aql_loc = barrier_packet_;
   __atomic_store_n(reinterpret_cast<uint32_t*>(aql_loc), packetHeader, __ATOMIC_RELEASE);
 
-  hsa_signal_store_screlease(gpu_queue_->doorbell_signal, index);
+  ringDoorbell(index);
   ClPrint(amd::LOG_DEBUG, amd::LOG_AQL,
           "SWq=0x%zx, HWq=0x%zx, id=%d, BarrierAND Header = 0x%x (type=%d, barrier=%d, acquire=%d,"
           " release=%d), "
@@ -1291,13 +1297,15 @@ void VirtualGPU::dispatchBarrierValuePacket(uint16_t packetHeader, bool resolveD
   uint64_t index = hsa_queue_add_write_index_screlease(gpu_queue_, 1);
   uint64_t read = hsa_queue_load_read_index_relaxed(gpu_queue_);
 
-  while ((index - hsa_queue_load_read_index_scacquire(gpu_queue_)) >= queueMask);
+  while ((index - hsa_queue_load_read_index_scacquire(gpu_queue_)) >= queueMask) {
+    flushDoorbell();
+  }
   hsa_amd_barrier_value_packet_t* aql_loc = &(reinterpret_cast<hsa_amd_barrier_value_packet_t*>(
       gpu_queue_->base_address))[index & queueMask];
   *aql_loc = barrier_value_packet_;
   packet_store_release(reinterpret_cast<uint32_t*>(aql_loc), packetHeader, rest);
 
-  hsa_signal_store_screlease(gpu_queue_->doorbell_signal, index);
+  ringDoorbell(index);
 
   ClPrint(amd::LOG_DEBUG, amd::LOG_AQL,
           "SWq=0x%zx, HWq=0x%zx, id=%d, BarrierValue Header = 0x%x AmdFormat = 0x%x "
@@ -1367,6 +1375,7 @@ VirtualGPU::VirtualGPU(Device& device, bool profiling, bool cooperative,
       barriers_(*this),
       managed_buffer_(*this, ManagedBuffer::kPoolNumSignals * device.settings().stagedXferSize_),
       managed_kernarg_buffer_(*this, device.settings().kernargPoolSize_),
+      read_staging_(*this, amd::alignUp(device.settings().stagedXferSize_, 4 * Ki)),
       cuMask_(cuMask),
       priority_(priority),
       copy_command_type_(0),
@@ -1416,6 +1425,16 @@ VirtualGPU::VirtualGPU(Device& device, bool profiling, bool cooperative,
 
 // ================================================================================================
 VirtualGPU::~VirtualGPU() {
+  if ((aqlTemplateHits_ + aqlTemplateMisses_) != 0) {
+    auto avg = [this](uint32_t i) -> unsigned long long {
+      return (aqlSetupSamples_[i] != 0) ? (aqlSetupNs_[i] / aqlSetupSamples_[i]) : 0;
+    };
+    unsigned long long saved = (avg(0) > avg(1)) ? ((avg(0) - avg(1)) * aqlTemplateHits_) : 0;
+    ClPrint(amd::LOG_INFO, amd::LOG_KERN, "VGPU(%p) dispatch templates: %llu hits, %llu misses, "
+            "launch setup %llu ns (hit) vs %llu ns (miss), saved ~%llu us", this,
+            static_cast<unsigned long long>(aqlTemplateHits_),
+            static_cast<unsigned long long>(aqlTemplateMisses_), avg(1), avg(0), saved / 1000);
+  }
   delete blitMgr_;
 
   if (tracking_created_) {
@@ -1437,6 +1456,10 @@ VirtualGPU::~VirtualGPU() {
     hsa_signal_destroy(schedulerSignal_);
   }
 
+  if (0 != timeline_.signal().signal_.handle) {
+    hsa_signal_destroy(timeline_.signal().signal_);
+  }
+
   if (nullptr != schedulerQueue_) {
     hsa_queue_destroy(schedulerQueue_);
   }
@@ -1475,6 +1498,8 @@ bool VirtualGPU::create() {
     return false;
   }
 
+  aqlTemplates_.resize(DEBUG_CLR_AQL_TEMPLATE_CACHE);
+
   device::BlitManager::Setup blitSetup;
   blitMgr_ = new KernelBlitManager(*this, blitSetup);
   if ((nullptr == blitMgr_) || !blitMgr_->create(roc_device_)) {
@@ -1589,6 +1614,7 @@ address VirtualGPU::ManagedBuffer::Acquire(uint32_t size, uint32_t alignment) {
     // Get the next chunk
     active_chunk_ = ++active_chunk_ % kPoolNumSignals;
     // Make sure the new active chunk is free
+    gpu_.flushDoorbell();
     bool test = WaitForSignal(pool_signal_[active_chunk_], gpu_.ActiveWait());
     assert(test && "Runtime can't fail a wait for chunk!");
     // Make sure the current offset matches the new chunk to avoid possible overlaps
@@ -1610,6 +1636,75 @@ void VirtualGPU::ManagedBuffer::ResetPool() {
   active_chunk_ = 0;
 }
 
+// ================================================================================================
+VirtualGPU::StagingRing::~StagingRing() {
+  for (auto& slot : slots_) {
+    if (slot.buffer_ != nullptr) {
+      gpu_.dev().hostFree(slot.buffer_, buf_size_);
+    }
+  }
+  if (stats_.transfers_ != 0) {
+    ClPrint(amd::LOG_INFO, amd::LOG_COPY, "Staged reads: %llu, bytes: %llu, wait: %llu us, "
+            "allocs: %llu, frees: %llu", static_cast<unsigned long long>(stats_.transfers_),
+            static_cast<unsigned long long>(stats_.bytes_),
+            static_cast<unsigned long long>(stats_.wait_ns_ / 1000),
+            static_cast<unsigned long long>(stats_.allocs_),
+            static_cast<unsigned long long>(stats_.frees_));
+  }
+}
+
+// ================================================================================================
+address VirtualGPU::StagingRing::Acquire() {
+  Slot& slot = slots_[next_];
+  next_ = (next_ + 1) % kNumSlots;
+  if (slot.buffer_ == nullptr) {
+    slot.buffer_ = reinterpret_cast<address>(
+        gpu_.dev().hostAlloc(buf_size_, 1, Device::MemorySegment::kNoAtomics));
+    if (slot.buffer_ == nullptr) {
+      LogError("Couldn't allocate a staging buffer!");
+      return nullptr;
+    }
+    stats_.allocs_++;
+    gpu_.dev().stagingStats().allocs_.fetch_add(1, std::memory_order_relaxed);
+  }
+  slot.last_use_ = amd::Os::timeNanos();
+  return slot.buffer_;
+}
+
+// ================================================================================================
+bool VirtualGPU::StagingRing::Wait(ProfilingSignal* signal) {
+  uint64_t start = amd::Os::timeNanos();
+  bool result = gpu_.Barriers().WaitSignal(signal);
+  wait_ns_ += amd::Os::timeNanos() - start;
+  return result;
+}
+
+// ================================================================================================
+void VirtualGPU::StagingRing::End(size_t bytes) {
+  stats_.transfers_++;
+  stats_.bytes_ += bytes;
+  stats_.wait_ns_ += wait_ns_;
+  gpu_.dev().stagingStats().bytes_.fetch_add(bytes, std::memory_order_relaxed);
+  gpu_.dev().stagingStats().wait_ns_.fetch_add(wait_ns_, std::memory_order_relaxed);
+  wait_ns_ = 0;
+
+  // All copies of the transfer are complete, hence the buffers are safe to release
+  ReleaseIdle();
+}
+
+// ================================================================================================
+void VirtualGPU::StagingRing::ReleaseIdle() {
+  const uint64_t now = amd::Os::timeNanos();
+  const uint64_t timeout = static_cast<uint64_t>(DEBUG_CLR_STAGING_IDLE_TIMEOUT) * 1000 * 1000;
+  for (auto& slot : slots_) {
+    if ((slot.buffer_ != nullptr) && ((now - slot.last_use_) > timeout)) {
+      gpu_.dev().hostFree(slot.buffer_, buf_size_);
+      slot.buffer_ = nullptr;
+      stats_.frees_++;
+    }
+  }
+}
+
 // ================================================================================================
 void* VirtualGPU::allocKernArg(size_t size, size_t alignment) {
   return managed_kernarg_buffer_.Acquire(size, alignment);
@@ -2008,20 +2103,32 @@ void VirtualGPU::submitSvmPrefetchAsync(amd::SvmPrefetchAsyncCommand& cmd) {
   if (dev().info().hmmSupported_) {
     // Initialize signal for the barrier
     auto wait_events = Barriers().WaitingSignal(HwQueueEngine::Unknown);
-    hsa_signal_t active = Barriers().ActiveSignal(kInitSignalValueOne, timestamp_);
+    // The ranges are disjoint, so all prefetches run concurrently and decrement the same signal
+    const auto& ranges = cmd.ranges();
+    hsa_signal_t active = Barriers().ActiveSignal(ranges.size(), timestamp_);
 
     // Find the requested agent for the transfer
     hsa_agent_t agent = (cmd.cpu_access() ||
         (dev().settings().hmmFlags_ & Settings::Hmm::EnableSystemMemory)) ?
         dev().getCpuAgent() : (static_cast<const roc::Device*>(cmd.device()))->getBackendDevice();
 
-    // Initiate a prefetch command
-    hsa_status_t status = hsa_amd_svm_prefetch_async(
-        const_cast<void*>(cmd.dev_ptr()), cmd.count(), agent,
-        wait_events.size(), wait_events.data(), active);
+    // Initiate the prefetch of all ranges
+    hsa_status_t status = HSA_STATUS_SUCCESS;
+    size_t issued = 0;
+    for (; (issued < ranges.size()) && (status == HSA_STATUS_SUCCESS); ++issued) {
+      status = hsa_amd_svm_prefetch_async(
+          const_cast<void*>(ranges[issued].first), ranges[issued].second, agent,
+          wait_events.size(), wait_events.data(), active);
+    }
+    if (status != HSA_STATUS_SUCCESS) {
+      // Account for the failed and not issued ranges, but still wait for the issued ones
+      hsa_signal_subtract_relaxed(active,
+                                  static_cast<hsa_signal_value_t>(ranges.size() - issued + 1));
+    }
 
     // Wait for the prefetch. Should skip wait, but may require extra tracking for kernel execution
-    if ((status != HSA_STATUS_SUCCESS) || !Barriers().WaitCurrent()) {
+    bool completed = Barriers().WaitCurrent();
+    if ((status != HSA_STATUS_SUCCESS) || !completed) {
       Barriers().ResetCurrentSignal();
       LogError("hsa_amd_svm_prefetch_async failed");
       cmd.setStatus(CL_INVALID_OPERATION);
@@ -3203,6 +3310,70 @@ static inline void nontemporalMemcpy(
 
 void VirtualGPU::HiddenHeapInit() { const_cast<Device&>(dev()).HiddenHeapInit(*this); }
 
+// ================================================================================================
+// Returns true if the hidden argument depends only on the launch geometry and the queue
+static bool IsStaticHiddenArg(uint32_t type) {
+  switch (type) {
+    case amd::KernelParameterDescriptor::HiddenGlobalOffsetX:
+    case amd::KernelParameterDescriptor::HiddenGlobalOffsetY:
+    case amd::KernelParameterDescriptor::HiddenGlobalOffsetZ:
+    case amd::KernelParameterDescriptor::HiddenHostcallBuffer:
+    case amd::KernelParameterDescriptor::HiddenBlockCountX:
+    case amd::KernelParameterDescriptor::HiddenBlockCountY:
+    case amd::KernelParameterDescriptor::HiddenBlockCountZ:
+    case amd::KernelParameterDescriptor::HiddenGroupSizeX:
+    case amd::KernelParameterDescriptor::HiddenGroupSizeY:
+    case amd::KernelParameterDescriptor::HiddenGroupSizeZ:
+    case amd::KernelParameterDescriptor::HiddenRemainderX:
+    case amd::KernelParameterDescriptor::HiddenRemainderY:
+    case amd::KernelParameterDescriptor::HiddenRemainderZ:
+    case amd::KernelParameterDescriptor::HiddenGridDims:
+    case amd::KernelParameterDescriptor::HiddenPrivateBase:
+    case amd::KernelParameterDescriptor::HiddenSharedBase:
+    case amd::KernelParameterDescriptor::HiddenQueuePtr:
+    case amd::KernelParameterDescriptor::HiddenDynamicLdsSize:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// ================================================================================================
+AqlTemplate* VirtualGPU::findAqlTemplate(const device::Kernel* kernel,
+                                         const amd::NDRangeContainer& sizes,
+                                         uint32_t sharedMemBytes, bool coopGroups) {
+  if (aqlTemplates_.empty()) {
+    return nullptr;
+  }
+  // A destroyed kernel invalidates all templates, since a new kernel can get the same address
+  uint64_t generation = roc_device_.KernelGeneration();
+  if (generation != aqlTemplateGeneration_) {
+    for (auto& it : aqlTemplates_) {
+      it.kernel_ = nullptr;
+    }
+    aqlTemplateGeneration_ = generation;
+    return nullptr;
+  }
+  for (auto& it : aqlTemplates_) {
+    if (it.Match(kernel, sizes, sharedMemBytes, coopGroups, gpu_queue_, dev().StackSize())) {
+      return &it;
+    }
+  }
+  return nullptr;
+}
+
+// ================================================================================================
+AqlTemplate* VirtualGPU::allocAqlTemplate() {
+  if (aqlTemplates_.empty()) {
+    return nullptr;
+  }
+  // Round-robin replacement, the same geometry is usually relaunched back to back
+  AqlTemplate* slot = &aqlTemplates_[aqlTemplateNext_];
+  aqlTemplateNext_ = (aqlTemplateNext_ + 1) % aqlTemplates_.size();
+  slot->kernel_ = nullptr;
+  return slot;
+}
+
 // ================================================================================================
 bool VirtualGPU::submitKernelInternal(const amd::NDRangeContainer& sizes,
     const amd::Kernel& kernel, const_address parameters, void* event_handle,
@@ -3272,13 +3443,37 @@ bool VirtualGPU::submitKernelInternal(const amd::NDRangeContainer& sizes,
     ClPrint(amd::LOG_INFO, amd::LOG_KERN, "ShaderName : %s",
             gpuKernel.getDemangledName().c_str());
 
+    // The split launches of the internal kernels change the geometry, so skip the templates
+    AqlTemplate* aqlTemplate = (dim == -1) ?
+        findAqlTemplate(devKernel, sizes, sharedMemBytes, coopGroups) : nullptr;
+    const uint32_t setupIndex = (aqlTemplate != nullptr) ? 1 : 0;
+    const bool sampleSetup =
+        (((aqlTemplateHits_ + aqlTemplateMisses_) % kAqlSetupSampleRate) == 0);
+    const uint64_t setupStart = sampleSetup ? amd::Os::timeNanos() : 0;
+
     amd::NDRange local(sizes.local());
     address hidden_arguments = const_cast<address>(parameters);
-    // Calculate local size if it wasn't provided
-    devKernel->FindLocalWorkSize(sizes.dimensions(), sizes.global(), local);
+    uint32_t numHidden = signature.numParametersAll() - signature.numParameters();
+    if (aqlTemplate != nullptr) {
+      for (uint i = 0; i < sizes.dimensions(); i++) {
+        local[i] = aqlTemplate->groupSize_[i];
+      }
+      // Restore the static hidden arguments, only the rest is processed below
+      const uint8_t* value = aqlTemplate->hidden_.data();
+      for (const auto& span : aqlTemplate->spans_) {
+        memcpy(hidden_arguments + span.first, value, span.second);
+        value += span.second;
+      }
+      numHidden = aqlTemplate->dynamic_.size();
+    } else {
+      // Calculate local size if it wasn't provided
+      devKernel->FindLocalWorkSize(sizes.dimensions(), sizes.global(), local);
+    }
 
     // Check if runtime has to setup hidden arguments
-    for (uint32_t i = signature.numParameters(); i < signature.numParametersAll(); ++i) {
+    for (uint32_t h = 0; h < numHidden; ++h) {
+      const uint32_t i = (aqlTemplate != nullptr) ? aqlTemplate->dynamic_[h] :
+                                                    (signature.numParameters() + h);
       const auto& it = signature.at(i);
       switch (it.info_.oclObject_) {
         case amd::KernelParameterDescriptor::HiddenNone:
@@ -3519,29 +3714,78 @@ bool VirtualGPU::submitKernelInternal(const amd::NDRangeContainer& sizes,
 
     // Initialize the dispatch Packet
     hsa_kernel_dispatch_packet_t dispatchPacket;
-    memset(&dispatchPacket, 0, sizeof(dispatchPacket));
+    if (aqlTemplate != nullptr) {
+      dispatchPacket = aqlTemplate->packet_;
+      aqlTemplateHits_++;
+    } else {
+      memset(&dispatchPacket, 0, sizeof(dispatchPacket));
+
+      dispatchPacket.header = kInvalidAql;
+      dispatchPacket.kernel_object = gpuKernel.KernelCodeHandle();
 
-    dispatchPacket.header = kInvalidAql;
-    dispatchPacket.kernel_object = gpuKernel.KernelCodeHandle();
+      // dispatchPacket.header = aqlHeader_;
+      // dispatchPacket.setup |= sizes.dimensions() << HSA_KERNEL_DISPATCH_PACKET_SETUP_DIMENSIONS;
+      dispatchPacket.grid_size_x = sizes.dimensions() > 0 ? newGlobalSize[0] : 1;
+      dispatchPacket.grid_size_y = sizes.dimensions() > 1 ? newGlobalSize[1] : 1;
+      dispatchPacket.grid_size_z = sizes.dimensions() > 2 ? newGlobalSize[2] : 1;
 
-    // dispatchPacket.header = aqlHeader_;
-    // dispatchPacket.setup |= sizes.dimensions() << HSA_KERNEL_DISPATCH_PACKET_SETUP_DIMENSIONS;
-    dispatchPacket.grid_size_x = sizes.dimensions() > 0 ? newGlobalSize[0] : 1;
-    dispatchPacket.grid_size_y = sizes.dimensions() > 1 ? newGlobalSize[1] : 1;
-    dispatchPacket.grid_size_z = sizes.dimensions() > 2 ? newGlobalSize[2] : 1;
+      dispatchPacket.workgroup_size_x = sizes.dimensions() > 0 ? local[0] : 1;
+      dispatchPacket.workgroup_size_y = sizes.dimensions() > 1 ? local[1] : 1;
+      dispatchPacket.workgroup_size_z = sizes.dimensions() > 2 ? local[2] : 1;
 
-    dispatchPacket.workgroup_size_x = sizes.dimensions() > 0 ? local[0] : 1;
-    dispatchPacket.workgroup_size_y = sizes.dimensions() > 1 ? local[1] : 1;
-    dispatchPacket.workgroup_size_z = sizes.dimensions() > 2 ? local[2] : 1;
+      dispatchPacket.private_segment_size = devKernel->workGroupInfo()->privateMemSize_;
+
+      if ((devKernel->workGroupInfo()->usedStackSize_ & 0x1) == 0x1) {
+        dispatchPacket.private_segment_size = std::min<uint64_t>(
+            std::max<uint64_t>(dev().StackSize(), dispatchPacket.private_segment_size),
+            Device::kMaxStackSize);
+      }
+
+      AqlTemplate* slot = (dim == -1) ? allocAqlTemplate() : nullptr;
+      if (slot != nullptr) {
+        slot->queue_ = gpu_queue_;
+        slot->dimensions_ = sizes.dimensions();
+        for (uint i = 0; i < sizes.dimensions(); i++) {
+          slot->global_[i] = sizes.global()[i];
+          slot->local_[i] = sizes.local()[i];
+          slot->offset_[i] = sizes.offset()[i];
+          slot->groupSize_[i] = local[i];
+        }
+        slot->sharedMemBytes_ = sharedMemBytes;
+        slot->stackSize_ = dev().StackSize();
+        slot->coopGroups_ = coopGroups;
+        slot->packet_ = dispatchPacket;
+        // Keep the values of the static hidden arguments, merging the adjacent ones
+        slot->spans_.clear();
+        slot->hidden_.clear();
+        slot->dynamic_.clear();
+        for (uint32_t i = signature.numParameters(); i < signature.numParametersAll(); ++i) {
+          const auto& it = signature.at(i);
+          if (IsStaticHiddenArg(it.info_.oclObject_)) {
+            if (!slot->spans_.empty() &&
+                ((slot->spans_.back().first + slot->spans_.back().second) == it.offset_)) {
+              slot->spans_.back().second += it.size_;
+            } else {
+              slot->spans_.push_back({static_cast<uint32_t>(it.offset_),
+                                      static_cast<uint32_t>(it.size_)});
+            }
+            slot->hidden_.insert(slot->hidden_.end(), hidden_arguments + it.offset_,
+                                 hidden_arguments + it.offset_ + it.size_);
+          } else if (it.info_.oclObject_ != amd::KernelParameterDescriptor::HiddenNone) {
+            slot->dynamic_.push_back(i);
+          }
+        }
+        slot->kernel_ = devKernel;
+      }
+      aqlTemplateMisses_++;
+    }
 
     dispatchPacket.kernarg_address = argBuffer;
     dispatchPacket.group_segment_size = ldsUsage + sharedMemBytes;
-    dispatchPacket.private_segment_size = devKernel->workGroupInfo()->privateMemSize_;
 
-    if ((devKernel->workGroupInfo()->usedStackSize_ & 0x1) == 0x1) {
-      dispatchPacket.private_segment_size = std::min<uint64_t>(
-          std::max<uint64_t>(dev().StackSize(), dispatchPacket.private_segment_size),
-          Device::kMaxStackSize);
+    if (sampleSetup) {
+      aqlSetupNs_[setupIndex] += amd::Os::timeNanos() - setupStart;
+      aqlSetupSamples_[setupIndex]++;
     }
 
     // Pass the header accordingly
@@ -3727,6 +3971,71 @@ void VirtualGPU::submitMarker(amd::Marker& vcmd) {
   }
 }
 
+// ================================================================================================
+uint64_t VirtualGPU::AdvanceTimeline() {
+  // Make sure VirtualGPU has an exclusive access to the resources
+  amd::ScopedLock lock(execution());
+
+  hsa_signal_t& signal = timeline_.signal().signal_;
+  if (signal.handle == 0) {
+    // The signal is created on the first use, since most queues never track a timeline
+    if (HSA_STATUS_SUCCESS !=
+        hsa_signal_create(TimelineSignal::kInitValue, 0, nullptr, &signal)) {
+      signal.handle = 0;
+      return 0;
+    }
+  }
+  uint64_t value = timeline_.Advance();
+  // The barrier bit retires the packet after all previous packets in the queue
+  dispatchBarrierPacket(kBarrierPacketHeader, false, signal);
+  // The barrier completes the timeline signal only, the HW queue tracker doesn't see it.
+  // Keep the pending dispatch state, so the next wait sends a tracked barrier
+  return value;
+}
+
+// ================================================================================================
+void VirtualGPU::RebalanceQueue() {
+  // The check samples all queues of the pool, so limit it to a few times per second
+  constexpr uint64_t kRebalanceIntervalNs = 10 * 1000 * 1000;
+  nextRebalance_ = amd::Os::timeNanos() + kRebalanceIntervalNs;
+  // The caller saw the last command complete. Timeline barriers don't have commands, so make
+  // sure they retired too. The other users of the shared HW queue can still have packets in
+  // flight, but with all own work retired the new HW queue keeps the timeline order
+  if (!timeline_.IsComplete(timeline_.Submitted())) {
+    return;
+  }
+  hsa_queue_t* queue = roc_device_.rebalanceQueue(gpu_queue_, priority_);
+  if (queue != nullptr) {
+    ClPrint(amd::LOG_INFO, amd::LOG_QUEUE, "VGPU(%p) moved from HWq=%p to HWq=%p", this,
+            gpu_queue_->base_address, queue->base_address);
+    gpu_queue_ = queue;
+  }
+}
+
+// ================================================================================================
+void VirtualGPU::ParkQueue() {
+  if (gpu_queue_ == nullptr) {
+    return;
+  }
+  // Timeline barriers don't have commands, so make sure they retired before the queue goes
+  timeline_.Wait(timeline_.Submitted());
+  ClPrint(amd::LOG_INFO, amd::LOG_QUEUE, "VGPU(%p) parked, released HWq=%p", this,
+          gpu_queue_->base_address);
+  amd::ScopedLock lock(roc_device_.vgpusAccess());
+  roc_device_.releaseQueue(gpu_queue_, cuMask_, cooperative_);
+  gpu_queue_ = nullptr;
+}
+
+// ================================================================================================
+bool VirtualGPU::UnparkQueue() {
+  if (gpu_queue_ != nullptr) {
+    return true;
+  }
+  amd::ScopedLock lock(roc_device_.vgpusAccess());
+  gpu_queue_ = roc_device_.acquireQueue(ROC_AQL_QUEUE_SIZE, cooperative_, cuMask_, priority_);
+  return gpu_queue_ != nullptr;
+}
+
 // ================================================================================================
 void VirtualGPU::submitAccumulate(amd::AccumulateCommand& vcmd) {
   // Make sure VirtualGPU has an exclusive access to the resources
@@ -3770,6 +4079,10 @@ void VirtualGPU::flush(amd::Command* list, bool wait) {
 
   // Release all pinned memory
   releasePinnedMem();
+
+  // The queue is idle, so the staging buffers of a queue, which stopped reading, don't wait
+  // for the next staged transfer to be released
+  read_staging_.ReleaseIdle();
 }
 
 // ================================================================================================
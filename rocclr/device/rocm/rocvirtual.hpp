@@ -31,6 +31,7 @@
 #include "hsa/hsa_ven_amd_aqlprofile.h"
 #include "rocsched.hpp"
 #include "device/device.hpp"
+#include "thread/timeline.hpp"
 #include <stack>
 
 namespace amd::roc {
@@ -73,6 +74,72 @@ inline bool WaitForSignal(hsa_signal_t signal, bool active_wait = false) {
   return true;
 }
 
+//! Completion signal of the queue timeline. The packet processor decrements the signal by one
+//! for every retired timeline packet, so the retired count is the distance from the initial value
+struct TimelineSignal {
+  static constexpr hsa_signal_value_t kInitValue =
+      std::numeric_limits<hsa_signal_value_t>::max();
+
+  hsa_signal_t signal_ = {0};
+
+  uint64_t Retired() const {
+    if (signal_.handle == 0) {
+      return 0;
+    }
+    return static_cast<uint64_t>(kInitValue - hsa_signal_load_scacquire(signal_));
+  }
+
+  void WaitRetired(uint64_t count) const {
+    const hsa_signal_value_t target = kInitValue - static_cast<hsa_signal_value_t>(count) + 1;
+    // Active wait with a timeout, the same as a wait for a command
+    if (hsa_signal_wait_scacquire(signal_, HSA_SIGNAL_CONDITION_LT, target, kTimeout100us,
+                                  HSA_WAIT_STATE_ACTIVE) < target) {
+      return;
+    }
+    while (hsa_signal_wait_scacquire(signal_, HSA_SIGNAL_CONDITION_LT, target, kUnlimitedWait,
+                                     HSA_WAIT_STATE_BLOCKED) >= target) {
+    }
+  }
+};
+
+//! Prebuilt dispatch packet and hidden arguments of a kernel launch. A relaunch of the same
+//! kernel with the same geometry copies the template and patches only the per launch fields
+struct AqlTemplate {
+  const device::Kernel* kernel_ = nullptr;  //!< Kernel of the template, nullptr if unused
+  hsa_queue_t* queue_ = nullptr;            //!< HW queue, referenced by the hidden arguments
+  size_t dimensions_ = 0;                   //!< Number of the launch dimensions
+  size_t global_[3] = {};                   //!< Global size
+  size_t local_[3] = {};                    //!< Requested workgroup size, 0 if not provided
+  size_t offset_[3] = {};                   //!< Global offset
+  uint32_t sharedMemBytes_ = 0;             //!< Dynamic LDS size
+  uint64_t stackSize_ = 0;                  //!< Device stack size at the template creation
+  bool coopGroups_ = false;                 //!< Cooperative launch
+
+  size_t groupSize_[3] = {};                //!< Actual workgroup size
+  hsa_kernel_dispatch_packet_t packet_;     //!< Packet without header, kernargs and signal
+  std::vector<std::pair<uint32_t, uint32_t>> spans_;  //!< Offset and size of static hidden args
+  std::vector<uint8_t> hidden_;             //!< Values of the static hidden args
+  std::vector<uint32_t> dynamic_;           //!< Hidden args, which are set for every launch
+
+  //! Returns true if the launch matches the template
+  bool Match(const device::Kernel* kernel, const amd::NDRangeContainer& sizes,
+             uint32_t sharedMemBytes, bool coopGroups, hsa_queue_t* queue,
+             uint64_t stackSize) const {
+    if ((kernel_ != kernel) || (dimensions_ != sizes.dimensions()) || (queue_ != queue) ||
+        (sharedMemBytes_ != sharedMemBytes) || (coopGroups_ != coopGroups) ||
+        (stackSize_ != stackSize)) {
+      return false;
+    }
+    for (size_t i = 0; i < dimensions_; ++i) {
+      if ((global_[i] != sizes.global()[i]) || (local_[i] != sizes.local()[i]) ||
+          (offset_[i] != sizes.offset()[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
 inline void fetchSignalTime(hsa_signal_t signal, hsa_agent_t gpu_device,
                             uint64_t* start, uint64_t* end) {
   if (start != nullptr && end != nullptr) {
@@ -207,6 +274,64 @@ class VirtualGPU : public device::VirtualDevice {
     uint32_t  pool_cur_offset_ = 0;   //!< Current active offset for update
     std::vector<hsa_signal_t> pool_signal_; //!< Pool of HSA signals to manage multiple chunks
   };
+
+  //! Ring of the staging buffers for D2H copies. The ring belongs to the queue, hence
+  //! the buffers are acquired without a lock. Buffers are allocated on demand and released
+  //! after DEBUG_CLR_STAGING_IDLE_TIMEOUT without use, either at the end of the next staged
+  //! transfer or when the queue is flushed.
+  class StagingRing : public amd::EmbeddedObject {
+   public:
+    //! The number of buffers: GPU fills one chunk while CPU drains the previous one
+    static constexpr uint32_t kNumSlots = 2;
+
+    //! Staged read statistics of the queue
+    struct Stats {
+      uint64_t transfers_ = 0;  //!< Number of staged transfers
+      uint64_t bytes_ = 0;      //!< Bytes copied through the staging buffers
+      uint64_t wait_ns_ = 0;    //!< Time CPU waited for the staging copies on GPU
+      uint64_t allocs_ = 0;     //!< Number of the buffer allocations
+      uint64_t frees_ = 0;      //!< Number of the buffer releases due to idle timeout
+    };
+
+    StagingRing(VirtualGPU& gpu, size_t buf_size) : gpu_(gpu), buf_size_(buf_size) {}
+    ~StagingRing();
+
+    //! Starts a new staged transfer from the first buffer in the ring
+    void Begin() { next_ = 0; }
+
+    //! Returns the next buffer in the ring. The caller must wait for the copy,
+    //! issued with the same buffer kNumSlots acquires ago
+    address Acquire();
+
+    //! Waits for the staging copy on GPU and accounts the wait time
+    bool Wait(ProfilingSignal* signal);
+
+    //! Finishes the staged transfer and releases the buffers, which became idle
+    void End(size_t bytes);
+
+    //! Releases the buffers, which weren't used for DEBUG_CLR_STAGING_IDLE_TIMEOUT.
+    //! The caller must guarantee no staging copies are in flight
+    void ReleaseIdle();
+
+    //! Returns the size of a single staging buffer
+    size_t BufSize() const { return buf_size_; }
+
+    //! Returns the queue statistics
+    const Stats& GetStats() const { return stats_; }
+
+   private:
+    struct Slot {
+      address buffer_ = nullptr;  //!< Staging memory
+      uint64_t last_use_ = 0;     //!< Time of the last acquire
+    };
+
+    VirtualGPU& gpu_;                 //!< Queue object for ROCm device
+    size_t buf_size_;                 //!< The size of a single buffer
+    uint32_t next_ = 0;               //!< The next slot for acquire
+    uint64_t wait_ns_ = 0;            //!< Wait time in the current transfer
+    Slot slots_[kNumSlots];           //!< Staging buffers
+    Stats stats_;                     //!< Queue statistics
+  };
   class MemoryDependency : public amd::EmbeddedObject {
    public:
     //! Default constructor
@@ -280,6 +405,9 @@ class VirtualGPU : public device::VirtualDevice {
     //! Get the last active signal on the queue
     ProfilingSignal* GetLastSignal() const { return signal_list_[current_id_]; }
 
+    //! Wait for the provided signal, which was returned from GetLastSignal()
+    bool WaitSignal(ProfilingSignal* signal) { return CpuWaitForSignal(signal); }
+
     //! Clear external signals
     void ClearExternalSignals() { external_signals_.clear(); }
 
@@ -338,6 +466,12 @@ class VirtualGPU : public device::VirtualDevice {
   void submitMapMemory(amd::MapMemoryCommand& cmd);
   void submitUnmapMemory(amd::UnmapMemoryCommand& cmd);
   void submitKernel(amd::NDRangeKernelCommand& cmd);
+  //! Returns the dispatch packet template of the launch or nullptr
+  AqlTemplate* findAqlTemplate(const device::Kernel* kernel, const amd::NDRangeContainer& sizes,
+                               uint32_t sharedMemBytes, bool coopGroups);
+  //! Returns a template slot for the new launch or nullptr if the cache is disabled
+  AqlTemplate* allocAqlTemplate();
+
   bool submitKernelInternal(const amd::NDRangeContainer& sizes,  //!< Workload sizes
                             const amd::Kernel& kernel,           //!< Kernel for execution
                             const_address parameters,            //!< Parameters for the kernel
@@ -406,6 +540,9 @@ class VirtualGPU : public device::VirtualDevice {
   //! Returns a managed buffer for staging copies
   ManagedBuffer& Staging() { return managed_buffer_; }
 
+  //! Returns the staging ring for D2H copies
+  StagingRing& ReadStaging() { return read_staging_; }
+
   //! Adds a pinned memory object into a map
   void addPinnedMem(amd::Memory* mem);
 
@@ -440,10 +577,74 @@ class VirtualGPU : public device::VirtualDevice {
   //! Analyzes a crashed AQL queue to find a broken AQL packet
   void AnalyzeAqlQueue() const;
 
+  //! Submits a barrier with the timeline signal after all packets in the queue
+  virtual uint64_t AdvanceTimeline();
+
+  virtual bool IsTimelineComplete(uint64_t value) { return timeline_.IsComplete(value); }
+
+  virtual void WaitTimeline(uint64_t value) { timeline_.Wait(value); }
+
+  virtual bool IsRebalanceDue() const {
+    return DEBUG_CLR_HW_QUEUE_REBALANCE && !cooperative_ && cuMask_.empty() &&
+           (amd::Os::timeNanos() >= nextRebalance_);
+  }
+
+  //! Switches to a lighter shared HW queue, if the device finds one
+  virtual void RebalanceQueue();
+
+  //! Releases the HW queue, so the idle queue doesn't count as a user of it
+  virtual void ParkQueue();
+
+  //! Acquires a HW queue with the same selection as the queue creation
+  virtual bool UnparkQueue();
+
+  //! Defers the doorbell updates until the end of the submission batch
+  virtual void beginSubmitBatch() { deferDoorbell_ = true; }
+
+  //! Rings the doorbell once for all packets of the submission batch
+  virtual void endSubmitBatch() {
+    deferDoorbell_ = false;
+    flushDoorbell();
+  }
+
+  //! Rings the deferred doorbell. Must be called before a wait for the submitted packets
+  void flushDoorbell() {
+    if (doorbellPending_) {
+      doorbellPending_ = false;
+      hsa_signal_store_screlease(gpu_queue_->doorbell_signal, doorbellIndex_);
+    }
+  }
+
  private:
   //! Dispatches a barrier with blocking HSA signals
   void dispatchBlockingWait();
 
+  //! Notifies the HW queue about the packet or defers it to the end of the submission batch
+  void ringDoorbell(uint64_t index) {
+    if (deferDoorbell_) {
+      doorbellIndex_ = index;
+      doorbellPending_ = true;
+    } else {
+      hsa_signal_store_screlease(gpu_queue_->doorbell_signal, index);
+    }
+  }
+
+  //! Refreshes the load sample of the HW queue, so the rate reflects the recent submissions
+  void SampleQueueLoad() {
+    // The device samples the whole queue, so one user per interval is enough. The clock is
+    // read only once per kLoadSampleDispatches packets to keep it off the dispatch path
+    constexpr uint64_t kLoadSampleIntervalNs = 1000 * 1000;
+    constexpr uint32_t kLoadSampleDispatches = 64;
+    if (DEBUG_CLR_HW_QUEUE_REBALANCE && (++loadSampleDispatches_ >= kLoadSampleDispatches)) {
+      loadSampleDispatches_ = 0;
+      uint64_t now = amd::Os::timeNanos();
+      if (now >= nextLoadSample_) {
+        nextLoadSample_ = now + kLoadSampleIntervalNs;
+        roc_device_.refreshQueueLoad(gpu_queue_);
+      }
+    }
+  }
+
   inline bool dispatchAqlPacket(uint8_t* aqlpacket, const std::string& kernelName,
                                 amd::AccumulateCommand* vcmd = nullptr);
   bool dispatchAqlPacket(hsa_kernel_dispatch_packet_t* packet, uint16_t header, uint16_t rest,
@@ -523,6 +724,8 @@ class VirtualGPU : public device::VirtualDevice {
       uint32_t addSystemScope_        : 1; //!< Insert a system scope to the next aql
       uint32_t tracking_created_      : 1; //!< Enabled if tracking object was properly initialized
       uint32_t retainExternalSignals_ : 1; //!< Indicate to retain external signal array
+      uint32_t deferDoorbell_         : 1; //!< Doorbell updates wait for the batch end
+      uint32_t doorbellPending_       : 1; //!< The deferred doorbell wasn't rung yet
     };
     uint32_t  state_;
   };
@@ -530,6 +733,7 @@ class VirtualGPU : public device::VirtualDevice {
   Timestamp* timestamp_;
   hsa_agent_t gpu_device_;  //!< Physical device
   hsa_queue_t* gpu_queue_;  //!< Queue associated with a gpu
+  uint64_t doorbellIndex_ = 0;  //!< Write index of the deferred doorbell
   hsa_barrier_and_packet_t barrier_packet_;
   hsa_amd_barrier_value_packet_t barrier_value_packet_;
 
@@ -550,9 +754,23 @@ class VirtualGPU : public device::VirtualDevice {
   hsa_signal_t schedulerSignal_;
 
   HwQueueTracker  barriers_;      //!< Tracks active barriers in ROCr
+  //! Every Nth launch measures the setup time of the dispatch packet
+  static constexpr uint64_t kAqlSetupSampleRate = 64;
+  std::vector<AqlTemplate> aqlTemplates_;  //!< Dispatch packet templates of recent launches
+  size_t aqlTemplateNext_ = 0;              //!< Next template slot for replacement
+  uint64_t aqlTemplateGeneration_ = 0;      //!< Kernel generation of the templates
+  uint64_t aqlTemplateHits_ = 0;            //!< Launches from a template
+  uint64_t aqlTemplateMisses_ = 0;          //!< Launches, which built a template
+  uint64_t aqlSetupNs_[2] = {};             //!< Sampled setup time of misses and hits
+  uint64_t aqlSetupSamples_[2] = {};        //!< Number of the setup time samples
+  amd::Timeline<TimelineSignal> timeline_;  //!< Timeline of the retired queue work
+  uint64_t nextRebalance_ = 0;              //!< Time of the next HW queue load check
+  uint64_t nextLoadSample_ = 0;             //!< Time of the next HW queue load sample
+  uint32_t loadSampleDispatches_ = 0;       //!< Dispatches since the last load sample check
 
   ManagedBuffer managed_buffer_;  //!< Memory manager for staging copies
   ManagedBuffer managed_kernarg_buffer_; //!< Managed memory for kernel args
+  StagingRing read_staging_;      //!< Staging buffers for D2H copies
 
   friend class Timestamp;
 
@@ -0,0 +1,188 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+
+#include <device/blittuner.hpp>
+#include <os/os.hpp>
+#include <utils/flags.hpp>
+#include <utils/debug.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+using amd::device::BlitTuner;
+
+// The default number of workgroups of the synthetic device
+static constexpr uint32_t kMaxWorkgroups = 64;
+
+// Synthetic device: the kernel needs more workgroups for the larger transfers and the
+// unaligned transfers are slower. SDMA has a high launch latency, but the better bandwidth
+// for the large host transfers.
+class ModelTimer : public BlitTuner::Timer {
+ public:
+  virtual uint64_t Measure(BlitTuner::Kind kind, BlitTuner::Engine engine, size_t size,
+                           bool aligned, uint32_t workgroups) {
+    ++calls_;
+    uint64_t noise = (calls_ % 3 == 0) ? 5000 : 0;
+    if (engine == BlitTuner::Sdma) {
+      if (kind == BlitTuner::Fill) {
+        return 0;
+      }
+      uint64_t bandwidth = (kind == BlitTuner::DeviceToDevice) ? 100 : 50;  // bytes per ns
+      return 20000 + size / bandwidth + noise;
+    }
+    uint32_t best = Optimal(size);
+    uint64_t bandwidth = (kind == BlitTuner::DeviceToDevice) ? 400 : 20;
+    uint64_t ns = 3000 + size / bandwidth;
+    // The wrong workgroup count costs 10% per power of two
+    uint32_t distance = (workgroups > best) ? amd::log2(workgroups / best)
+                                            : amd::log2(best / workgroups);
+    ns += ns * distance / 10;
+    return (aligned ? ns : ns * 2) + noise;
+  }
+
+  static uint32_t Optimal(size_t size) { return (size < (size_t{1} << 20)) ? 16 : 256; }
+
+  uint64_t calls_ = 0;
+};
+
+static bool check(const BlitTuner& tuner, BlitTuner::Kind kind, size_t size, bool aligned,
+                  BlitTuner::Engine engine, uint32_t workgroups) {
+  const BlitTuner::Decision* decision = tuner.Find(kind, size, aligned);
+  if ((decision == nullptr) || (decision->engine_ != engine) ||
+      (decision->workgroups_ != workgroups)) {
+    LogPrintfError("Wrong decision for kind %u, size %zu, aligned %d", kind, size, aligned);
+    return false;
+  }
+  return true;
+}
+
+static bool testCalibrate(BlitTuner& tuner) {
+  ModelTimer timer;
+  tuner.Calibrate(timer, kMaxWorkgroups, true);
+  printf("Calibration: %llu measurements\n", static_cast<unsigned long long>(timer.calls_));
+
+  bool ret = tuner.Calibrated();
+  // Small transfers stay on the kernel, the large host transfers move to SDMA
+  ret = ret && check(tuner, BlitTuner::HostToDevice, 4096, true, BlitTuner::Kernel, 16);
+  ret = ret && check(tuner, BlitTuner::HostToDevice, 64 << 20, true, BlitTuner::Sdma, 256);
+  ret = ret && check(tuner, BlitTuner::DeviceToHost, 64 << 20, false, BlitTuner::Sdma, 256);
+  ret = ret && check(tuner, BlitTuner::DeviceToDevice, 64 << 20, true, BlitTuner::Kernel, 256);
+  ret = ret && check(tuner, BlitTuner::DeviceToDevice, 100000, false, BlitTuner::Kernel, 16);
+  ret = ret && check(tuner, BlitTuner::Fill, 64 << 20, true, BlitTuner::Kernel, 256);
+  // The sizes outside of the calibrated range keep the heuristics
+  if (ret && ((tuner.Find(BlitTuner::DeviceToDevice, 4095, true) != nullptr) ||
+              (tuner.Find(BlitTuner::DeviceToDevice, 128 << 20, true) != nullptr))) {
+    LogError("Decision outside of the calibrated sizes");
+    ret = false;
+  }
+  return ret;
+}
+
+static bool testCache(const BlitTuner& tuner) {
+  std::string file = amd::Os::getTempPath() + amd::Os::fileSeparator() + "blittune_test." +
+      std::to_string(amd::Os::getProcessId());
+  bool ret = true;
+
+  // A cache with another device, which must survive the save
+  {
+    std::ofstream out(file, std::ios::trunc);
+    out << "rocclr-blit-tune 1\ndevice gfx000:0:1\n0 12 1 0 8\nend\n";
+  }
+  BlitTuner other("gfx000:0:1");
+  BlitTuner loaded(tuner.key());
+  if (!other.Load(file, kMaxWorkgroups) || loaded.Load(file, kMaxWorkgroups) ||
+      !tuner.Save(file)) {
+    LogError("Cache setup failed");
+    ret = false;
+  }
+
+  BlitTuner reloaded(tuner.key());
+  BlitTuner other2("gfx000:0:1");
+  if (ret && (!reloaded.Load(file, kMaxWorkgroups) || !other2.Load(file, kMaxWorkgroups) ||
+              !check(other2, BlitTuner::DeviceToDevice, 4096, true, BlitTuner::Kernel, 8))) {
+    LogError("Cache reload failed");
+    ret = false;
+  }
+  for (uint32_t kind = 0; ret && (kind < BlitTuner::KindTotal); ++kind) {
+    for (uint32_t log2 = BlitTuner::kMinSizeLog2; log2 <= BlitTuner::kMaxSizeLog2; ++log2) {
+      for (bool aligned : {false, true}) {
+        auto a = tuner.Find(static_cast<BlitTuner::Kind>(kind), size_t{1} << log2, aligned);
+        auto b = reloaded.Find(static_cast<BlitTuner::Kind>(kind), size_t{1} << log2, aligned);
+        if ((a == nullptr) != (b == nullptr) ||
+            ((a != nullptr) && ((a->engine_ != b->engine_) ||
+                                (a->workgroups_ != b->workgroups_)))) {
+          LogPrintfError("Cache mismatch for kind %u, size 2^%u", kind, log2);
+          ret = false;
+        }
+      }
+    }
+  }
+
+  // A corrupted entry rejects the table
+  {
+    std::ofstream out(file, std::ios::trunc);
+    out << "rocclr-blit-tune 1\ndevice " << tuner.key() << "\n0 40 1 0 8\nend\n";
+  }
+  BlitTuner corrupted(tuner.key());
+  if (ret && corrupted.Load(file, kMaxWorkgroups)) {
+    LogError("Corrupted cache accepted");
+    ret = false;
+  }
+  // The workgroups must be in the calibrated range
+  for (uint32_t workgroups : {0u, kMaxWorkgroups * 4 + 1}) {
+    {
+      std::ofstream out(file, std::ios::trunc);
+      out << "rocclr-blit-tune 1\ndevice " << tuner.key() << "\n0 12 1 0 " << workgroups
+          << "\nend\n";
+    }
+    BlitTuner out_of_range(tuner.key());
+    if (ret && out_of_range.Load(file, kMaxWorkgroups)) {
+      LogPrintfError("Cache with %u workgroups accepted", workgroups);
+      ret = false;
+    }
+  }
+  std::remove(file.c_str());
+
+  // A failed replace of the cache must not leave the temporary file behind
+  std::string dir = file + ".dir";
+  std::string tmp = dir + "." + std::to_string(amd::Os::getProcessId());
+  amd::Os::createPath(dir);
+  if (ret && (tuner.Save(dir) || (std::ifstream(tmp).is_open()))) {
+    LogError("Failed cache save left the temporary file");
+    ret = false;
+  }
+  std::remove(tmp.c_str());
+  amd::Os::removePath(dir);
+  return ret;
+}
+
+int main(int argc, char** argv) {
+  amd::Flag::init();
+  amd::Os::init();
+  // blittune_test
+  BlitTuner tuner("gfx942:sramecc+:xnack-:74a1:304");
+  bool ret = testCalibrate(tuner);
+  ret = ret && testCache(tuner);
+  printf("%s: blittune %s!\n", __func__, ret ? "Succeeded" : "Failed");
+  return ret ? 0 : 1;
+}
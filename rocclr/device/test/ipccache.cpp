@@ -0,0 +1,238 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+#include <device/devipccache.hpp>
+#include <os/os.hpp>
+#include <utils/flags.hpp>
+#include <utils/debug.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+
+using amd::device::IpcMemCache;
+
+// Fake exporter: the first byte of the handle selects the allocation, so different handles
+// can resolve into the same mapping
+class FakeBackend : public IpcMemCache::Backend {
+ public:
+  void* Import(const void* handle, size_t size, size_t offset, unsigned int flags) override {
+    imports_++;
+    unsigned char id = *static_cast<const unsigned char*>(handle);
+    if (id == 0) {
+      return nullptr;
+    }
+    void* ptr = memory_ + id * 0x100 + offset;
+    mapped_[ptr]++;
+    return ptr;
+  }
+
+  void Release(void* ptr) override {
+    releases_++;
+    if (--mapped_[ptr] == 0) {
+      mapped_.erase(ptr);
+    }
+  }
+
+  bool IsMapped(void* ptr) const override { return mapped_.count(ptr) != 0; }
+
+  //! Frees all mappings behind the cache, like a device reset
+  void Reset() { mapped_.clear(); }
+
+  size_t Mapped() const { return mapped_.size(); }
+
+  size_t imports_ = 0;
+  size_t releases_ = 0;
+
+ private:
+  char memory_[0x10000];
+  std::map<void*, int> mapped_;  //!< Active imports of the pointer
+};
+
+static void makeHandle(unsigned char id, unsigned char salt, char* handle) {
+  memset(handle, 0, IpcMemCache::kHandleSize);
+  handle[0] = static_cast<char>(id);
+  handle[IpcMemCache::kHandleSize - 1] = static_cast<char>(salt);
+}
+
+#define CHECK(cond)                                                  \
+  if (!(cond)) {                                                     \
+    LogPrintfError("%s:%d: %s failed", __func__, __LINE__, #cond);   \
+    return false;                                                    \
+  }
+
+// Repeated opens share the mapping and the last close keeps it idle for reuse
+static bool testHits() {
+  FakeBackend backend;
+  IpcMemCache cache(4);
+  char handle[IpcMemCache::kHandleSize];
+  makeHandle(1, 0, handle);
+
+  void* a = cache.Open(backend, 0, handle, 64, 0, 0);
+  void* b = cache.Open(backend, 0, handle, 64, 0, 0);
+  CHECK((a != nullptr) && (a == b));
+  CHECK(backend.imports_ == 1);
+  auto stats = cache.GetStats();
+  CHECK((stats.hits_ == 1) && (stats.misses_ == 1) && (stats.active_ == 1));
+
+  // The other device and the other offset are new imports. The fake exporter returns the
+  // same address on the other device, so the duplicate import is released
+  void* c = cache.Open(backend, 1, handle, 64, 0, 0);
+  void* d = cache.Open(backend, 0, handle, 64, 16, 0);
+  CHECK((backend.imports_ == 3) && (c == a) && (d != a));
+  CHECK((backend.releases_ == 1) && (backend.Mapped() == 2));
+
+  CHECK(cache.Close(a) && cache.Close(b) && cache.Close(d));
+  stats = cache.GetStats();
+  CHECK((stats.idle_ == 1) && (stats.active_ == 1) && (backend.releases_ == 1));
+
+  // An idle entry is reused without a new import
+  CHECK(cache.Open(backend, 0, handle, 64, 0, 0) == a);
+  CHECK((backend.imports_ == 3) && (cache.GetStats().hits_ == 2));
+  CHECK(cache.Close(a) && cache.Close(c));
+
+  cache.Flush();
+  CHECK((backend.Mapped() == 0) && (cache.GetStats().idle_ == 0));
+  return true;
+}
+
+// Closes must match the opens, an unknown or closed pointer is rejected
+static bool testRefCounts() {
+  FakeBackend backend;
+  IpcMemCache cache(4);
+  char handle[IpcMemCache::kHandleSize];
+  makeHandle(2, 0, handle);
+
+  void* ptr = cache.Open(backend, 0, handle, 64, 0, 0);
+  CHECK(cache.Open(backend, 0, handle, 64, 0, 0) == ptr);
+  CHECK(cache.Close(ptr));
+  CHECK(cache.GetStats().active_ == 1);
+  CHECK(cache.Close(ptr));
+  CHECK(!cache.Close(ptr));
+  int local = 0;
+  CHECK(!cache.Close(&local));
+
+  // A failed import isn't cached
+  makeHandle(0, 0, handle);
+  CHECK(cache.Open(backend, 0, handle, 64, 0, 0) == nullptr);
+  CHECK(cache.Open(backend, 0, handle, 64, 0, 0) == nullptr);
+  CHECK(cache.GetStats().misses_ == 3);
+
+  // The different handles of one allocation share the mapping and keep one import
+  char other[IpcMemCache::kHandleSize];
+  makeHandle(3, 0, handle);
+  makeHandle(3, 1, other);
+  void* a = cache.Open(backend, 0, handle, 64, 0, 0);
+  void* b = cache.Open(backend, 0, other, 64, 0, 0);
+  CHECK((a == b) && (backend.Mapped() == 2));
+  CHECK(cache.Close(a));
+  CHECK(cache.GetStats().active_ == 1);
+  CHECK(cache.Close(b));
+  // Both handles resolve into the idle mapping
+  CHECK(cache.Open(backend, 0, other, 64, 0, 0) == a);
+  CHECK(cache.Close(a));
+  cache.Flush();
+  CHECK(backend.Mapped() == 0);
+  return true;
+}
+
+// The idle list is bounded and evicts the least recently used mappings
+static bool testEviction() {
+  FakeBackend backend;
+  IpcMemCache cache(2);
+  char handle[IpcMemCache::kHandleSize];
+  void* ptrs[4];
+  for (unsigned char i = 0; i < 4; ++i) {
+    makeHandle(i + 1, 0, handle);
+    ptrs[i] = cache.Open(backend, 0, handle, 64, 0, 0);
+  }
+  // Touch the first mapping, so it's the most recent after the close
+  CHECK(cache.Close(ptrs[1]) && cache.Close(ptrs[2]) && cache.Close(ptrs[0]));
+  CHECK(cache.GetStats().evictions_ == 1);
+  CHECK(backend.Mapped() == 3);
+  CHECK(cache.Close(ptrs[3]));
+  auto stats = cache.GetStats();
+  CHECK((stats.evictions_ == 2) && (stats.idle_ == 2) && (stats.active_ == 0));
+
+  // The mappings 1 and 2 were evicted, 0 and 3 are reused
+  size_t imports = backend.imports_;
+  makeHandle(1, 0, handle);
+  CHECK(cache.Open(backend, 0, handle, 64, 0, 0) == ptrs[0]);
+  makeHandle(4, 0, handle);
+  CHECK(cache.Open(backend, 0, handle, 64, 0, 0) == ptrs[3]);
+  makeHandle(2, 0, handle);
+  CHECK(cache.Open(backend, 0, handle, 64, 0, 0) == ptrs[1]);
+  CHECK(backend.imports_ == imports + 1);
+  CHECK(cache.Close(ptrs[0]) && cache.Close(ptrs[1]) && cache.Close(ptrs[3]));
+
+  // Without idle entries the last close unmaps immediately
+  IpcMemCache uncached(0);
+  makeHandle(5, 0, handle);
+  void* ptr = uncached.Open(backend, 0, handle, 64, 0, 0);
+  CHECK(uncached.Close(ptr));
+  stats = uncached.GetStats();
+  CHECK((stats.idle_ == 0) && (stats.active_ == 0) && (stats.evictions_ == 0));
+  CHECK(uncached.Open(backend, 0, handle, 64, 0, 0) == ptr);
+  CHECK(uncached.GetStats().misses_ == 2);
+  CHECK(uncached.Close(ptr));
+
+  cache.Flush();
+  CHECK(backend.Mapped() == 0);
+  return true;
+}
+
+// The mappings freed behind the cache are imported again, the purge forgets the backend
+static bool testReset() {
+  FakeBackend backend;
+  FakeBackend other;
+  IpcMemCache cache(4);
+  char handle[IpcMemCache::kHandleSize];
+  makeHandle(6, 0, handle);
+
+  void* idle = cache.Open(backend, 0, handle, 64, 0, 0);
+  CHECK(cache.Close(idle));
+  backend.Reset();
+  CHECK(cache.Open(backend, 0, handle, 64, 0, 0) == idle);
+  auto stats = cache.GetStats();
+  CHECK((stats.stale_ == 1) && (stats.hits_ == 0) && (backend.imports_ == 2));
+  CHECK(backend.releases_ == 0);
+
+  // The purge unmaps the idle mappings and drops the open ones of the backend only
+  makeHandle(7, 0, handle);
+  void* open = cache.Open(backend, 0, handle, 64, 0, 0);
+  void* kept = cache.Open(other, 1, handle, 64, 0, 0);
+  CHECK(cache.Close(idle));
+  cache.Purge(backend);
+  stats = cache.GetStats();
+  CHECK((stats.idle_ == 0) && (stats.active_ == 1));
+  CHECK((backend.releases_ == 1) && (backend.Mapped() == 1));
+  CHECK(!cache.Close(open) && cache.Close(kept));
+  cache.Flush();
+  CHECK(other.Mapped() == 0);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  amd::Flag::init();
+  amd::Os::init();
+
+  bool ret = testHits() && testRefCounts() && testEviction() && testReset();
+  printf("%s: ipccache %s!\n", __func__, ret ? "Succeeded" : "Failed");
+  return ret ? 0 : 1;
+}
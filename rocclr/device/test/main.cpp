@@ -0,0 +1,207 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+
+#include <device/hostblit.hpp>
+#include <os/os.hpp>
+#include <utils/flags.hpp>
+#include <utils/debug.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using amd::device::HostBlit;
+
+// Representative image formats of the host fill/copy paths
+struct Format {
+  const char* name;
+  size_t elementSize;
+};
+
+static const Format kFormats[] = {
+    {"R8", 1}, {"RGBA8", 4}, {"RGBA16F", 8}, {"RGB32F", 12}, {"RGBA32F", 16},
+};
+
+// The previous fillImage: memcpy of every pixel
+static void fillReference(uint8_t* dst, size_t rowPitch, size_t slicePitch, const void* pixel,
+                          size_t elementSize, size_t width, size_t rows, size_t slices) {
+  for (size_t slice = 0; slice < slices; ++slice) {
+    for (size_t row = 0; row < rows; ++row) {
+      uint8_t* line = dst + slice * slicePitch + row * rowPitch;
+      for (size_t column = 0; column < width; ++column) {
+        memcpy(line + column * elementSize, pixel, elementSize);
+      }
+    }
+  }
+}
+
+// The previous copyImage: memcpy of every row
+static void copyReference(uint8_t* dst, size_t dstRowPitch, size_t dstSlicePitch,
+                          const uint8_t* src, size_t srcRowPitch, size_t srcSlicePitch,
+                          size_t rowSize, size_t rows, size_t slices) {
+  for (size_t slice = 0; slice < slices; ++slice) {
+    for (size_t row = 0; row < rows; ++row) {
+      memcpy(dst + slice * dstSlicePitch + row * dstRowPitch,
+             src + slice * srcSlicePitch + row * srcRowPitch, rowSize);
+    }
+  }
+}
+
+// The previous sRGBmap
+static uint32_t sRGBmapReference(float fc) {
+  double c = (double)fc;
+  if (std::isnan(c)) c = 0.0;
+  if (c > 1.0)
+    c = 1.0;
+  else if (c < 0.0)
+    c = 0.0;
+  else if (c < 0.0031308)
+    c = 12.92 * c;
+  else
+    c = (1055.0 / 1000.0) * pow(c, 5.0 / 12.0) - (55.0 / 1000.0);
+  return (uint32_t)(c * 255.0 + 0.5);
+}
+
+template <typename Func>
+static double timeMs(unsigned int iterations, Func func) {
+  uint64_t start = amd::Os::timeNanos();
+  for (unsigned int i = 0; i < iterations; ++i) {
+    func();
+  }
+  return (amd::Os::timeNanos() - start) / 1e6 / iterations;
+}
+
+// Fills and copies a sub rectangle of a padded 2D image, so the rows can't be collapsed
+static bool benchmarkFormat(const Format& format, size_t width, size_t height,
+                            unsigned int iterations) {
+  const size_t rowSize = width * format.elementSize;
+  const size_t rowPitch = amd::alignUp(rowSize, 256) + 256;
+  const size_t imageSize = rowPitch * (height + 1);
+  std::vector<uint8_t> image(imageSize);
+  std::vector<uint8_t> expected(imageSize);
+  std::vector<uint8_t> copy(imageSize);
+  uint8_t pixel[16];
+  for (size_t i = 0; i < sizeof(pixel); ++i) {
+    pixel[i] = static_cast<uint8_t>(0x11 * (i + 1));
+  }
+  // Start at the odd element to exercise the unaligned heads
+  uint8_t* origin = image.data() + rowPitch + format.elementSize;
+  uint8_t* originExpected = expected.data() + rowPitch + format.elementSize;
+  const size_t fillWidth = width - 1;
+
+  fillReference(originExpected, rowPitch, 0, pixel, format.elementSize, fillWidth, height, 1);
+  HostBlit::FillRect(origin, rowPitch, 0, pixel, format.elementSize, fillWidth, height, 1, true);
+  if (image != expected) {
+    printf("%s: fill mismatch for %s\n", __func__, format.name);
+    return false;
+  }
+  HostBlit::CopyRect(copy.data() + 3, rowPitch, 0, image.data(), rowPitch, 0, rowSize, height, 1,
+                     true);
+  if (memcmp(copy.data() + 3, image.data(), rowPitch * (height - 1) + rowSize) != 0) {
+    printf("%s: copy mismatch for %s\n", __func__, format.name);
+    return false;
+  }
+
+  double fillOld = timeMs(iterations, [&]() {
+    fillReference(origin, rowPitch, 0, pixel, format.elementSize, fillWidth, height, 1);
+  });
+  double fillNew = timeMs(iterations, [&]() {
+    HostBlit::FillRect(origin, rowPitch, 0, pixel, format.elementSize, fillWidth, height, 1,
+                       true);
+  });
+  double copyOld = timeMs(iterations, [&]() {
+    copyReference(copy.data(), rowPitch, 0, image.data(), rowPitch, 0, rowSize, height, 1);
+  });
+  double copyNew = timeMs(iterations, [&]() {
+    HostBlit::CopyRect(copy.data(), rowPitch, 0, image.data(), rowPitch, 0, rowSize, height, 1,
+                       true);
+  });
+  double mb = static_cast<double>(rowSize * height) / Mi;
+  printf("%-8s %5zux%-5zu fill: %8.3f -> %8.3f ms (%6.0f MB/s), copy: %8.3f -> %8.3f ms "
+         "(%6.0f MB/s)\n", format.name, width, height, fillOld, fillNew, mb / fillNew * 1000,
+         copyOld, copyNew, mb / copyNew * 1000);
+  return true;
+}
+
+static bool benchmarkSRGB(unsigned int iterations) {
+  // Check every 97th float bit pattern in [0, 1] and around every step of the table
+  const float one = 1.0f;
+  uint32_t oneBits;
+  memcpy(&oneBits, &one, sizeof(oneBits));
+  for (uint32_t bits = 0; bits <= oneBits; bits += 97) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    if (HostBlit::sRGBmap(value) != sRGBmapReference(value)) {
+      printf("%s: sRGB mismatch for %.9g\n", __func__, value);
+      return false;
+    }
+  }
+  const float special[] = {-1.0f, 2.0f, NAN, INFINITY, -INFINITY, 0.0031308f, 0.5f};
+  for (float value : special) {
+    if (HostBlit::sRGBmap(value) != sRGBmapReference(value)) {
+      printf("%s: sRGB mismatch for %.9g\n", __func__, value);
+      return false;
+    }
+  }
+
+  volatile uint32_t sink = 0;
+  const uint32_t count = 1 << 20;
+  double oldMs = timeMs(iterations, [&]() {
+    for (uint32_t i = 0; i < count; ++i) sink = sink + sRGBmapReference(i * (1.0f / count));
+  });
+  double newMs = timeMs(iterations, [&]() {
+    for (uint32_t i = 0; i < count; ++i) sink = sink + HostBlit::sRGBmap(i * (1.0f / count));
+  });
+  printf("sRGBmap: %.2f -> %.2f ns per channel\n", oldMs * 1e6 / count, newMs * 1e6 / count);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  amd::Flag::init();
+  amd::Os::init();
+  // hostblit_test [width] [height] [iterations]
+  size_t width = (argc > 1) ? strtoul(argv[1], nullptr, 0) : 2048;
+  size_t height = (argc > 2) ? strtoul(argv[2], nullptr, 0) : 2048;
+  unsigned int iterations = (argc > 3) ? strtoul(argv[3], nullptr, 0) : 10;
+  width = std::max<size_t>(width, 2);
+  height = std::max<size_t>(height, 2);
+  iterations = std::max(iterations, 1u);
+
+  bool ret = true;
+  const uint threads = DEBUG_CLR_HOST_BLIT_THREADS;
+  for (uint pass : {1u, threads}) {
+    DEBUG_CLR_HOST_BLIT_THREADS = pass;
+    printf("Worker threads: %u\n", std::min<uint>(pass, amd::Os::processorCount()));
+    for (const auto& format : kFormats) {
+      ret = ret && benchmarkFormat(format, width, height, iterations);
+    }
+    if (threads <= 1) {
+      break;
+    }
+  }
+  ret = ret && benchmarkSRGB(iterations);
+  printf("%s: benchmark(%zux%zu, %u iterations) %s!\n", __func__, width, height, iterations,
+         ret ? "Succeeded" : "Failed");
+  return ret ? 0 : 1;
+}
@@ -0,0 +1,201 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+
+#include <device/devurirange.hpp>
+#include <os/os.hpp>
+#include <utils/flags.hpp>
+#include <utils/debug.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using amd::device::DecodedUri;
+using amd::device::UriRangeTable;
+
+template <typename Func>
+static double timeNs(unsigned int iterations, Func func) {
+  uint64_t start = amd::Os::timeNanos();
+  for (unsigned int i = 0; i < iterations; ++i) {
+    func(i);
+  }
+  return static_cast<double>(amd::Os::timeNanos() - start) / iterations;
+}
+
+// The previous lookup: linear scan of the unsorted ranges
+static const UriRangeTable::Range* findReference(const std::vector<UriRangeTable::Range>& ranges,
+                                                 uint64_t pc) {
+  for (const auto& range : ranges) {
+    if ((range.start_ <= pc) && (pc <= range.end_)) {
+      return &range;
+    }
+  }
+  return nullptr;
+}
+
+// Synthetic code objects with gaps between them, loaded in a random order
+static std::vector<UriRangeTable::Range> makeRanges(size_t count, std::mt19937_64& rng) {
+  std::vector<UriRangeTable::Range> ranges;
+  uint64_t addr = 0x7f0000000000ull;
+  for (size_t i = 0; i < count; ++i) {
+    addr += 0x1000 * (1 + rng() % 16);
+    uint64_t size = 0x1000 * (1 + rng() % 64);
+    ranges.push_back({addr, addr + size - 1, static_cast<int64_t>(addr), i + 1,
+                      "file:///opt/app/lib" + std::to_string(i) + ".so#offset=4096&size=8192"});
+    addr += size;
+  }
+  std::shuffle(ranges.begin(), ranges.end(), rng);
+  return ranges;
+}
+
+static bool sameRange(const UriRangeTable::Range* a, const UriRangeTable::Range* b) {
+  return ((a == nullptr) && (b == nullptr)) || ((a != nullptr) && (b != nullptr) &&
+                                                (a->id_ == b->id_));
+}
+
+static bool testLookup(size_t count, unsigned int iterations) {
+  std::mt19937_64 rng(count);
+  auto ranges = makeRanges(count, rng);
+  UriRangeTable table;
+  for (auto range : ranges) {
+    table.Insert(std::move(range));
+  }
+
+  // PCs inside, at the bounds of and between the ranges
+  std::vector<uint64_t> pcs;
+  for (const auto& range : ranges) {
+    pcs.insert(pcs.end(), {range.start_ - 1, range.start_, range.start_ + (rng() % 0x1000),
+                           range.end_, range.end_ + 1});
+  }
+  pcs.push_back(0);
+  pcs.push_back(~0ull);
+  std::shuffle(pcs.begin(), pcs.end(), rng);
+
+  for (size_t i = 0; i < pcs.size(); ++i) {
+    const UriRangeTable::Range* expected = findReference(ranges, pcs[i]);
+    if (!sameRange(table.Find(pcs[i]), expected)) {
+      LogPrintfError("Lookup mismatch at 0x%llx with %zu ranges",
+                     static_cast<unsigned long long>(pcs[i]), count);
+      return false;
+    }
+  }
+
+  // Unload every other code object and compare again
+  std::vector<uint64_t> live;
+  for (const auto& range : ranges) {
+    if ((range.id_ % 2) == 1) {
+      live.push_back(range.id_);
+    }
+  }
+  std::sort(live.begin(), live.end());
+  table.Retain(live);
+  const UriRangeTable::Range first = *std::find_if(ranges.begin(), ranges.end(),
+      [&live](const UriRangeTable::Range& r) { return r.id_ == live.front(); });
+  // A reused handle with a different range isn't the cached code object
+  if (!table.Contains(first.id_, first.start_, first.end_) ||
+      table.Contains(first.id_, first.start_ + 0x1000, first.end_ + 0x1000)) {
+    LogError("Contains failed");
+    return false;
+  }
+  if (!table.Remove(live.front()) || table.Remove(live.front()) ||
+      table.Contains(first.id_, first.start_, first.end_)) {
+    LogError("Remove failed");
+    return false;
+  }
+  live.erase(live.begin());
+  ranges.erase(std::remove_if(ranges.begin(), ranges.end(),
+                              [&live](const UriRangeTable::Range& r) {
+                                return !std::binary_search(live.begin(), live.end(), r.id_);
+                              }),
+               ranges.end());
+  if (table.size() != ranges.size()) {
+    LogError("Retain failed");
+    return false;
+  }
+  for (uint64_t pc : pcs) {
+    if (!sameRange(table.Find(pc), findReference(ranges, pc))) {
+      LogPrintfError("Lookup mismatch at 0x%llx after unload",
+                     static_cast<unsigned long long>(pc));
+      return false;
+    }
+  }
+
+  volatile uint64_t sink = 0;
+  double linearNs = timeNs(iterations, [&](unsigned int i) {
+    auto range = findReference(ranges, pcs[i % pcs.size()]);
+    sink = sink + ((range != nullptr) ? range->id_ : 0);
+  });
+  double sortedNs = timeNs(iterations, [&](unsigned int i) {
+    auto range = table.Find(pcs[i % pcs.size()]);
+    sink = sink + ((range != nullptr) ? range->id_ : 0);
+  });
+  printf("%6zu code objects: linear %9.1f ns -> sorted %6.1f ns per lookup\n", ranges.size(),
+         linearNs, sortedNs);
+  return true;
+}
+
+static bool testDecode() {
+  struct Case {
+    const char* uri;
+    bool valid;
+    const char* path;
+    uint64_t offset;
+    uint64_t size;
+  };
+  static const Case kCases[] = {
+      {"file:///opt/app/kernels.hsaco", true, "/opt/app/kernels.hsaco", 0, 0},
+      {"file:///opt/app/lib.so#offset=4096&size=8192", true, "/opt/app/lib.so", 4096, 8192},
+      {"file:///opt/my%20app/lib%2b%2B.so#offset=0x1000&size=0x2000", true,
+       "/opt/my app/lib++.so", 0x1000, 0x2000},
+      {"memory://1234#offset=0x7f0012340000&size=1024", true, "", 0x7f0012340000ull, 1024},
+      {"file:///opt/app/bad%2", false, "", 0, 0},
+      {"no-scheme", false, "", 0, 0},
+  };
+  for (const auto& c : kCases) {
+    DecodedUri decoded;
+    bool valid = amd::device::DecodeUri(c.uri, &decoded);
+    if ((valid != c.valid) || (valid && ((decoded.path_ != c.path) ||
+                                         (decoded.offset_ != c.offset) ||
+                                         (decoded.size_ != c.size)))) {
+      LogPrintfError("DecodeUri(%s) failed", c.uri);
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  amd::Flag::init();
+  amd::Os::init();
+  // urirange_test [iterations]
+  unsigned int iterations = (argc > 1) ? strtoul(argv[1], nullptr, 0) : 100000;
+  iterations = std::max(iterations, 1u);
+
+  bool ret = testDecode();
+  for (size_t count : {1, 16, 256, 4096}) {
+    ret = ret && testLookup(count, iterations);
+  }
+  printf("%s: urirange(%u iterations) %s!\n", __func__, iterations,
+         ret ? "Succeeded" : "Failed");
+  return ret ? 0 : 1;
+}
@@ -32,7 +32,9 @@
 #include <thread>
 #include <utils/flags.hpp>
 #include <utils/debug.hpp>
-#include <random>
+#include <algorithm>
+#include <fstream>
+#include <new>
 #include <sstream>
 
 
@@ -163,6 +165,83 @@ namespace {
     { Elf::RUNTIME_METADATA,".AMDGPU.runtime_metadata",  1, SHT_PROGBITS, 0,
       "AMDGPU runtime metadata" },
   };
+
+  // Seekable output buffer for the ELF serialization. ELFIO writes the headers and sections
+  // at their offsets, so the gaps between them are zero filled. The final buffer is released
+  // to the caller without a copy.
+  class ImageBuf : public std::streambuf {
+  public:
+    explicit ImageBuf(size_t capacity)
+      : buf_(new char[capacity]()), capacity_(capacity) {}
+    ~ImageBuf() { delete [] buf_; }
+
+    // Return the image and release its ownership. The caller must delete [] it
+    char* release(size_t* size) {
+      char* buf = buf_;
+      *size = size_;
+      buf_ = nullptr;
+      capacity_ = size_ = pos_ = 0;
+      return buf;
+    }
+
+  protected:
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+      if (!reserve(pos_ + n)) {
+        return 0;
+      }
+      memcpy(buf_ + pos_, s, n);
+      pos_ += n;
+      size_ = std::max(size_, pos_);
+      return n;
+    }
+
+    int_type overflow(int_type c) override {
+      if (traits_type::eq_int_type(c, traits_type::eof())) {
+        return traits_type::not_eof(c);
+      }
+      char ch = traits_type::to_char_type(c);
+      return (xsputn(&ch, 1) == 1) ? c : traits_type::eof();
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                     std::ios_base::openmode which) override {
+      off_type base = (dir == std::ios_base::beg) ? 0 :
+                      (dir == std::ios_base::cur) ? static_cast<off_type>(pos_) :
+                                                    static_cast<off_type>(size_);
+      return seekpos(pos_type(base + off), which);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+      if (!(which & std::ios_base::out) || off_type(pos) < 0) {
+        return pos_type(off_type(-1));
+      }
+      // Seeking past the end is allowed, the gap is zero filled on the next write
+      pos_ = static_cast<size_t>(off_type(pos));
+      return pos;
+    }
+
+  private:
+    bool reserve(size_t size) {
+      if (size <= capacity_) {
+        return true;
+      }
+      size_t capacity = std::max(size, capacity_ * 2);
+      char* buf = new (std::nothrow) char[capacity]();
+      if (buf == nullptr) {
+        return false;
+      }
+      memcpy(buf, buf_, size_);
+      delete [] buf_;
+      buf_ = buf;
+      capacity_ = capacity;
+      return true;
+    }
+
+    char*  buf_;       // Serialized image
+    size_t capacity_;  // Allocated size of buf_
+    size_t size_ = 0;  // Size of the image
+    size_t pos_ = 0;   // Current write position
+  };
 }
 
 ///////////////////////////////////////////////////////////////
@@ -215,6 +294,7 @@ bool Elf::Clear()
   ElfTrace(amd::LOG_INFO);
 
   _elfio.clean();
+  _view.Release();
   elfMemoryRelease();
 
   // Re-initialize the object
@@ -236,16 +316,23 @@ bool Elf::Init()
       break;
 
     case ELF_C_READ:
+      if (_rawElfBytes == nullptr && !_fname.empty()) {
+        // Map the file and parse it in place
+        if (!_view.InitFromFile(_fname.c_str())) {
+          LogElfError("failed in _view.InitFromFile(%s)", _fname.c_str());
+          return false;
+        }
+        _eclass = _view.elfClass();
+        break;
+      }
       if(_rawElfBytes == nullptr || _rawElfSize == 0) {
         logElfError("failed: _rawElfBytes = nullptr or _rawElfSize = 0");
         return false;
       }
-      {
-        std::istringstream is { std::string(_rawElfBytes, _rawElfSize) };
-        if (!_elfio.load(is)) {
-          LogElfError("failed in _elfio.load(%p, %lu)", _rawElfBytes, _rawElfSize);
-          return false;
-        }
+      // Parse the client bytes in place, without a copy
+      if (!_view.Init(_rawElfBytes, _rawElfSize)) {
+        LogElfError("failed in _view.Init(%p, %lu)", _rawElfBytes, _rawElfSize);
+        return false;
       }
       break;
 
@@ -267,30 +354,26 @@ bool Elf::Init()
 bool Elf::InitElf ()
 {
   if (_elfCmd == ELF_C_READ) {
-    assert(_elfio.sections.size() > 0 && "elfio object should have been created already");
-
     // Set up _shstrtab_ndx
-    _shstrtab_ndx = _elfio.get_section_name_str_index();
+    _shstrtab_ndx = _view.shstrndx();
     if(_shstrtab_ndx == SHN_UNDEF) {
       logElfError("failed: _shstrtab_ndx = SHN_UNDEF");
       return false;
     }
 
     // Set up _strtab_ndx
-    section* strtab_sec = _elfio.sections[ElfSecDesc[STRTAB].name];
-    if (strtab_sec == nullptr) {
+    _strtab_ndx = _view.FindSection(ElfSecDesc[STRTAB].name);
+    if (_strtab_ndx == SHN_UNDEF) {
       logElfError("failed: null sections(STRTAB)");
       return false;
     }
 
-    _strtab_ndx = strtab_sec->get_index();
-
-    section* symtab_sec = _elfio.sections[ElfSecDesc[SYMTAB].name];
-
-    if (symtab_sec != nullptr) {
-      _symtab_ndx = symtab_sec->get_index();
-    }
     // It's ok for empty SYMTAB
+    _symtab_ndx = _view.FindSection(ElfSecDesc[SYMTAB].name);
+
+    LogElfInfo("succeeded: secs=%zu, segs=%zu, _shstrtab_ndx=%u, _strtab_ndx=%u, _symtab_ndx=%u",
+               _view.SectionNum(), _view.SegmentNum(), _shstrtab_ndx, _strtab_ndx, _symtab_ndx);
+    return true;
   } else if(_elfCmd == ELF_C_WRITE) {
     /*********************************/
     /******** ELF_C_WRITE ************/
@@ -425,7 +508,7 @@ bool Elf::setupShdr (
 
 bool Elf::getTarget(uint16_t& machine, ElfPlatform& platform) const
 {
-  Elf64_Half mach = _elfio.get_machine();
+  Elf64_Half mach = getMachine();
   if ((mach >= CPU_FIRST) && (mach <= CPU_LAST)) {
     platform = CPU_PLATFORM;
     machine = mach - CPU_BASE;
@@ -464,7 +547,7 @@ bool Elf::setTarget(uint16_t machine, ElfPlatform platform)
 }
 
 bool Elf::getType(uint16_t &type) const {
-  type = _elfio.get_type();
+  type = isReader() ? _view.type() : _elfio.get_type();
   return true;
 }
 
@@ -474,7 +557,7 @@ bool Elf::setType(uint16_t  type) {
 }
 
 bool Elf::getFlags(uint32_t &flag) const {
-  flag = _elfio.get_flags();
+  flag = isReader() ? _view.flags() : _elfio.get_flags();
   return true;
 }
 
@@ -488,13 +571,25 @@ bool Elf::getSection(Elf::ElfSections id, char** dst, size_t* sz) const
   assert((ElfSecDesc[id].id == id) &&
       "ElfSecDesc[] should be in the same order as enum ElfSections");
 
+  if (isReader()) {
+    const ElfView::Section* sec = _view.GetSection(_view.FindSection(ElfSecDesc[id].name));
+    if (sec == nullptr || sec->type_ == SHT_NULL) {
+      LogElfError("failed: null sections(%s)", ElfSecDesc[id].name);
+      return false;
+    }
+    *dst = const_cast<char*>(sec->data_);
+    *sz = sec->size_;
+    LogElfInfo("succeeded: *dst=%p, *sz=%zu", *dst, *sz);
+    return true;
+  }
+
   section* sec = _elfio.sections[ElfSecDesc[id].name];
   if (sec == nullptr) {
     LogElfError("failed: null sections(%s)", ElfSecDesc[id].name);
     return false;
   }
 
-  // There is only one data descriptor (we are reading!)
+  // There is only one data descriptor
   *dst = const_cast<char*>(sec->get_data());
   *sz = sec->get_size();
 
@@ -507,23 +602,26 @@ unsigned int Elf::getSymbolNum() const {
     logElfError(" failed: _symtab_ndx = SHN_UNDEF");
     return 0; // No SYMTAB
   }
-  symbol_section_accessor symbol_reader(_elfio, _elfio.sections[_symtab_ndx]);
-  auto num = symbol_reader.get_symbols_num() - 1;  // Exclude the first dummy symbol
-  LogElfInfo(": num=%lu", num);
+  size_t num = 0;
+  if (isReader()) {
+    num = _view.SymbolNum(_symtab_ndx);
+  } else {
+    symbol_section_accessor symbol_reader(_elfio, _elfio.sections[_symtab_ndx]);
+    num = symbol_reader.get_symbols_num();
+  }
+  num = (num > 0) ? num - 1 : 0;  // Exclude the first dummy symbol
+  LogElfInfo(": num=%zu", num);
   return num;
 }
 
 unsigned int Elf::getSegmentNum() const {
-  return _elfio.segments.size();
+  // Segments are available only in the loaded ELF, the writer never creates them
+  return isReader() ? _view.SegmentNum() : 0;
 }
 
-bool Elf::getSegment(const unsigned int index, segment*& seg) const {
-  bool ret = false;
-  if (index < _elfio.segments.size()) {
-    seg = _elfio.segments[index];
-    ret = true;
-  }
-  return ret;
+bool Elf::getSegment(const unsigned int index, const ElfView::Segment*& seg) const {
+  seg = isReader() ? _view.GetSegment(index) : nullptr;
+  return seg != nullptr;
 }
 
 bool Elf::getSymbolInfo(unsigned int index, SymbolInfo* symInfo) const
@@ -532,15 +630,37 @@ bool Elf::getSymbolInfo(unsigned int index, SymbolInfo* symInfo) const
     logElfError(" failed: _symtab_ndx = SHN_UNDEF");
     return false; // No SYMTAB
   }
-  symbol_section_accessor symbol_reader(_elfio, _elfio.sections[_symtab_ndx]);
 
   auto num = getSymbolNum();
 
   if (index >= num) {
-    LogElfError(" failed: wrong index %u >= symbols num %lu", index, num);
+    LogElfError(" failed: wrong index %u >= symbols num %u", index, num);
     return false;
   }
 
+  if (isReader()) {
+    ElfView::Symbol sym;
+    // index + 1 for real index on top of the first dummy symbol
+    if (!_view.GetSymbol(_symtab_ndx, index + 1, &sym)) {
+      LogElfError("failed to get_symbol(%u)", index + 1);
+      return false;
+    }
+    const ElfView::Section* sec = _view.GetSection(sym.section_index_);
+    if (sec == nullptr) {
+      LogElfError("failed: null section at %u", sym.section_index_);
+      return false;
+    }
+    symInfo->sec_addr = sec->data_;
+    symInfo->sec_size = sec->size_;
+    symInfo->address = symInfo->sec_addr + (size_t) sym.value_;
+    symInfo->size = sym.size_;
+    symInfo->sec_name = sec->name_;
+    symInfo->sym_name = sym.name_;
+    return true;
+  }
+
+  symbol_section_accessor symbol_reader(_elfio, _elfio.sections[_symtab_ndx]);
+
   std::string   sym_name;
   Elf64_Addr    value = 0;
   Elf_Xword     size = 0;
@@ -773,6 +893,18 @@ bool Elf::getSymbol(
 
   *size = 0;
   *buffer = nullptr;
+
+  if (isReader()) {
+    ElfView::Symbol sym;
+    // Search by symbolName, sectionName
+    if (!_view.FindSymbol(_symtab_ndx, symbolName, ElfSecDesc[id].name, &sym)) {
+      return false;
+    }
+    *buffer = const_cast<char*>(_view.GetSection(sym.section_index_)->data_ + sym.value_);
+    *size = static_cast<size_t>(sym.size_);
+    return true;
+  }
+
   symbol_section_accessor symbol_reader(_elfio, _elfio.sections[_symtab_ndx]);
 
   Elf64_Addr value = 0;
@@ -842,6 +974,25 @@ bool Elf::getNote(
     return false;
   }
 
+  // Initialize the size and buffer to invalid data points.
+  *descSize = 0;
+  *noteDesc = nullptr;
+
+  if (isReader()) {
+    Elf64_Word notes_ndx = _view.FindSection(ElfSecDesc[NOTES].name);
+    if (notes_ndx == SHN_UNDEF) {
+      logElfError("failed: null sections(NOTES)");
+      return false;
+    }
+    const char* desc = nullptr;
+    if (!_view.FindNote(notes_ndx, noteName, &desc, descSize)) {
+      return false;
+    }
+    *noteDesc = const_cast<char*>(desc);
+    LogElfDebug("Succeed: get_note(%s, %s)", noteName, std::string(desc, *descSize).c_str());
+    return true;
+  }
+
   // Get section
   section* sec = _elfio.sections[ElfSecDesc[NOTES].name];
   if (sec == nullptr) {
@@ -849,10 +1000,6 @@ bool Elf::getNote(
     return false;
   }
 
-  // Initialize the size and buffer to invalid data points.
-  *descSize = 0;
-  *noteDesc = nullptr;
-
   note_section_accessor note_reader(_elfio, sec);
 
   auto num = note_reader.get_notes_num();
@@ -876,68 +1023,41 @@ bool Elf::getNote(
   return false;
 }
 
-std::string Elf::generateUUIDV4() {
-  static std::random_device rd;
-  static std::mt19937 gen(rd());
-  static std::uniform_int_distribution<> dis(0, 15);
-  static std::uniform_int_distribution<> dis2(8, 11);
-  std::stringstream ss;
-  int i;
-  ss << std::hex;
-  for (i = 0; i < 8; i++) {
-    ss << dis(gen);
-  }
-  ss << "-";
-  for (i = 0; i < 4; i++) {
-    ss << dis(gen);
-  }
-  ss << "-4";
-  for (i = 0; i < 3; i++) {
-    ss << dis(gen);
-  }
-  ss << "-";
-  ss << dis2(gen);
-  for (i = 0; i < 3; i++) {
-    ss << dis(gen);
-  }
-  ss << "-";
-  for (i = 0; i < 12; i++) {
-    ss << dis(gen);
-  };
-  return ss.str();
-}
-
 bool Elf::dumpImage(char** buff, size_t* len)
 {
-  bool ret = false;
-  std::string dumpFile = _fname;
-  if (_fname.empty()) {
-    dumpFile = generateUUIDV4();
-    dumpFile += ".bin";
-    LogElfInfo("Generated temporary dump file: %s", dumpFile.c_str());
+  // Estimate the image size to avoid reallocations during the serialization
+  size_t capacity = sizeof(Elf64_Ehdr);
+  for (const auto& sec : _elfio.sections) {
+    capacity += sizeof(Elf64_Shdr) + sec->get_size() + sec->get_addr_align();
   }
 
-  if (!_elfio.save(dumpFile)) {
-    LogElfError("failed in _elfio.save(%s)", dumpFile.c_str());
+  ImageBuf imageBuf(capacity);
+  std::ostream os(&imageBuf);
+  if (!_elfio.save(os) || !os.good()) {
+    logElfError("failed in _elfio.save()");
     return false;
   }
 
-  if (buff != nullptr && len != nullptr) {
-    std::ifstream is;
-    is.open(dumpFile, std::ifstream::in | std::ifstream::binary); // open input file
-    if (!is.good()) {
-      LogElfError("failed in is.open(%s)", dumpFile.c_str());
+  size_t size = 0;
+  char* image = imageBuf.release(&size);
+
+  if (!_fname.empty()) {
+    std::ofstream ofs(_fname, std::ofstream::out | std::ofstream::binary);
+    if (!ofs.write(image, size)) {
+      LogElfError("failed to write %s", _fname.c_str());
+      delete [] image;
       return false;
     }
-    ret = dumpImage(is, buff, len);
-    is.close();  // close file
   }
 
-  if (_fname.empty()) {
-    std::remove(dumpFile.c_str());
+  if (buff == nullptr || len == nullptr) {
+    delete [] image;
+    return false;
   }
-  LogElfInfo("%s: buff=%p, len=%zu\n", ret ? "Succeed" : "failed", *buff, *len);
-  return ret;
+  *buff = image;  // The memory should be deleted by caller
+  *len = size;
+  LogElfInfo("Succeed: buff=%p, len=%zu\n", *buff, *len);
+  return true;
 }
 
 bool Elf::dumpImage(std::istream &is, char **buff, size_t *len) const {
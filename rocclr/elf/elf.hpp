@@ -25,6 +25,7 @@
 
 #include "top.hpp"
 #include "elfio/elfio.hpp"
+#include "elfview.hpp"
 #include <sstream>
 using amd::ELFIO::Elf64_Ehdr;
 using amd::ELFIO::Elf64_Shdr;
@@ -171,9 +172,12 @@ public:
     };
 
 private:
-    // elfio object for reading and writting
+    // elfio object for writting
     elfio _elfio;
 
+    // Zero-copy view of the raw ELF bytes for reading
+    ElfView _view;
+
     // file name
     std::string _fname;
 
@@ -181,7 +185,7 @@ private:
     unsigned char _eclass;
 
     // Raw ELF bytes in memory from which Elf object is initialized
-    // The memory is owned by the client, not this Elf object !
+    // The memory is owned by the client or mapped by _view, not this Elf object !
     const char* _rawElfBytes;
     uint64_t    _rawElfSize;
 
@@ -206,17 +210,19 @@ public:
        it has two forms:
 
         1)  Elf(eclass, rawElfBytes, rawElfSize, 0, ELF_C_READ)
+            Elf(eclass, nullptr, 0, elfFileName, ELF_C_READ)
 
-            To load ELF from raw bytes in memory and generate Elf object. And this
-            object is for reading only.
+            To load ELF from raw bytes in memory (or from the memory mapped file 'elfFileName')
+            and generate Elf object. And this object is for reading only. The ELF isn't copied,
+            all data returned by the getters points into the raw bytes, hence the client must
+            keep them alive for the lifetime of Elf object.
 
         2)  Elf(eclass,  nullptr, 0, elfFileName|nullptr, ELF_C_WRITE)
 
             To create an ELF for writing and save it into a file 'elfFileName' (if it
             is nullptr, the Elf will create a stream in memory.
 
-            Since we need to read the ELF into memory, the runtime can use dumpImage() to get ELF
-            raw bytes by reading this file/stream.
+            The runtime can use dumpImage() to get ELF raw bytes, which are serialized in memory.
 
         'eclass' is ELF's bitness and it must be the same as the eclass of ELF to
         be loaded (for example, rawElfBytes).
@@ -237,8 +243,8 @@ public:
     ~Elf ();
 
     /*
-     * dumpImage() will finalize the ELF and write it into the file/stream. It then reads
-     * it into the memory; and returns it via <buff, len>.
+     * dumpImage() will finalize the ELF and serialize it in memory. It's also written into
+     * the file if the file name was provided; and returns it via <buff, len>.
      * The memory pointed by buff is new'ed in Elf and should be deleted by caller
      * if dumpImage() succeeds.
      */
@@ -327,13 +333,13 @@ public:
 
     bool isSuccessful() const { return _successful; }
 
-    bool isHsaCo() const { return _elfio.get_machine() == EM_AMDGPU; }
+    bool isHsaCo() const { return getMachine() == EM_AMDGPU; }
 
     /* Return number of segments */
     unsigned int getSegmentNum() const;
 
     /* Return segment at index */
-    bool getSegment(const unsigned int index, segment*& seg) const;
+    bool getSegment(const unsigned int index, const ElfView::Segment*& seg) const;
 
     /* Return size of elf file */
     static uint64_t getElfSize(const void *emi);
@@ -348,6 +354,12 @@ private:
     /* Initialization */
     bool Init();
 
+    /* The object was loaded from raw ELF bytes */
+    bool isReader() const { return _elfCmd == ELF_C_READ; }
+
+    /* Return machine field from header */
+    Elf64_Half getMachine() const { return isReader() ? _view.machine() : _elfio.get_machine(); }
+
     /*
      * Initialize ELF object by creating ELF header and key sections such as
      * .shstrtab, .strtab, and .symtab.
@@ -400,11 +412,6 @@ private:
      */
     bool getShstrtabNdx(Elf64_Word& outNdx, const char*);
 
-    /*
-     * Generate UUID string
-     */
-    static std::string generateUUIDV4();
-
     /*
      * Return newly-allocated memory or nullptr
      * The allocated memory is guaranteed to be initialized to zero.
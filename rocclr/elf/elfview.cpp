@@ -0,0 +1,313 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#include "elf/elfview.hpp"
+
+#include <cstring>
+
+#include "top.hpp"
+#include "os/os.hpp"
+#include "utils/flags.hpp"
+#include "utils/debug.hpp"
+#include "elf/elfio/elf_types.hpp"
+
+namespace amd {
+using namespace amd::ELFIO;
+
+namespace {
+
+//! Returns true if the range [offset, offset + size) is inside the image
+inline bool InRange(uint64_t offset, uint64_t size, size_t image_size) {
+  return (offset <= image_size) && (size <= image_size - offset);
+}
+
+//! Reads a header from a possibly unaligned location of the image
+template <typename T>
+inline T Load(const char* ptr) {
+  T value;
+  memcpy(&value, ptr, sizeof(T));
+  return value;
+}
+
+constexpr uint32_t kNoteAlign = sizeof(Elf_Word);
+
+inline uint64_t NoteAlign(uint64_t size) {
+  return (size + kNoteAlign - 1) & ~static_cast<uint64_t>(kNoteAlign - 1);
+}
+
+}  // namespace
+
+// ================================================================================================
+bool ElfView::Init(const void* image, size_t size) {
+  Release();
+  if ((image == nullptr) || (size < EI_NIDENT)) {
+    LogError("Invalid ELF image");
+    return false;
+  }
+  image_ = static_cast<const char*>(image);
+  size_ = size;
+
+  bool result = false;
+  if ((image_[EI_MAG0] != ELFMAG0) || (image_[EI_MAG1] != ELFMAG1) ||
+      (image_[EI_MAG2] != ELFMAG2) || (image_[EI_MAG3] != ELFMAG3)) {
+    LogError("Invalid ELF magic");
+  } else if (image_[EI_DATA] != ELFDATA2LSB) {
+    LogPrintfError("Unsupported ELF data encoding %d", image_[EI_DATA]);
+  } else if (image_[EI_CLASS] == ELFCLASS64) {
+    result = Parse<Elf64_Ehdr, Elf64_Shdr, Elf64_Phdr>();
+  } else if (image_[EI_CLASS] == ELFCLASS32) {
+    result = Parse<Elf32_Ehdr, Elf32_Shdr, Elf32_Phdr>();
+  } else {
+    LogPrintfError("Unsupported ELF class %d", image_[EI_CLASS]);
+  }
+
+  if (!result) {
+    Release();
+  }
+  return result;
+}
+
+// ================================================================================================
+bool ElfView::InitFromFile(const char* fname) {
+  Release();
+  const void* image = nullptr;
+  size_t size = 0;
+  if (!Os::MemoryMapFile(fname, &image, &size)) {
+    LogPrintfError("Cannot map ELF file %s", fname);
+    return false;
+  }
+  if (!Init(image, size)) {
+    Os::MemoryUnmapFile(image, size);
+    return false;
+  }
+  mapped_ = true;
+  return true;
+}
+
+// ================================================================================================
+void ElfView::Release() {
+  if (mapped_) {
+    Os::MemoryUnmapFile(image_, size_);
+    mapped_ = false;
+  }
+  image_ = nullptr;
+  size_ = 0;
+  class_ = ELFCLASSNONE;
+  type_ = ET_NONE;
+  machine_ = EM_NONE;
+  flags_ = 0;
+  shstrndx_ = SHN_UNDEF;
+  sections_.clear();
+  segments_.clear();
+}
+
+// ================================================================================================
+template <typename Ehdr, typename Shdr, typename Phdr>
+bool ElfView::Parse() {
+  if (size_ < sizeof(Ehdr)) {
+    LogPrintfError("ELF image is too small: %zu", size_);
+    return false;
+  }
+  const Ehdr ehdr = Load<Ehdr>(image_);
+  class_ = ehdr.e_ident[EI_CLASS];
+  type_ = ehdr.e_type;
+  machine_ = ehdr.e_machine;
+  flags_ = ehdr.e_flags;
+  shstrndx_ = ehdr.e_shstrndx;
+
+  // Section headers
+  if (ehdr.e_shnum != 0) {
+    if ((ehdr.e_shentsize < sizeof(Shdr)) ||
+        !InRange(ehdr.e_shoff, static_cast<uint64_t>(ehdr.e_shentsize) * ehdr.e_shnum, size_)) {
+      LogPrintfError("Invalid section headers: offset %llu, count %u",
+                     static_cast<unsigned long long>(ehdr.e_shoff), ehdr.e_shnum);
+      return false;
+    }
+    sections_.resize(ehdr.e_shnum);
+    for (uint32_t i = 0; i < ehdr.e_shnum; ++i) {
+      const Shdr shdr = Load<Shdr>(image_ + ehdr.e_shoff + i * ehdr.e_shentsize);
+      Section& section = sections_[i];
+      section.name_ = nullptr;
+      section.type_ = shdr.sh_type;
+      section.flags_ = shdr.sh_flags;
+      section.size_ = shdr.sh_size;
+      section.link_ = shdr.sh_link;
+      section.entsize_ = shdr.sh_entsize;
+      section.data_ = nullptr;
+      if ((shdr.sh_type != SHT_NULL) && (shdr.sh_type != SHT_NOBITS)) {
+        if (!InRange(shdr.sh_offset, shdr.sh_size, size_)) {
+          LogPrintfError("Section %u is out of the image: offset %llu, size %llu", i,
+                         static_cast<unsigned long long>(shdr.sh_offset),
+                         static_cast<unsigned long long>(shdr.sh_size));
+          return false;
+        }
+        section.data_ = image_ + shdr.sh_offset;
+      }
+    }
+    if (shstrndx_ >= sections_.size()) {
+      LogPrintfError("Invalid section names table index %u", shstrndx_);
+      return false;
+    }
+    // Resolve the names after the section names table is known
+    for (uint32_t i = 0; i < ehdr.e_shnum; ++i) {
+      const Shdr shdr = Load<Shdr>(image_ + ehdr.e_shoff + i * ehdr.e_shentsize);
+      const char* name = String(shstrndx_, shdr.sh_name);
+      sections_[i].name_ = (name != nullptr) ? name : "";
+    }
+  }
+
+  // Program headers
+  if (ehdr.e_phnum != 0) {
+    if ((ehdr.e_phentsize < sizeof(Phdr)) ||
+        !InRange(ehdr.e_phoff, static_cast<uint64_t>(ehdr.e_phentsize) * ehdr.e_phnum, size_)) {
+      LogPrintfError("Invalid program headers: offset %llu, count %u",
+                     static_cast<unsigned long long>(ehdr.e_phoff), ehdr.e_phnum);
+      return false;
+    }
+    segments_.resize(ehdr.e_phnum);
+    for (uint32_t i = 0; i < ehdr.e_phnum; ++i) {
+      const Phdr phdr = Load<Phdr>(image_ + ehdr.e_phoff + i * ehdr.e_phentsize);
+      Segment& segment = segments_[i];
+      segment.type_ = phdr.p_type;
+      segment.flags_ = phdr.p_flags;
+      segment.offset_ = phdr.p_offset;
+      segment.vaddr_ = phdr.p_vaddr;
+      segment.file_size_ = phdr.p_filesz;
+      segment.memory_size_ = phdr.p_memsz;
+    }
+  }
+  return true;
+}
+
+// ================================================================================================
+const char* ElfView::String(uint32_t strtab, uint64_t offset) const {
+  if (strtab >= sections_.size()) {
+    return nullptr;
+  }
+  const Section& section = sections_[strtab];
+  if ((section.data_ == nullptr) || (offset >= section.size_)) {
+    return nullptr;
+  }
+  // The string must be terminated inside the table
+  const char* str = section.data_ + offset;
+  if (memchr(str, '\0', section.size_ - offset) == nullptr) {
+    return nullptr;
+  }
+  return str;
+}
+
+// ================================================================================================
+uint32_t ElfView::FindSection(const char* name) const {
+  for (uint32_t i = 1; i < sections_.size(); ++i) {
+    if (strcmp(sections_[i].name_, name) == 0) {
+      return i;
+    }
+  }
+  return SHN_UNDEF;
+}
+
+// ================================================================================================
+size_t ElfView::SymbolNum(uint32_t symtab) const {
+  if ((symtab == SHN_UNDEF) || (symtab >= sections_.size())) {
+    return 0;
+  }
+  const Section& section = sections_[symtab];
+  const size_t entsize = (class_ == ELFCLASS64) ? sizeof(Elf64_Sym) : sizeof(Elf32_Sym);
+  if ((section.data_ == nullptr) || (section.entsize_ < entsize)) {
+    return 0;
+  }
+  return static_cast<size_t>(section.size_ / section.entsize_);
+}
+
+// ================================================================================================
+bool ElfView::GetSymbol(uint32_t symtab, size_t index, Symbol* symbol) const {
+  if (index >= SymbolNum(symtab)) {
+    return false;
+  }
+  const Section& section = sections_[symtab];
+  const char* entry = section.data_ + index * section.entsize_;
+  uint32_t name = 0;
+  if (class_ == ELFCLASS64) {
+    const Elf64_Sym sym = Load<Elf64_Sym>(entry);
+    name = sym.st_name;
+    symbol->value_ = sym.st_value;
+    symbol->size_ = sym.st_size;
+    symbol->bind_ = ELF_ST_BIND(sym.st_info);
+    symbol->type_ = ELF_ST_TYPE(sym.st_info);
+    symbol->section_index_ = sym.st_shndx;
+  } else {
+    const Elf32_Sym sym = Load<Elf32_Sym>(entry);
+    name = sym.st_name;
+    symbol->value_ = sym.st_value;
+    symbol->size_ = sym.st_size;
+    symbol->bind_ = ELF_ST_BIND(sym.st_info);
+    symbol->type_ = ELF_ST_TYPE(sym.st_info);
+    symbol->section_index_ = sym.st_shndx;
+  }
+  const char* str = String(section.link_, name);
+  symbol->name_ = (str != nullptr) ? str : "";
+  return true;
+}
+
+// ================================================================================================
+bool ElfView::FindSymbol(uint32_t symtab, const char* name, const char* sec_name,
+                         Symbol* symbol) const {
+  const size_t num = SymbolNum(symtab);
+  // Skip the reserved undefined symbol 0
+  for (size_t i = 1; i < num; ++i) {
+    if (!GetSymbol(symtab, i, symbol) || (strcmp(symbol->name_, name) != 0)) {
+      continue;
+    }
+    const Section* section = GetSection(symbol->section_index_);
+    if ((section != nullptr) && (strcmp(section->name_, sec_name) == 0)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// ================================================================================================
+bool ElfView::FindNote(uint32_t section, const char* name, const char** desc,
+                       size_t* desc_size) const {
+  const Section* notes = GetSection(section);
+  if ((notes == nullptr) || (notes->data_ == nullptr)) {
+    return false;
+  }
+  const size_t name_size = strlen(name) + 1;
+  uint64_t offset = 0;
+  while (offset + 3 * kNoteAlign <= notes->size_) {
+    const char* note = notes->data_ + offset;
+    const uint32_t namesz = Load<Elf_Word>(note);
+    const uint32_t descsz = Load<Elf_Word>(note + kNoteAlign);
+    const uint64_t desc_offset = 3 * kNoteAlign + NoteAlign(namesz);
+    if (!InRange(offset + desc_offset, descsz, notes->size_)) {
+      break;
+    }
+    if ((namesz == name_size) && (memcmp(note + 3 * kNoteAlign, name, name_size - 1) == 0)) {
+      *desc = (descsz != 0) ? note + desc_offset : nullptr;
+      *desc_size = descsz;
+      return true;
+    }
+    offset += desc_offset + NoteAlign(descsz);
+  }
+  return false;
+}
+
+}  // namespace amd
@@ -0,0 +1,130 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace amd {
+
+//! Read-only view of a little endian ELF image. Headers, sections, symbols and notes are
+//! parsed in place, so all returned pointers reference the image itself and stay valid
+//! for the lifetime of the view. The image is either owned by the caller or mapped from a file.
+class ElfView {
+ public:
+  //! Section header, normalized for both ELF classes
+  struct Section {
+    const char* name_;   //!< Section name from .shstrtab
+    uint32_t type_;      //!< SHT_* type
+    uint64_t flags_;     //!< SHF_* flags
+    const char* data_;   //!< Section data in the image, nullptr for SHT_NOBITS
+    uint64_t size_;      //!< Section size
+    uint32_t link_;      //!< Linked section index
+    uint64_t entsize_;   //!< Size of a table entry
+  };
+
+  //! Program header, normalized for both ELF classes
+  struct Segment {
+    uint32_t type_;         //!< PT_* type
+    uint32_t flags_;        //!< PF_* flags
+    uint64_t offset_;       //!< Offset in the image
+    uint64_t vaddr_;        //!< Virtual address
+    uint64_t file_size_;    //!< Size in the image
+    uint64_t memory_size_;  //!< Size in memory
+  };
+
+  //! Symbol table entry
+  struct Symbol {
+    const char* name_;        //!< Symbol name from the linked string table
+    uint64_t value_;          //!< Symbol value
+    uint64_t size_;           //!< Symbol size
+    uint8_t bind_;            //!< STB_* binding
+    uint8_t type_;            //!< STT_* type
+    uint16_t section_index_;  //!< Index of the section, which defines the symbol
+  };
+
+  ElfView() = default;
+  ~ElfView() { Release(); }
+
+  ElfView(const ElfView&) = delete;
+  ElfView& operator=(const ElfView&) = delete;
+
+  //! Parses the caller owned image. The image must outlive the view
+  bool Init(const void* image, size_t size);
+
+  //! Maps the file and parses it. The mapping is released with the view
+  bool InitFromFile(const char* fname);
+
+  //! Drops the parsed state and unmaps the file
+  void Release();
+
+  const char* image() const { return image_; }
+  size_t size() const { return size_; }
+
+  uint8_t elfClass() const { return class_; }
+  uint16_t type() const { return type_; }
+  uint16_t machine() const { return machine_; }
+  uint32_t flags() const { return flags_; }
+  uint32_t shstrndx() const { return shstrndx_; }
+
+  size_t SectionNum() const { return sections_.size(); }
+  const Section* GetSection(size_t index) const {
+    return (index < sections_.size()) ? &sections_[index] : nullptr;
+  }
+  //! Returns the index of the first section with the name or 0 (SHN_UNDEF) if not found
+  uint32_t FindSection(const char* name) const;
+
+  size_t SegmentNum() const { return segments_.size(); }
+  const Segment* GetSegment(size_t index) const {
+    return (index < segments_.size()) ? &segments_[index] : nullptr;
+  }
+
+  //! Returns the number of entries in the symbol table, including the reserved symbol 0
+  size_t SymbolNum(uint32_t symtab) const;
+  //! Reads the symbol at the index of the symbol table section
+  bool GetSymbol(uint32_t symtab, size_t index, Symbol* symbol) const;
+  //! Finds the symbol by name, which is defined in the section with the name
+  bool FindSymbol(uint32_t symtab, const char* name, const char* sec_name, Symbol* symbol) const;
+
+  //! Finds the note by name in the section and returns its description
+  bool FindNote(uint32_t section, const char* name, const char** desc, size_t* desc_size) const;
+
+ private:
+  template <typename Ehdr, typename Shdr, typename Phdr>
+  bool Parse();
+
+  //! Returns a NUL terminated string at the offset of the string table or nullptr
+  const char* String(uint32_t strtab, uint64_t offset) const;
+
+  const char* image_ = nullptr;      //!< ELF image
+  size_t size_ = 0;                  //!< Size of the image
+  bool mapped_ = false;              //!< The image was mapped from a file
+  uint8_t class_ = 0;                //!< ELFCLASS32/ELFCLASS64
+  uint16_t type_ = 0;                //!< e_type
+  uint16_t machine_ = 0;             //!< e_machine
+  uint32_t flags_ = 0;               //!< e_flags
+  uint32_t shstrndx_ = 0;            //!< Index of the section names table
+  std::vector<Section> sections_;    //!< All sections, including the null section 0
+  std::vector<Segment> segments_;    //!< All program headers
+};
+
+}  // namespace amd
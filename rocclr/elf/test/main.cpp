@@ -19,9 +19,18 @@
  THE SOFTWARE. */
 
 #include <elf/elf.hpp>
+#include <elf/elfview.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
 #include <string>
+#include <vector>
 #include <utils/flags.hpp>
 #include <utils/debug.hpp>
+#if defined(__linux__)
+#include <unistd.h>
+#endif
 
 using namespace amd::ELFIO;
 
@@ -341,6 +350,18 @@ bool test(unsigned char eclass = ELFCLASS64, const char *outFile =
       ret = verify(reader);
 
       delete reader;
+      reader = nullptr;
+
+      // Load the saved file through the memory mapped view
+      if (ret && outFile != nullptr) {
+        reader = new amd::Elf(eclass, nullptr, 0, outFile, amd::Elf::ELF_C_READ);
+        if (!reader->isSuccessful()) {
+          LogError("Creating file reader ELF object failed");
+          ret = false;
+          break;
+        }
+        ret = verify(reader);
+      }
     }
   } while (false);
 
@@ -355,7 +376,95 @@ bool test(unsigned char eclass = ELFCLASS64, const char *outFile =
   return ret;
 }
 
-int main() {
+// Returns the resident set size of the process in bytes
+static size_t rss() {
+  size_t pages = 0;
+#if defined(__linux__)
+  FILE* statm = fopen("/proc/self/statm", "r");
+  if (statm != nullptr) {
+    size_t total = 0;
+    if (fscanf(statm, "%zu %zu", &total, &pages) != 2) {
+      pages = 0;
+    }
+    fclose(statm);
+  }
+  return pages * sysconf(_SC_PAGESIZE);
+#else
+  return pages;
+#endif
+}
+
+// Measures the load time and the memory footprint of a large code object with
+// the symbol lookup, similar to the runtime loading a program
+bool benchmark(unsigned char eclass, size_t imageSize, unsigned int iterations) {
+  const char* benchFile = "elf_bench.bin";
+  amd::Elf writer(eclass, nullptr, 0, benchFile, amd::Elf::ELF_C_WRITE);
+  if (!writer.isSuccessful() || !set(&writer)) {
+    LogError("Creating benchmark ELF object failed");
+    return false;
+  }
+  std::vector<char> text(imageSize);
+  for (size_t i = 0; i < text.size(); ++i) {
+    text[i] = static_cast<char>(i * 31);
+  }
+  if (!writer.addSymbol(amd::Elf::RODATA, "data__text", text.data(), text.size())) {
+    LogError("Adding benchmark symbol failed");
+    return false;
+  }
+
+  char* image = nullptr;
+  size_t imageLen = 0;
+  auto start = std::chrono::steady_clock::now();
+  if (!writer.dumpImage(&image, &imageLen)) {
+    LogError("Benchmark dumpImage failed");
+    return false;
+  }
+  auto dumpUs = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start).count();
+
+  bool ret = true;
+  size_t rssBase = rss();
+  size_t rssPeak = rssBase;
+  start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < iterations && ret; ++i) {
+    amd::Elf reader(eclass, image, imageLen, nullptr, amd::Elf::ELF_C_READ);
+    char* buffer = nullptr;
+    size_t size = 0;
+    ret = reader.isSuccessful() &&
+          reader.getSymbol(amd::Elf::RODATA, "data__text", &buffer, &size) &&
+          (size == text.size());
+    // Check the content once, so the loop measures only the load
+    if (ret && i == 0) {
+      ret = (memcmp(buffer, text.data(), size) == 0);
+    }
+    rssPeak = std::max(rssPeak, rss());
+  }
+  auto loadUs = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start).count();
+  delete [] image;
+
+  size_t rssMapped = 0;
+  start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < iterations && ret; ++i) {
+    amd::ElfView view;
+    ret = view.InitFromFile(benchFile) && (view.FindSection(".rodata") != 0);
+    rssMapped = std::max(rssMapped, rss());
+  }
+  auto mapUs = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start).count();
+  std::remove(benchFile);
+
+  printf("%s: image %zu bytes, dump %lld us\n", __func__, imageLen,
+         static_cast<long long>(dumpUs));
+  printf("%s: buffer load %.1f us/iter, RSS growth %zu KB\n", __func__,
+         static_cast<double>(loadUs) / iterations, (rssPeak - rssBase) / 1024);
+  printf("%s: mmap load %.1f us/iter, RSS growth %zu KB\n", __func__,
+         static_cast<double>(mapUs) / iterations,
+         (std::max(rssMapped, rssBase) - rssBase) / 1024);
+  return ret;
+}
+
+int main(int argc, char** argv) {
   bool ret = false;
   amd::Flag::init();
   unsigned char eclass = LP64_SWITCH(ELFCLASS32, ELFCLASS64);
@@ -372,5 +481,14 @@ int main() {
            eclass == ELFCLASS32 ? "ELFCLASS32" : "ELFCLASS64",
            ret ? "Succeeded" : "Failed");
   }
-  return 0;
+
+  if (ret) {
+    // elf_test [image size in MB] [iterations]
+    size_t imageSize = ((argc > 1) ? strtoul(argv[1], nullptr, 0) : 64) * 1024 * 1024;
+    unsigned int iterations = (argc > 2) ? strtoul(argv[2], nullptr, 0) : 100;
+    ret = benchmark(eclass, imageSize, (iterations != 0) ? iterations : 1);
+    printf("%s: benchmark(%zu MB, %u iterations) %s!\n", __func__, imageSize / (1024 * 1024),
+           iterations, ret ? "Succeeded" : "Failed");
+  }
+  return ret ? 0 : 1;
 }
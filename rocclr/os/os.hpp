@@ -24,6 +24,7 @@
 #include "top.hpp"
 #include "utils/util.hpp"
 
+#include <atomic>
 #include <vector>
 #include <string>
 
@@ -206,6 +207,12 @@ class Os : AllStatic {
   static void yield();
   //! Execute a pause instruction (for spin loops).
   static void spinPause();
+  //! Block until the 32-bit word in memory, possibly shared between processes, doesn't
+  //! contain the value, a wakeup or the timeout in ns. Spurious returns are possible.
+  static void SharedAddressWait(const std::atomic<uint32_t>* address, uint32_t value,
+                                uint64_t timeout_ns);
+  //! Wake all threads in all processes, which are blocked on the 32-bit word
+  static void SharedAddressWake(std::atomic<uint32_t>* address);
 
   // Memory routines:
   //
@@ -41,6 +41,9 @@
 #include <signal.h>
 
 #include <sys/prctl.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <climits>
 
 #include <link.h>
 #include <time.h>
@@ -428,6 +431,30 @@ bool Os::setThreadAffinityToMainThread() {
 
 void Os::yield() { ::sched_yield(); }
 
+// ================================================================================================
+void Os::SharedAddressWait(const std::atomic<uint32_t>* address, uint32_t value,
+                           uint64_t timeout_ns) {
+#if defined(__linux__)
+  static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Futex requires a 32-bit word");
+  struct timespec timeout;
+  timeout.tv_sec = timeout_ns / (1000ULL * 1000ULL * 1000ULL);
+  timeout.tv_nsec = timeout_ns % (1000ULL * 1000ULL * 1000ULL);
+  // Shared futex, since the word can be mapped into a few processes
+  ::syscall(SYS_futex, address, FUTEX_WAIT, value, &timeout, nullptr, 0);
+#else
+  if (address->load(std::memory_order_acquire) == value) {
+    Os::sleep(1);
+  }
+#endif
+}
+
+// ================================================================================================
+void Os::SharedAddressWake(std::atomic<uint32_t>* address) {
+#if defined(__linux__)
+  ::syscall(SYS_futex, address, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+}
+
 uint64_t Os::timeNanos() {
   struct timespec tp;
   ::clock_gettime(CLOCK_MONOTONIC, &tp);
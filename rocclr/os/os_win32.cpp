@@ -348,6 +348,20 @@ bool Os::setThreadAffinityToMainThread() {
 }
 void Os::yield() { ::SwitchToThread(); }
 
+// ================================================================================================
+void Os::SharedAddressWait(const std::atomic<uint32_t>* address, uint32_t value,
+                           uint64_t timeout_ns) {
+  // WaitOnAddress() works only within a process, hence poll the shared word
+  if (address->load(std::memory_order_acquire) == value) {
+    ::Sleep(1);
+  }
+}
+
+// ================================================================================================
+void Os::SharedAddressWake(std::atomic<uint32_t>* address) {
+  // Waiters poll the shared word
+}
+
 uint64_t Os::timeNanos() {
   LARGE_INTEGER current;
   QueryPerformanceCounter(&current);
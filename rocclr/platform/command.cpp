@@ -363,6 +363,7 @@ void Command::enqueue() {
   // update will occur later after flush() with a wait
   if (AMD_DIRECT_DISPATCH) {
     setStatus(CL_QUEUED);
+    enqueueCorrelationId_ = activity_prof::correlation_id;
 
     // Notify all commands about the waiter. Barrier will be sent in order to obtain
     // HSA signal for a wait on the current queue
@@ -372,25 +373,24 @@ void Command::enqueue() {
 
     // The batch update must be lock protected to avoid a race condition
     // when multiple threads submit/flush/update the batch at the same time
-    ScopedLock sl(queue_->vdev()->execution());
-    queue_->FormSubmissionBatch(this);
-
-    // Enqueue flushes, except profiling markers to avoid frequent expensive callbacks
-    if (((type() == 0) && profilingInfo().batch_flush_) ||
-        (type() == CL_COMMAND_MARKER) || (type() == CL_COMMAND_TASK)) {
-      // The current HSA signal tracking logic requires profiling enabled for the markers
-      EnableProfiling();
-      // Update batch head for the current marker. Hence the status of all commands can be
-      // updated upon the marker completion
-      SetBatchHead(queue_->GetSubmissionBatch());
-
-      submit(*queue_->vdev());
-
-      // The batch will be tracked with the marker now
-      queue_->ResetSubmissionBatch();
+    if (DEBUG_CLR_SUBMIT_COMBINE) {
+      // The thread, which holds the lock, submits the commands of all contending threads
+      device::VirtualDevice* vdev = queue_->vdev();
+      queue_->combiner().Submit(this, vdev->execution(),
+          [vdev](Command* const* commands, size_t count) {
+            if (count > 1) {
+              vdev->beginSubmitBatch();
+            }
+            for (size_t i = 0; i < count; ++i) {
+              commands[i]->submitDirect();
+            }
+            if (count > 1) {
+              vdev->endSubmitBatch();
+            }
+          });
     } else {
-      submit(*queue_->vdev());
-      queue_->FlushSubmissionBatch(this);
+      ScopedLock sl(queue_->vdev()->execution());
+      submitDirect();
     }
   } else {
     queue_->append(*this);
@@ -406,6 +406,29 @@ void Command::enqueue() {
   queue_->SetQueueStatus();
 }
 
+// ================================================================================================
+void Command::submitDirect() {
+  queue_->FormSubmissionBatch(this);
+
+  // Enqueue flushes, except profiling markers to avoid frequent expensive callbacks
+  if (((type() == 0) && profilingInfo().batch_flush_) ||
+      (type() == CL_COMMAND_MARKER) || (type() == CL_COMMAND_TASK)) {
+    // The current HSA signal tracking logic requires profiling enabled for the markers
+    EnableProfiling(enqueueCorrelationId_);
+    // Update batch head for the current marker. Hence the status of all commands can be
+    // updated upon the marker completion
+    SetBatchHead(queue_->GetSubmissionBatch());
+
+    submit(*queue_->vdev());
+
+    // The batch will be tracked with the marker now
+    queue_->ResetSubmissionBatch();
+  } else {
+    submit(*queue_->vdev());
+    queue_->FlushSubmissionBatch(this);
+  }
+}
+
 // ================================================================================================
 const Context& Command::context() const { return queue_->context(); }
 
@@ -801,10 +824,12 @@ bool CopyMemoryP2PCommand::validateMemory() {
 
 // ================================================================================================
 bool SvmPrefetchAsyncCommand::validateMemory() {
-  amd::Memory* svmMem = amd::MemObjMap::FindMemObj(dev_ptr());
-  if (nullptr == svmMem) {
-    LogPrintfError("SvmPrefetchAsync received unknown memory for prefetch: %p!", dev_ptr());
-    return false;
+  for (const auto& range : ranges_) {
+    amd::Memory* svmMem = amd::MemObjMap::FindMemObj(range.first);
+    if (nullptr == svmMem) {
+      LogPrintfError("SvmPrefetchAsync received unknown memory for prefetch: %p!", range.first);
+      return false;
+    }
   }
   return true;
 }
@@ -145,11 +145,12 @@ class Event : public RuntimeObject {
   //! Process the callbacks for the given \a status change.
   void processCallbacks(int32_t status) const;
 
-  //! Enable profiling for this command
-  void EnableProfiling() {
+  //! Enable profiling for this command. The correlation ID belongs to the API call, which
+  //! enqueued the command, and defaults to the one of the calling thread
+  void EnableProfiling(uint64_t correlation_id = amd::activity_prof::correlation_id) {
     profilingInfo_.enabled_ = true;
     profilingInfo_.clear();
-    profilingInfo_.correlation_id_ = amd::activity_prof::correlation_id;
+    profilingInfo_.correlation_id_ = correlation_id;
   }
 
  public:
@@ -284,6 +285,10 @@ class Command : public Event {
   //! 0x1 - wait before enqueue, 0x2 - wait after, 0x3 - wait both
   uint32_t commandWaitBits_;
 
+  //! Correlation ID of the API call, which enqueued the command. The submission can run on
+  //! another thread, when the contending submissions are combined
+  uint64_t enqueueCorrelationId_ = 0;
+
   //! Construct a new command of the given OpenCL type.
   Command(HostQueue& queue, cl_command_type type,
           const EventWaitList& eventWaitList = nullWaitList,
@@ -357,6 +362,9 @@ class Command : public Event {
   //! Enqueue this command into the associated command queue.
   void enqueue();
 
+  //! Submits the command in the direct dispatch mode. Must be called under the execution lock
+  void submitDirect();
+
   //! Return the event encapsulating this command's status.
   const Event& event() const { return *this; }
   Event& event() { return *this; }
@@ -1807,23 +1815,33 @@ class CopyMemoryP2PCommand : public CopyMemoryCommand {
  *  \details    Prefetches SVM memory into the destination device or CPU
  */
 class SvmPrefetchAsyncCommand : public Command {
-  const void* dev_ptr_;   //!< Device pointer to memory for prefetch
-  size_t count_;          //!< the size for prefetch
+ public:
+  typedef std::pair<const void*, size_t> Range;
+
+ private:
+  std::vector<Range> ranges_;  //!< Memory ranges for prefetch
   bool cpu_access_;       //!< Prefetch data into CPU location
   amd::Device* dev_;      //!< Destination device to prefetch to
 
  public:
   SvmPrefetchAsyncCommand(HostQueue& queue, const EventWaitList& eventWaitList,
                           const void* dev_ptr, size_t count, amd::Device* dev, bool cpu_access)
-      : Command(queue, 1, eventWaitList), dev_ptr_(dev_ptr), count_(count),
+      : Command(queue, 1, eventWaitList), ranges_(1, Range(dev_ptr, count)),
+        cpu_access_(cpu_access), dev_(dev) {}
+
+  //! Prefetches a batch of disjoint ranges into the same location
+  SvmPrefetchAsyncCommand(HostQueue& queue, const EventWaitList& eventWaitList,
+                          std::vector<Range>&& ranges, amd::Device* dev, bool cpu_access)
+      : Command(queue, 1, eventWaitList), ranges_(std::move(ranges)),
         cpu_access_(cpu_access), dev_(dev) {}
 
   virtual void submit(device::VirtualDevice& device) { device.submitSvmPrefetchAsync(*this); }
 
   bool validateMemory();
 
-  const void* dev_ptr() const { return dev_ptr_; }
-  size_t count() const { return count_; }
+  const void* dev_ptr() const { return ranges_[0].first; }
+  size_t count() const { return ranges_[0].second; }
+  const std::vector<Range>& ranges() const { return ranges_; }
   amd::Device* device() const { return dev_; }
   size_t cpu_access() const { return cpu_access_; }
 };
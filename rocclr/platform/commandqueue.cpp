@@ -176,8 +176,18 @@ void HostQueue::finish(bool cpu_wait) {
         device_.removeFromActiveQueues(this);
         lastEnqueueCommand_->release();
         lastEnqueueCommand_ = nullptr;
+        // The queue is drained, so it can move to another HW queue
+        if (vdev()->IsRebalanceDue()) {
+          vdev()->RebalanceQueue();
+        }
       }
     }
+  } else if (IS_HIP && vdev()->IsRebalanceDue()) {
+    ScopedLock sl(vdev()->execution());
+    ScopedLock l(lastCmdLock_);
+    if (command == lastEnqueueCommand_) {
+      vdev()->RebalanceQueue();
+    }
   }
 
   command->release();
@@ -29,6 +29,7 @@
 #define COMMAND_QUEUE_HPP_
 
 #include "thread/thread.hpp"
+#include "thread/submitcombiner.hpp"
 #include "platform/object.hpp"
 #include "platform/command.hpp"
 /*! \brief Holds commands that will be executed on a specific device.
@@ -297,6 +298,9 @@ class HostQueue : public CommandQueue {
   //! Set the force destory to terminate queue without checking last command
   void SetForceDestroy(bool forceDestroy) { forceDestroy_ = forceDestroy; }
 
+  //! Returns the combiner of the direct dispatch submissions from multiple threads
+  SubmitCombiner<Command>& combiner() { return combiner_; }
+
   uint64_t getQueueID() {
     return thread_.vdev()->getQueueID();
   }
@@ -309,6 +313,7 @@ private:
   //! True if this command queue is active
   bool isActive_;
   bool forceDestroy_ = false;  //!< Destroy the queue in the current state
+  SubmitCombiner<Command> combiner_;  //!< Combines the submissions of the threads
 };
 
 class DeviceQueue : public CommandQueue {
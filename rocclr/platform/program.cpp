@@ -702,7 +702,10 @@ bool Program::ParseAllOptions(const std::string& options, option::Options& parse
 }
 
 bool Symbol::setDeviceKernel(const Device& device, const device::Kernel* func) {
-  if (deviceKernels_.size() == 0 ||
+  if (func->isLazy()) {
+    // The signature of a stub kernel is picked on the first use
+    lazy_.store(true, std::memory_order_relaxed);
+  } else if (deviceKernels_.size() == 0 ||
       // Always pick the most recent version in MGPU case
       (func->signature().version() > signature_.version())) {
     signature_ = func->signature();
@@ -714,9 +717,31 @@ bool Symbol::setDeviceKernel(const Device& device, const device::Kernel* func) {
 const device::Kernel* Symbol::getDeviceKernel(const Device& device) const {
   auto it = deviceKernels_.find(&device);
   if (it != deviceKernels_.cend()) {
-    return it->second;
+    return it->second->materialize() ? it->second : nullptr;
   }
   return nullptr;
 }
 
+const KernelSignature& Symbol::signature() const {
+  if (lazy_.load(std::memory_order_acquire)) {
+    static Monitor lock;
+    ScopedLock sl(lock);
+    if (lazy_.load(std::memory_order_relaxed)) {
+      bool first = true;
+      for (const auto& it : deviceKernels_) {
+        if (!it.second->materialize()) {
+          continue;
+        }
+        // Always pick the most recent version in MGPU case
+        if (first || (it.second->signature().version() > signature_.version())) {
+          signature_ = it.second->signature();
+          first = false;
+        }
+      }
+      lazy_.store(false, std::memory_order_release);
+    }
+  }
+  return signature_;
+}
+
 }  // namespace amd
@@ -56,7 +56,8 @@ class Symbol : public HeapObject {
 
  private:
   devicekernels_t deviceKernels_;    //! All device kernels objects.
-  KernelSignature signature_;        //! Kernel signature.
+  mutable KernelSignature signature_;  //! Kernel signature.
+  mutable std::atomic<bool> lazy_ = false;  //! A device kernel is a stub without signature
 
  public:
   //! Default constructor
@@ -71,8 +72,8 @@ class Symbol : public HeapObject {
   const device::Kernel* getDeviceKernel(const Device& device //!< Device object.
                                         ) const;
 
-  //! Return this Symbol's signature.
-  const KernelSignature& signature() const { return signature_; }
+  //! Return this Symbol's signature. Materializes the stub device kernels
+  const KernelSignature& signature() const;
 };
 
 class Context;
@@ -0,0 +1,96 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#pragma once
+
+#include <atomic>
+
+#include "top.hpp"
+#include "os/os.hpp"
+
+namespace amd {
+
+/*! \addtogroup Threads
+ *  @{
+ *
+ *  \addtogroup Synchronization
+ *  @{
+ */
+
+//! \brief Wait/wake word, which can be placed in memory shared between processes.
+//! A waiter spins for a bounded time on its condition and then blocks in the kernel.
+//! A completer changes the condition and calls Wake(), which enters the kernel only
+//! if somebody is blocked. The object has no constructor, since it lives in shared memory.
+struct SharedWaitWord {
+  std::atomic<uint32_t> sequence_;  //!< Bumped by every wake, the blocking word
+  std::atomic<uint32_t> waiters_;   //!< Number of blocked waiters in all processes
+
+  //! Timeout of a single block, which bounds a missed wakeup from a dead process
+  static constexpr uint64_t kBlockTimeoutNs = 10 * 1000 * 1000;
+
+  void Init() {
+    sequence_.store(0, std::memory_order_relaxed);
+    waiters_.store(0, std::memory_order_relaxed);
+  }
+
+  //! Waits until done() returns true. Spins for spin_ns before blocking
+  template <typename Done>
+  void Wait(Done done, uint64_t spin_ns) {
+    if (done()) {
+      return;
+    }
+    // Spinning on a single processor only delays the completer
+    const uint64_t spin_end = Os::timeNanos() + ((Os::processorCount() > 1) ? spin_ns : 0);
+    while (Os::timeNanos() < spin_end) {
+      for (uint32_t i = 0; i < 64; ++i) {
+        Os::spinPause();
+      }
+      if (done()) {
+        return;
+      }
+    }
+    while (true) {
+      uint32_t sequence = sequence_.load();
+      if (done()) {
+        return;
+      }
+      // Register before the final check, so the completer can't miss this waiter
+      waiters_.fetch_add(1);
+      if (!done()) {
+        Os::SharedAddressWait(&sequence_, sequence, kBlockTimeoutNs);
+      }
+      waiters_.fetch_sub(1);
+    }
+  }
+
+  //! Wakes the blocked waiters. Must be called after the condition has changed
+  void Wake() {
+    sequence_.fetch_add(1);
+    if (waiters_.load() != 0) {
+      Os::SharedAddressWake(&sequence_);
+    }
+  }
+};
+
+/*! @}
+ *  @}
+ */
+
+}  // namespace amd
@@ -0,0 +1,142 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+
+#pragma once
+
+#include <atomic>
+
+#include "top.hpp"
+#include "os/os.hpp"
+#include "thread/monitor.hpp"
+
+namespace amd {
+
+/*! \addtogroup Threads
+ *  @{
+ *
+ *  \addtogroup Synchronization
+ *  @{
+ */
+
+//! \brief Flat combining of the submissions to a lock protected queue.
+//! A thread publishes its item in a lock free list and tries the lock. The thread, which gets
+//! the lock, submits the published items of all threads as one batch, so the contending
+//! threads don't hand off the lock for every item. A thread returns after its item is
+//! submitted, hence the submission is still synchronous for the caller.
+template <typename T> class SubmitCombiner {
+ public:
+  //! Maximum number of items, passed to a single batch callback
+  static constexpr size_t kMaxBatch = 64;
+
+  SubmitCombiner() : published_(nullptr) {}
+
+  /*! \brief Submits the item under the lock.
+   *
+   *  \note batch(T* const* items, size_t count) is called with the lock held and gets
+   *  the items in the publication order. The items of a single thread keep their order.
+   */
+  template <typename Batch> void Submit(T* item, Monitor& lock, Batch batch) {
+    // A nested submission from a batch callback can't wait for the combiner, which is itself
+    if (active_ == this) {
+      ScopedLock sl(lock);
+      batch(&item, 1);
+      return;
+    }
+
+    Request request(item);
+    Request* head = published_.load(std::memory_order_relaxed);
+    do {
+      request.next_ = head;
+    } while (!published_.compare_exchange_weak(head, &request, std::memory_order_release,
+                                               std::memory_order_relaxed));
+
+    uint32_t spin = 0;
+    while (!request.done_.load(std::memory_order_acquire)) {
+      bool locked = lock.tryLock();
+      if (!locked && (++spin >= kMaxSpin)) {
+        // A long batch or another lock user holds the lock. Block on the lock, instead of
+        // burning the CPU: the owner either submits this item or hands the lock over
+        lock.lock();
+        locked = true;
+      }
+      if (locked) {
+        if (!request.done_.load(std::memory_order_acquire)) {
+          Combine(batch);
+        }
+        lock.unlock();
+        continue;
+      }
+      // The combiner holds the lock and will likely submit this item too
+      Os::spinPause();
+    }
+  }
+
+ private:
+  //! The published item of a waiting thread
+  struct Request {
+    explicit Request(T* item) : item_(item), next_(nullptr), done_(false) {}
+    T* item_;                  //!< The submitted item
+    Request* next_;            //!< The previously published request
+    std::atomic<bool> done_;   //!< The item was submitted
+  };
+
+  static constexpr uint32_t kMaxSpin = 1000;  //!< Spin iterations before blocking on the lock
+
+  //! Submits all published items. Must be called with the lock held
+  template <typename Batch> void Combine(Batch& batch) {
+    Request* list = published_.exchange(nullptr, std::memory_order_acquire);
+    // The list is in the reverse order of the publication
+    Request* ordered = nullptr;
+    while (list != nullptr) {
+      Request* next = list->next_;
+      list->next_ = ordered;
+      ordered = list;
+      list = next;
+    }
+
+    active_ = this;
+    while (ordered != nullptr) {
+      T* items[kMaxBatch];
+      Request* requests[kMaxBatch];
+      size_t count = 0;
+      for (; (ordered != nullptr) && (count < kMaxBatch); ordered = ordered->next_) {
+        requests[count] = ordered;
+        items[count++] = ordered->item_;
+      }
+      batch(items, count);
+      // The requests live on the stacks of the waiting threads, so don't touch them after done
+      for (size_t i = 0; i < count; ++i) {
+        requests[i]->done_.store(true, std::memory_order_release);
+      }
+    }
+    active_ = nullptr;
+  }
+
+  std::atomic<Request*> published_;  //!< The list of the published requests
+  //! The combiner of the current thread, which runs the batch callback
+  static inline thread_local const SubmitCombiner* active_ = nullptr;
+};
+
+/*! @}
+ *  @}
+ */
+
+}  // namespace amd
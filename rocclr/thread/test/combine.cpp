@@ -0,0 +1,174 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+
+#include <thread/submitcombiner.hpp>
+#include <thread/monitor.hpp>
+#include <utils/flags.hpp>
+#include <utils/debug.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+// The same submission shape as the direct dispatch on a shared stream: a packet write into
+// the ring and a doorbell update under the execution lock of the virtual device
+struct Packet {
+  uint32_t thread;
+  uint32_t sequence;
+  uint64_t payload[7];
+};
+
+class MockVirtualDevice {
+ public:
+  static constexpr size_t kRingSize = 4096;
+
+  explicit MockVirtualDevice(uint64_t doorbellNs)
+      : execution_(true), ring_(kRingSize), doorbellNs_(doorbellNs) {}
+
+  amd::Monitor& execution() { return execution_; }
+
+  void beginSubmitBatch() { deferDoorbell_ = true; }
+  void endSubmitBatch() {
+    deferDoorbell_ = false;
+    ringDoorbell();
+  }
+
+  void submit(const Packet& packet) {
+    ring_[writeIndex_ % kRingSize] = packet;
+    if (packet.sequence <= lastSequence_[packet.thread]) {
+      ordered_ = false;
+    }
+    lastSequence_[packet.thread] = packet.sequence;
+    ++writeIndex_;
+    if (!deferDoorbell_) {
+      ringDoorbell();
+    }
+  }
+
+  void reset(size_t threads) {
+    writeIndex_ = 0;
+    doorbells_ = 0;
+    ordered_ = true;
+    lastSequence_.assign(threads, 0);
+  }
+
+  uint64_t writeIndex_ = 0;
+  uint64_t doorbells_ = 0;
+  bool ordered_ = true;
+
+ private:
+  // The doorbell is an uncached MMIO write, emulated with a busy wait
+  void ringDoorbell() {
+    ++doorbells_;
+    uint64_t end = amd::Os::timeNanos() + doorbellNs_;
+    while (amd::Os::timeNanos() < end) {
+    }
+  }
+
+  amd::Monitor execution_;
+  std::vector<Packet> ring_;
+  std::vector<uint32_t> lastSequence_;
+  uint64_t doorbellNs_;
+  bool deferDoorbell_ = false;
+};
+
+struct Command {
+  Packet packet;
+};
+
+static bool benchmark(MockVirtualDevice& vdev, bool combine, uint32_t threads,
+                      uint32_t iterations) {
+  amd::SubmitCombiner<Command> combiner;
+  vdev.reset(threads);
+  std::atomic<uint32_t> ready(0);
+
+  auto producer = [&](uint32_t id) {
+    ready.fetch_add(1);
+    while (ready.load() < threads) {
+    }
+    for (uint32_t i = 1; i <= iterations; ++i) {
+      Command command = {{id, i, {}}};
+      if (combine) {
+        combiner.Submit(&command, vdev.execution(),
+                        [&vdev](Command* const* commands, size_t count) {
+                          if (count > 1) {
+                            vdev.beginSubmitBatch();
+                          }
+                          for (size_t c = 0; c < count; ++c) {
+                            vdev.submit(commands[c]->packet);
+                          }
+                          if (count > 1) {
+                            vdev.endSubmitBatch();
+                          }
+                        });
+      } else {
+        amd::ScopedLock sl(vdev.execution());
+        vdev.submit(command.packet);
+      }
+    }
+  };
+
+  uint64_t start = amd::Os::timeNanos();
+  std::vector<std::thread> workers;
+  for (uint32_t t = 0; t < threads; ++t) {
+    workers.emplace_back(producer, t);
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  uint64_t time = amd::Os::timeNanos() - start;
+
+  uint64_t total = uint64_t{threads} * iterations;
+  printf("%2u threads, %-9s: %8.1f ns per submission, %6.2f packets per doorbell\n", threads,
+         combine ? "combined" : "locked", static_cast<double>(time) / total,
+         static_cast<double>(vdev.writeIndex_) / std::max<uint64_t>(vdev.doorbells_, 1));
+  if ((vdev.writeIndex_ != total) || !vdev.ordered_) {
+    LogPrintfError("Lost or reordered submissions: %llu of %llu",
+                   static_cast<unsigned long long>(vdev.writeIndex_),
+                   static_cast<unsigned long long>(total));
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  amd::Flag::init();
+  amd::Os::init();
+  // submitcombine_test [iterations per thread] [doorbell time in ns] [max threads]
+  uint32_t iterations = (argc > 1) ? strtoul(argv[1], nullptr, 0) : 20000;
+  uint64_t doorbellNs = (argc > 2) ? strtoul(argv[2], nullptr, 0) : 200;
+  uint32_t maxThreads = (argc > 3) ? strtoul(argv[3], nullptr, 0) :
+                                     std::min(std::max(amd::Os::processorCount(), 2), 16);
+  iterations = std::max(iterations, 1u);
+
+  MockVirtualDevice vdev(doorbellNs);
+  bool ret = true;
+  for (uint32_t threads = 1; threads <= maxThreads; threads *= 2) {
+    ret = ret && benchmark(vdev, false, threads, iterations);
+    ret = ret && benchmark(vdev, true, threads, iterations);
+  }
+  printf("%s: submitcombine(%u iterations, %llu ns doorbell) %s!\n", __func__, iterations,
+         static_cast<unsigned long long>(doorbellNs), ret ? "Succeeded" : "Failed");
+  return ret ? 0 : 1;
+}
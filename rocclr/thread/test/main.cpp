@@ -0,0 +1,139 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#include <thread/sharedwait.hpp>
+#include <utils/flags.hpp>
+#include <utils/debug.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Ping-pong between two processes over a shared page, the same pattern as a hipEvent
+// recorded in one process and synchronized in another. Only the CPU side is measured.
+struct SharedPage {
+  amd::SharedWaitWord word;
+  std::atomic<uint32_t> turn;
+};
+
+enum WaitMode {
+  kSleep = 0,  // Poll with 1 ms sleep, the old IPC event wait
+  kBlock,      // Block in the kernel without spinning
+  kSpinBlock,  // Spin, then block in the kernel
+};
+
+static const char* modeName(WaitMode mode) {
+  switch (mode) {
+    case kSleep: return "sleep poll";
+    case kBlock: return "futex";
+    default: return "spin + futex";
+  }
+}
+
+static void waitTurn(SharedPage* page, uint32_t turn, WaitMode mode, uint64_t spinNs) {
+  auto done = [&]() { return page->turn.load(std::memory_order_acquire) == turn; };
+  if (mode == kSleep) {
+    while (!done()) {
+      amd::Os::sleep(1);
+    }
+  } else {
+    page->word.Wait(done, (mode == kBlock) ? 0 : spinNs);
+  }
+}
+
+static void setTurn(SharedPage* page, uint32_t turn, WaitMode mode) {
+  page->turn.store(turn, std::memory_order_release);
+  if (mode != kSleep) {
+    page->word.Wake();
+  }
+}
+
+bool benchmark(WaitMode mode, unsigned int iterations, uint64_t spinNs) {
+  void* mem = mmap(nullptr, sizeof(SharedPage), PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (mem == MAP_FAILED) {
+    LogError("mmap() failed");
+    return false;
+  }
+  SharedPage* page = static_cast<SharedPage*>(mem);
+  page->word.Init();
+  page->turn.store(0);
+
+  pid_t child = fork();
+  if (child < 0) {
+    LogError("fork() failed");
+    munmap(mem, sizeof(SharedPage));
+    return false;
+  }
+  if (child == 0) {
+    // Completer: answers every odd turn with the next even turn
+    for (unsigned int i = 0; i < iterations; ++i) {
+      waitTurn(page, 2 * i + 1, mode, spinNs);
+      setTurn(page, 2 * i + 2, mode);
+    }
+    _exit(0);
+  }
+
+  std::vector<uint64_t> latency(iterations);
+  for (unsigned int i = 0; i < iterations; ++i) {
+    uint64_t start = amd::Os::timeNanos();
+    setTurn(page, 2 * i + 1, mode);
+    waitTurn(page, 2 * i + 2, mode, spinNs);
+    latency[i] = amd::Os::timeNanos() - start;
+  }
+
+  int status = 0;
+  waitpid(child, &status, 0);
+  munmap(mem, sizeof(SharedPage));
+
+  std::sort(latency.begin(), latency.end());
+  uint64_t total = 0;
+  for (auto ns : latency) {
+    total += ns;
+  }
+  printf("%-14s round trip: avg %9.2f us, p50 %9.2f us, p99 %9.2f us, max %9.2f us\n",
+         modeName(mode), total / 1000.0 / iterations, latency[iterations / 2] / 1000.0,
+         latency[(iterations * 99) / 100] / 1000.0, latency.back() / 1000.0);
+  return WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+}
+
+int main(int argc, char** argv) {
+  amd::Flag::init();
+  amd::Os::init();
+  // sharedwait_test [iterations] [spin time in us]
+  unsigned int iterations = (argc > 1) ? strtoul(argv[1], nullptr, 0) : 10000;
+  uint64_t spinNs = ((argc > 2) ? strtoul(argv[2], nullptr, 0) : DEBUG_CLR_SHARED_WAIT_SPIN) *
+      1000;
+  iterations = std::max(iterations, 1u);
+
+  bool ret = true;
+  // The sleep poll is slow, so limit its iterations
+  ret = ret && benchmark(kSleep, std::min(iterations, 200u), spinNs);
+  ret = ret && benchmark(kBlock, iterations, spinNs);
+  ret = ret && benchmark(kSpinBlock, iterations, spinNs);
+  printf("%s: benchmark(%u iterations, %llu us spin) %s!\n", __func__, iterations,
+         static_cast<unsigned long long>(spinNs / 1000), ret ? "Succeeded" : "Failed");
+  return ret ? 0 : 1;
+}
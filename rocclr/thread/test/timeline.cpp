@@ -0,0 +1,237 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+
+#include <thread/timeline.hpp>
+#include <os/os.hpp>
+#include <utils/flags.hpp>
+#include <utils/debug.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The retired packet counter of a mock queue, in place of the HSA completion signal
+struct MockSignal {
+  std::atomic<uint64_t>* retired_ = nullptr;
+
+  uint64_t Retired() const { return retired_->load(std::memory_order_acquire); }
+  void WaitRetired(uint64_t count) const {
+    while (Retired() < count) {
+      amd::Os::yield();
+    }
+  }
+};
+
+// The old tracking object: a heap allocated event per operation, completed by the queue
+struct MockEvent {
+  std::atomic<bool> done_{false};
+};
+
+// An in-order queue, which retires the submitted packets from a worker thread
+class MockQueue {
+ public:
+  MockQueue() : worker_(&MockQueue::Run, this) {}
+  ~MockQueue() {
+    {
+      std::lock_guard<std::mutex> lock(lock_);
+      exit_ = true;
+    }
+    worker_.join();
+  }
+
+  // A packet retires the timeline value or completes the event
+  void Submit(uint64_t value, MockEvent* event) {
+    std::lock_guard<std::mutex> lock(lock_);
+    packets_.push_back({value, event});
+  }
+
+  std::atomic<uint64_t> retired_{0};
+  bool ordered_ = true;
+
+ private:
+  struct Packet {
+    uint64_t value;
+    MockEvent* event;
+  };
+
+  void Run() {
+    while (true) {
+      Packet packet = {0, nullptr};
+      bool found = false;
+      {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (!packets_.empty()) {
+          packet = packets_.front();
+          packets_.pop_front();
+          found = true;
+        } else if (exit_) {
+          return;
+        }
+      }
+      if (!found) {
+        amd::Os::yield();
+        continue;
+      }
+      if (packet.event != nullptr) {
+        packet.event->done_.store(true, std::memory_order_release);
+      } else {
+        // Packets retire in order, so the counter is the last retired value
+        if (packet.value != retired_.load(std::memory_order_relaxed) + 1) {
+          ordered_ = false;
+        }
+        retired_.store(packet.value, std::memory_order_release);
+      }
+    }
+  }
+
+  std::mutex lock_;
+  std::deque<Packet> packets_;
+  bool exit_ = false;
+  std::thread worker_;  // Starts last, after the state above is initialized
+};
+
+// Checks the value semantics on a single thread
+static bool functional() {
+  std::atomic<uint64_t> retired(0);
+  amd::Timeline<MockSignal> timeline(MockSignal{&retired});
+  bool ret = timeline.IsComplete(0) && !timeline.IsComplete(1);
+  uint64_t first = timeline.Advance();
+  uint64_t second = timeline.Advance();
+  ret = ret && (first == 1) && (second == 2) && (timeline.Submitted() == 2);
+  retired.store(1);
+  ret = ret && timeline.IsComplete(first) && !timeline.IsComplete(second);
+  ret = ret && (timeline.Completed() == 1);
+  retired.store(2);
+  timeline.Wait(second);
+  ret = ret && timeline.IsComplete(second) && (timeline.Completed() == 2);
+  printf("functional: %s\n", ret ? "passed" : "failed");
+  return ret;
+}
+
+// Tracks the reuse of a few buffers, the memory pool pattern: every release records the
+// queue position and a buffer is reused only after the queue passed it.
+// The readers poll the timeline concurrently and check the cached value never runs ahead
+// of the queue or goes back.
+static bool benchmark(bool useTimeline, uint32_t iterations, uint32_t readers) {
+  constexpr uint32_t kBuffers = 16;
+  MockQueue queue;
+  amd::Timeline<MockSignal> timeline(MockSignal{&queue.retired_});
+  std::vector<uint64_t> points(kBuffers, 0);
+  std::vector<MockEvent*> events(kBuffers, nullptr);
+  std::atomic<bool> done(false);
+  std::atomic<bool> valid(true);
+  uint64_t reused = 0;
+
+  std::vector<std::thread> pollers;
+  for (uint32_t r = 0; useTimeline && (r < readers); ++r) {
+    pollers.emplace_back([&]() {
+      uint64_t last = 0;
+      while (!done.load(std::memory_order_relaxed)) {
+        uint64_t submitted = timeline.Submitted();
+        timeline.IsComplete(submitted);
+        uint64_t completed = timeline.Completed();
+        if ((completed < last) || (completed > queue.retired_.load())) {
+          valid = false;
+        }
+        last = completed;
+        amd::Os::yield();
+      }
+    });
+  }
+
+  uint64_t start = amd::Os::timeNanos();
+  for (uint32_t i = 0; i < iterations; ++i) {
+    uint32_t buffer = i % kBuffers;
+    // Reuse the buffer if the queue is done with it, otherwise wait
+    if (useTimeline) {
+      if (timeline.IsComplete(points[buffer])) {
+        ++reused;
+      } else {
+        timeline.Wait(points[buffer]);
+      }
+      if (queue.retired_.load() < points[buffer]) {
+        valid = false;
+      }
+      points[buffer] = timeline.Advance();
+      queue.Submit(points[buffer], nullptr);
+    } else {
+      if (events[buffer] != nullptr) {
+        if (events[buffer]->done_.load(std::memory_order_acquire)) {
+          ++reused;
+        } else {
+          while (!events[buffer]->done_.load(std::memory_order_acquire)) {
+            amd::Os::yield();
+          }
+        }
+        delete events[buffer];
+      }
+      events[buffer] = new MockEvent();
+      queue.Submit(0, events[buffer]);
+    }
+  }
+  uint64_t time = amd::Os::timeNanos() - start;
+
+  // Drain the queue before the events are released
+  for (uint32_t b = 0; b < kBuffers; ++b) {
+    if (useTimeline) {
+      timeline.Wait(points[b]);
+    } else if (events[b] != nullptr) {
+      while (!events[b]->done_.load(std::memory_order_acquire)) {
+        amd::Os::yield();
+      }
+      delete events[b];
+    }
+  }
+  done = true;
+  for (auto& poller : pollers) {
+    poller.join();
+  }
+
+  printf("%-14s: %8.1f ns per tracked release, %5.1f%% reused without a wait\n",
+         useTimeline ? "timeline" : "event per op", static_cast<double>(time) / iterations,
+         100.0 * reused / iterations);
+  if (!valid || !queue.ordered_) {
+    LogError("Timeline value ran ahead of the queue");
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  amd::Flag::init();
+  amd::Os::init();
+  // timeline_test [iterations] [polling threads]
+  uint32_t iterations = (argc > 1) ? strtoul(argv[1], nullptr, 0) : 200000;
+  uint32_t readers = (argc > 2) ? strtoul(argv[2], nullptr, 0) : 2;
+  iterations = std::max(iterations, 1u);
+
+  bool ret = functional();
+  ret = ret && benchmark(false, iterations, readers);
+  ret = ret && benchmark(true, iterations, readers);
+  printf("%s: timeline(%u iterations, %u readers) %s!\n", __func__, iterations, readers,
+         ret ? "Succeeded" : "Failed");
+  return ret ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+/* Copyright (c) 2025 Advanced Micro Devices, Inc.
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE. */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "top.hpp"
+
+namespace amd {
+
+/*! \addtogroup Threads
+ *  @{
+ *
+ *  \addtogroup Synchronization
+ *  @{
+ */
+
+//! \brief Monotonic timeline of an in-order queue, backed by a single completion signal.
+//! Every timeline packet of the queue carries the same signal and retires the next value,
+//! so "the queue is done with the work before value N" becomes a value comparison and
+//! doesn't require an event object per tracked operation.
+//!
+//! Signal must provide:
+//!   uint64_t Retired() const        - the number of retired timeline packets (acquire)
+//!   void WaitRetired(uint64_t count) - blocks until Retired() >= count
+//!
+//! The value 0 is never reserved, hence it can be used as "no tracked work".
+template <typename Signal> class Timeline {
+ public:
+  explicit Timeline(const Signal& signal = Signal()) : signal_(signal) {}
+
+  //! Reserves the value, which the next timeline packet of the queue will retire.
+  //! Must be called under the submission lock of the queue, in the packet order
+  uint64_t Advance() {
+    uint64_t value = submitted_.load(std::memory_order_relaxed) + 1;
+    submitted_.store(value, std::memory_order_release);
+    return value;
+  }
+
+  //! Returns the last reserved value
+  uint64_t Submitted() const { return submitted_.load(std::memory_order_acquire); }
+
+  //! Returns the last known retired value without the signal access
+  uint64_t Completed() const { return completed_.load(std::memory_order_acquire); }
+
+  //! Returns true if the queue retired the provided value
+  bool IsComplete(uint64_t value) {
+    if (value <= Completed()) {
+      return true;
+    }
+    return value <= Update(signal_.Retired());
+  }
+
+  //! Waits until the queue retires the provided value
+  void Wait(uint64_t value) {
+    if (!IsComplete(value)) {
+      signal_.WaitRetired(value);
+      Update(value);
+    }
+  }
+
+  //! Returns the signal of the timeline packets
+  Signal& signal() { return signal_; }
+
+ private:
+  //! Moves the cached retired value forward. The signal can be observed by several threads,
+  //! so a late reader must not move the cache back
+  uint64_t Update(uint64_t retired) {
+    uint64_t completed = completed_.load(std::memory_order_relaxed);
+    while ((completed < retired) &&
+           !completed_.compare_exchange_weak(completed, retired, std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+    }
+    return (completed < retired) ? retired : completed;
+  }
+
+  Signal signal_;                        //!< The completion signal of the timeline packets
+  std::atomic<uint64_t> submitted_{0};   //!< The last reserved value
+  std::atomic<uint64_t> completed_{0};   //!< The last known retired value
+};
+
+/*! @}
+ *  @}
+ */
+
+}  // namespace amd
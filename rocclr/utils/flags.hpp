@@ -151,6 +151,8 @@ release(uint, GPU_MAX_COMMAND_BUFFERS, 8,                                     \
          "The maximum number of command buffers allocated per queue")         \
 release(uint, GPU_MAX_HW_QUEUES, 4,                                           \
          "The maximum number of HW queues allocated per device")              \
+release(bool, DEBUG_CLR_HW_QUEUE_REBALANCE, false,                            \
+        "Move an idle stream from a loaded shared HW queue to a lighter one") \
 release(bool, GPU_IMAGE_BUFFER_WAR, true,                                     \
         "Enables image buffer workaround")                                    \
 release(cstring, HIP_VISIBLE_DEVICES, "",                                     \
@@ -183,6 +185,12 @@ release(uint, AMD_OPT_FLUSH, 1,                                               \
         "0x1 = Use device-scope fence operations when possible.")             \
 release(bool, AMD_DIRECT_DISPATCH, false,                                     \
         "Enable direct kernel dispatch.")                                     \
+release(bool, DEBUG_CLR_SUBMIT_COMBINE, false,                                \
+        "Combine the direct dispatch submissions of the threads to a queue")  \
+release(bool, DEBUG_CLR_LAZY_KERNELS, false,                                  \
+        "Create the code object kernels as stubs, built on the first use")    \
+release(uint, DEBUG_CLR_AQL_TEMPLATE_CACHE, 16,                               \
+        "Dispatch packet templates cached per queue, 0 disables the cache")   \
 release(uint, HIP_HIDDEN_FREE_MEM, 0,                                         \
         "Reserve free mem reporting in Mb"                                    \
         "0 = Disable")                                                        \
@@ -229,6 +237,11 @@ release(uint, DEBUG_CLR_LIMIT_BLIT_WG, 16,                                    \
         "Limit the number of workgroups in blit operations")                  \
 release(bool, DEBUG_CLR_BLIT_KERNARG_OPT, false,                              \
         "Enable blit kernel arguments optimization")                          \
+release(uint, DEBUG_CLR_BLIT_TUNE, 0,                                         \
+        "Blit decision table: 0 - heuristics, 1 - use the cached table, "     \
+        "2 - calibrate the devices, missing in the cache")                    \
+release(cstring, DEBUG_CLR_BLIT_TUNE_FILE, "",                                \
+        "Blit table cache file, default $HOME/.cache/rocclr_blit_tune")       \
 release(bool, ROC_SKIP_KERNEL_ARG_COPY, false,                                \
         "If true, then runtime can skip kernel arg copy")                     \
 release(bool, GPU_STREAMOPS_CP_WAIT, false,                                   \
@@ -257,6 +270,40 @@ release(bool, DEBUG_HIP_FORCE_ASYNC_QUEUE, false,                             \
         "Forces grpahs into async queue mode. DEBUG_HIP_FORCE_GRAPH_QUEUES must be 1") \
 release(uint, DEBUG_HIP_FORCE_GRAPH_QUEUES, 4,                                \
         "Forces the number of streams for the graph parallel execution")      \
+release(bool, DEBUG_HIP_GRAPH_MEM_PLANNER, false,                             \
+        "Share memory of graph mem alloc nodes with disjoint lifetimes")      \
+release(uint, DEBUG_CLR_IPC_MEM_CACHE_SIZE, 0,                                \
+        "Number of closed IPC memory mappings kept for reuse, 0 - unmap on close") \
+release(uint, DEBUG_CLR_STAGING_IDLE_TIMEOUT, 1000,                           \
+        "Time in ms before an unused staging buffer of the queue is released") \
+release(uint, DEBUG_CLR_SHARED_WAIT_SPIN, 20,                                 \
+        "Time in us to spin before a cross process waiter blocks in the kernel") \
+release(uint, DEBUG_CLR_HOST_BLIT_THREADS, 4,                                 \
+        "Max worker threads of a large host blit transfer, 1 - serial")       \
+release(uint, DEBUG_HIP_FP_CONVERT_ISA, 0,                                    \
+        "Host fp8/bf16/fp16 convert ISA: 0-auto, 1-scalar, 2-AVX2, 3-AVX512") \
+release(uint, DEBUG_CLR_MOCK_HSA_DEVICES, 1,                                  \
+        "Number of GPU agents, which the mock HSA runtime reports")           \
+release(cstring, DEBUG_CLR_MOCK_HSA_ISA, "gfx90a:sramecc+:xnack-",            \
+        "Target ID of the GPU agents of the mock HSA runtime")                \
+release(uint, DEBUG_CLR_MOCK_HSA_PACKET_DELAY, 0,                             \
+        "Time in us the mock HSA runtime takes to execute an AQL packet")     \
+release(bool, HIP_API_STATS, false,                                           \
+        "Collect per API call count, latency histogram and error statistics") \
+release(cstring, HIP_API_STATS_DUMP, "",                                      \
+        "Print HIP API statistics at exit: stderr, stdout or a file path")    \
+release(uint, HIP_API_STATS_DUMP_INTERVAL, 0,                                 \
+        "Interval in ms for periodic HIP API statistics dump, 0 - exit only") \
+release(bool, DEBUG_HIP_GRAPH_CP_SCHEDULER, true,                             \
+        "Use critical path list scheduling for the graph parallel execution") \
+release(uint, DEBUG_HIP_EVENT_POOL_SIZE, 1024,                                \
+        "Max number of destroyed HIP events, kept per device, 0 - off")       \
+release(uint, DEBUG_HIP_STREAM_POOL_SIZE, 8,                                  \
+        "Max number of destroyed HIP streams, kept per device for reuse")     \
+release(uint, DEBUG_HIP_MODULE_BUILD_THREADS, 0,                              \
+        "Max threads building the device programs of a module, 0 - per device")\
+release(bool, DEBUG_HIP_STREAM_DECOMPRESS, true,                              \
+        "Decompress only the matching code objects of compressed zstd bundles")\
 release(bool, HIP_ALWAYS_USE_NEW_COMGR_UNBUNDLING_ACTION, false,              \
         "Force to always use new comgr unbundling action")                    \
 release(uint, DEBUG_HIP_BLOCK_SYNC, 50,                                       \